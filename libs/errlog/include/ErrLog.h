@@ -14,6 +14,8 @@
 #include <map>
 #include <list>
 #include <set>
+#include <initializer_list>
+#include <utility>
 
 
 #define   OUTBUF_SIZE     (1024 * 128)
@@ -56,16 +58,16 @@ struct MessageEntry {
 
 
 
-#define VAL(key, value)   std::make_pair(key,     value)
+#define VAL(key, value)   MsgSubstitute(key,     value)
 
-#define LINE(value)       std::make_pair("LINE",      ErrLog::CreateDecNum(value))
-#define ERR(value)        std::make_pair("ERR",       ErrLog::CreateDecNum(value))
-#define WARN(value)       std::make_pair("WARN",      ErrLog::CreateDecNum(value))
-#define TIME(value)       std::make_pair("TIME",      ErrLog::CreateDecNum(value))
-#define NUM2(value)       std::make_pair("NUM2",      ErrLog::CreateDecNum(value))
-#define NUM(value)        std::make_pair("NUM",       ErrLog::CreateDecNum(value))
-#define MSB(value)        std::make_pair("MSB",       ErrLog::CreateDecNum(value))
-#define LSB(value)        std::make_pair("LSB",       ErrLog::CreateDecNum(value))
+#define LINE(value)       MsgSubstitute("LINE",      static_cast<unsigned int>(value))
+#define ERR(value)        MsgSubstitute("ERR",       static_cast<unsigned int>(value))
+#define WARN(value)       MsgSubstitute("WARN",      static_cast<unsigned int>(value))
+#define TIME(value)       MsgSubstitute("TIME",      static_cast<unsigned int>(value))
+#define NUM2(value)       MsgSubstitute("NUM2",      static_cast<unsigned int>(value))
+#define NUM(value)        MsgSubstitute("NUM",       static_cast<unsigned int>(value))
+#define MSB(value)        MsgSubstitute("MSB",       static_cast<unsigned int>(value))
+#define LSB(value)        MsgSubstitute("LSB",       static_cast<unsigned int>(value))
 
 #define PATH(path)        VAL("PATH",     path)
 #define TXT2(txt)         VAL("TEXT2",    txt)
@@ -117,7 +119,7 @@ struct MessageEntry {
 
 #define THISLEVEL()       VAL("LEVEL",    this->GetSvdLevelStr(this->GetSvdLevel()))
 
-#define PAIR(x)           std::pair<std::string, std::string> substitute##x
+#define PAIR(x)           const MsgSubstitute& substitute##x
 
 #define SUBS_MAP          std::map  <std::string, std::string>
 #define SUBS_PAIR         std::pair <std::string, std::string>
@@ -126,6 +128,42 @@ typedef std::map  <std::string, MessageEntry> MsgTable;
 typedef std::map  <std::string, MsgLevel> MsgTableStrict;
 
 
+/**
+ * @brief substitute for a %KEY% command in a message, refers to the value passed to LogMsg().
+ *        The value is only converted to a string if the message is emitted, it can be a string,
+ *        an unsigned number or a callable returning a string, e.g. a lambda creating a hex number.
+ *        Objects are only valid during the LogMsg() call they are created for.
+*/
+class MsgSubstitute {
+public:
+  template<typename V>
+  MsgSubstitute(const char* key, const V& value) : m_key(key), m_value(&value), m_format(&Format<V>) {}
+
+  template<typename K, typename V>
+  MsgSubstitute(const std::pair<K, V>& substitute) : MsgSubstitute(KeyStr(substitute.first), substitute.second) {}
+
+  const char*         GetKey    () const { return m_key;              }
+  std::string         GetValue  () const { return m_format(m_value);  }
+
+protected:
+  template<typename V>
+  static std::string  Format    (const void* value) { return ToString(*static_cast<const V*>(value), 0); }
+
+  template<typename V>
+  static auto         ToString  (const V& value, int) -> decltype(std::string(value())) { return value(); }
+  template<typename V>
+  static std::string  ToString  (const V& value, long) { return std::string(value); }
+  static std::string  ToString  (unsigned int value, long);
+
+  static const char*  KeyStr    (const char* key)        { return key;          }
+  static const char*  KeyStr    (const std::string& key) { return key.c_str();  }
+
+  const char*         m_key;
+  const void*         m_value;
+  std::string       (*m_format)(const void* value);
+};
+
+
 /**
  * @brief handle messages
 */
@@ -370,17 +408,69 @@ public:
   void          SetLevelToError       ()                                { SetLevel(MsgLevel::LEVEL_ERROR);          }
 
   /**
-   * @brief sets the name of the currently processed file
+   * @brief sets the name of the currently processed file, in the thread context if the calling thread has one
    * @param fileName the name of the currently processed file
   */
-  void          SetFileName           (const std::string &fileName)     { m_fileName = fileName;                    }
+  void          SetFileName           (const std::string &fileName);
 
   /**
-   * @brief build and print whole message
+   * @brief gets the name of the currently processed file, from the thread context if the calling thread has one
+   * @return the name of the currently processed file
+  */
+  const std::string& GetFileName      () const { return m_threadContext ? m_threadContext->fileName : m_fileName; }
+
+  /**
+   * @brief build and print whole message, buffers it if the calling thread has a thread context
    * @param msg message object
   */
   void          PDSC_PrintMessage     (const PdscMsg &msg);
 
+  /**
+   * @brief message issued by a thread with a thread context
+  */
+  struct ThreadMsg {
+    PdscMsg       msg;
+    std::string   fileName;        // file name at the time the message was issued
+  };
+
+  /**
+   * @brief logging context of a worker thread: messages are buffered and printed later in the
+   *        order the caller chooses, file name and consumer do not affect other threads
+  */
+  struct ThreadContext {
+    ThreadContext() : consumer(nullptr) {}
+
+    std::string           fileName;   // name of the currently processed file
+    IErrConsumer*         consumer;   // message consumer, nullptr to use the global one
+    std::list<ThreadMsg>  messages;   // buffered messages in issue order
+  };
+
+  /**
+   * @brief sets logging context of the calling thread
+   * @param context thread context, nullptr to print messages directly again
+   * @return previous context of the calling thread
+  */
+  static ThreadContext* SetThreadContext(ThreadContext* context);
+
+  /**
+   * @brief get logging context of the calling thread
+   * @return pointer to thread context, nullptr if messages are printed directly
+  */
+  static ThreadContext* GetThreadContext() { return m_threadContext; }
+
+  /**
+   * @brief print a message buffered in a thread context, must not be called from a worker thread
+   * @param context thread context the message was issued in
+   * @param threadMsg buffered message
+  */
+  void          PrintThreadMessage    (const ThreadContext& context, const ThreadMsg& threadMsg);
+
+  /**
+   * @brief print all messages buffered in a thread context in issue order and clear the buffer
+   * @param context thread context
+  */
+  void          PrintThreadMessages   (ThreadContext& context);
+
   /**
    * @brief Check if message will print according to current level
    * @param num message number string
@@ -489,6 +579,32 @@ public:
   static const std::string NEW_LINE_STRING;
 
 protected:
+  /**
+   * @brief adds a message by name, substitutes are only formatted if the message is emitted
+   * @param num number of message as string
+   * @param substitutes pointers to substitutes, first one wins for duplicate keys
+   * @param line line number in processed file where message occurred
+   * @param col column number in processed file where message occurred
+   * @return 0 if succeeded
+  */
+  int           AddMessage            (const std::string &num, std::initializer_list<const MsgSubstitute*> substitutes, int32_t line, int32_t col);
+
+  /**
+   * @brief check if the text of a message is printed or passed to a consumer
+   * @param msg message object
+   * @param consumer message consumer in charge
+   * @return true if the message text is needed
+  */
+  bool          IsMsgEmitted          (const PdscMsg &msg, IErrConsumer* consumer);
+
+  /**
+   * @brief build and print whole message
+   * @param msg message object
+   * @param fileName name of the processed file the message refers to
+   * @param consumer message consumer in charge
+  */
+  void          PrintMessage          (const PdscMsg &msg, const std::string &fileName, IErrConsumer* consumer);
+
   char*                   m_outBuf;
   IErrConsumer*           m_ErrConsumer;     // not deleted in destructor
   ErrOutputter*           m_ErrOutputter;    // gets deleted in destructor!
@@ -520,6 +636,7 @@ private:
   static void  Destroy() { delete theErrLog; theErrLog = nullptr; }
   static ErrLogDestroyer theErrLogDestroyer;
   static ErrLog* theErrLog;  // the application-wide ErrLog Object
+  static thread_local ThreadContext* m_threadContext;
 
   static const MsgTable msgTable;
   static const MsgTableStrict msgStrictTable;
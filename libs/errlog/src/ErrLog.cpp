@@ -16,6 +16,7 @@ const string ErrLog::NEW_LINE_STRING = "\n";
 
 ErrLog::ErrLogDestroyer ErrLog::theErrLogDestroyer;
 ErrLog* ErrLog::theErrLog = nullptr;  // the application-wide ErrLog Object
+thread_local ErrLog::ThreadContext* ErrLog::m_threadContext = nullptr;
 MsgTable PdscMsg::m_messageTable;
 MsgTableStrict PdscMsg::m_messageTableStrict;
 MsgLevel g_msgLevel;
@@ -28,7 +29,7 @@ const string& PdscMsg::GetSubstitute(const string &key) const
     return it->second;
   }
 
-  static string errStr;
+  static thread_local string errStr;
   errStr = "<";
   errStr += key;
   errStr += ">";
@@ -59,6 +60,11 @@ void PdscMsg::ClearData ()
   m_col   = -1;
 }
 
+string MsgSubstitute::ToString(unsigned int value, long)
+{
+  return ErrLog::CreateDecNum(value);
+}
+
 MsgLevel PdscMsg::GetMsgLevel() const
 {
   MsgLevel level;
@@ -297,164 +303,73 @@ int ErrLog::Message (const PdscMsg &msg)
 
 int ErrLog::Message (const string &num, int32_t line, int32_t col)
 {
-  PdscMsg msg;
-
-  msg.SetMsg(num, line, col);
-  PDSC_PrintMessage(msg);
-
-  return 0;
+  return AddMessage(num, {}, line, col);
 }
 
 int ErrLog::Message (const string &num, PAIR(1), int32_t line, int32_t col)
 {
-  PdscMsg msg;
-
-  msg.SetMsg(num, line, col);
-  msg.AddSubstitude(substitute1);
-  PDSC_PrintMessage(msg);
-
-  return 0;
+  return AddMessage(num, { &substitute1 }, line, col);
 }
 
 int ErrLog::Message (const string &num, PAIR(1), PAIR(2), int32_t line, int32_t col)
 {
-  PdscMsg msg;
-
-  msg.SetMsg(num, line, col);
-  msg.AddSubstitude(substitute1);
-  msg.AddSubstitude(substitute2);
-  PDSC_PrintMessage(msg);
-
-  return 0;
+  return AddMessage(num, { &substitute1, &substitute2 }, line, col);
 }
 
 int ErrLog::Message (const string &num, PAIR(1), PAIR(2), PAIR(3), int32_t line, int32_t col)
 {
-  PdscMsg msg;
-
-  msg.SetMsg(num, line, col);
-  msg.AddSubstitude(substitute1);
-  msg.AddSubstitude(substitute2);
-  msg.AddSubstitude(substitute3);
-  PDSC_PrintMessage(msg);
-
-  return 0;
+  return AddMessage(num, { &substitute1, &substitute2, &substitute3 }, line, col);
 }
 
 int ErrLog::Message (const string &num, PAIR(1), PAIR(2), PAIR(3), PAIR(4), int32_t line, int32_t col)
 {
-  PdscMsg msg;
-
-  msg.SetMsg(num, line, col);
-  msg.AddSubstitude(substitute1);
-  msg.AddSubstitude(substitute2);
-  msg.AddSubstitude(substitute3);
-  msg.AddSubstitude(substitute4);
-  PDSC_PrintMessage(msg);
-
-  return 0;
+  return AddMessage(num, { &substitute1, &substitute2, &substitute3, &substitute4 }, line, col);
 }
 
 int ErrLog::Message (const string &num, PAIR(1), PAIR(2), PAIR(3), PAIR(4), PAIR(5), int32_t line, int32_t col)
 {
-  PdscMsg msg;
-
-  msg.SetMsg(num, line, col);
-  msg.AddSubstitude(substitute1);
-  msg.AddSubstitude(substitute2);
-  msg.AddSubstitude(substitute3);
-  msg.AddSubstitude(substitute4);
-  msg.AddSubstitude(substitute5);
-  PDSC_PrintMessage(msg);
-
-  return 0;
+  return AddMessage(num, { &substitute1, &substitute2, &substitute3, &substitute4, &substitute5 }, line, col);
 }
 
 int ErrLog::Message (const string &num, PAIR(1), PAIR(2), PAIR(3), PAIR(4), PAIR(5), PAIR(6), int32_t line, int32_t col)
 {
-  PdscMsg msg;
-
-  msg.SetMsg(num, line, col);
-  msg.AddSubstitude(substitute1);
-  msg.AddSubstitude(substitute2);
-  msg.AddSubstitude(substitute3);
-  msg.AddSubstitude(substitute4);
-  msg.AddSubstitude(substitute5);
-  msg.AddSubstitude(substitute6);
-  PDSC_PrintMessage(msg);
-
-  return 0;
+  return AddMessage(num, { &substitute1, &substitute2, &substitute3, &substitute4, &substitute5, &substitute6 }, line, col);
 }
 
 int ErrLog::Message (const string &num, PAIR(1), PAIR(2), PAIR(3), PAIR(4), PAIR(5), PAIR(6), PAIR(7), int32_t line, int32_t col)
 {
-  PdscMsg msg;
-
-  msg.SetMsg(num, line, col);
-  msg.AddSubstitude(substitute1);
-  msg.AddSubstitude(substitute2);
-  msg.AddSubstitude(substitute3);
-  msg.AddSubstitude(substitute4);
-  msg.AddSubstitude(substitute5);
-  msg.AddSubstitude(substitute6);
-  msg.AddSubstitude(substitute7);
-  PDSC_PrintMessage(msg);
-
-  return 0;
+  return AddMessage(num, { &substitute1, &substitute2, &substitute3, &substitute4, &substitute5, &substitute6, &substitute7 }, line, col);
 }
 
 int ErrLog::Message (const string &num, PAIR(1), PAIR(2), PAIR(3), PAIR(4), PAIR(5), PAIR(6), PAIR(7), PAIR(8), int32_t line, int32_t col)
 {
-  PdscMsg msg;
-
-  msg.SetMsg(num, line, col);
-  msg.AddSubstitude(substitute1);
-  msg.AddSubstitude(substitute2);
-  msg.AddSubstitude(substitute3);
-  msg.AddSubstitude(substitute4);
-  msg.AddSubstitude(substitute5);
-  msg.AddSubstitude(substitute6);
-  msg.AddSubstitude(substitute7);
-  msg.AddSubstitude(substitute8);
-  PDSC_PrintMessage(msg);
-
-  return 0;
+  return AddMessage(num, { &substitute1, &substitute2, &substitute3, &substitute4, &substitute5, &substitute6, &substitute7, &substitute8 }, line, col);
 }
 
 int ErrLog::Message (const string &num, PAIR(1), PAIR(2), PAIR(3), PAIR(4), PAIR(5), PAIR(6), PAIR(7), PAIR(8), PAIR(9), int32_t line, int32_t col)
 {
-  PdscMsg msg;
-
-  msg.SetMsg(num, line, col);
-  msg.AddSubstitude(substitute1);
-  msg.AddSubstitude(substitute2);
-  msg.AddSubstitude(substitute3);
-  msg.AddSubstitude(substitute4);
-  msg.AddSubstitude(substitute5);
-  msg.AddSubstitude(substitute6);
-  msg.AddSubstitude(substitute7);
-  msg.AddSubstitude(substitute8);
-  msg.AddSubstitude(substitute9);
-  PDSC_PrintMessage(msg);
-
-  return 0;
+  return AddMessage(num, { &substitute1, &substitute2, &substitute3, &substitute4, &substitute5, &substitute6, &substitute7, &substitute8, &substitute9 }, line, col);
 }
 
 int ErrLog::Message (const string &num, PAIR(1), PAIR(2), PAIR(3), PAIR(4), PAIR(5), PAIR(6), PAIR(7), PAIR(8), PAIR(9), PAIR(10), int32_t line, int32_t col)
+{
+  return AddMessage(num, { &substitute1, &substitute2, &substitute3, &substitute4, &substitute5, &substitute6, &substitute7, &substitute8, &substitute9, &substitute10 }, line, col);
+}
+
+int ErrLog::AddMessage(const string &num, initializer_list<const MsgSubstitute*> substitutes, int32_t line, int32_t col)
 {
   PdscMsg msg;
 
   msg.SetMsg(num, line, col);
-  msg.AddSubstitude(substitute1);
-  msg.AddSubstitude(substitute2);
-  msg.AddSubstitude(substitute3);
-  msg.AddSubstitude(substitute4);
-  msg.AddSubstitude(substitute5);
-  msg.AddSubstitude(substitute6);
-  msg.AddSubstitude(substitute7);
-  msg.AddSubstitude(substitute8);
-  msg.AddSubstitude(substitute9);
-  msg.AddSubstitude(substitute10);
+  if(substitutes.size()) {
+    const ThreadContext* context = m_threadContext;
+    IErrConsumer* consumer = context && context->consumer ? context->consumer : m_ErrConsumer;
+    if(IsMsgEmitted(msg, consumer)) {
+      for(auto substitute : substitutes) {
+        msg.AddSubstitude(SUBS_PAIR(substitute->GetKey(), substitute->GetValue()));
+      }
+    }
+  }
   PDSC_PrintMessage(msg);
 
   return 0;
@@ -504,7 +419,71 @@ bool ErrLog::SuppressMessage (const std::string &msgNum)
   return suppress;
 }
 
+ErrLog::ThreadContext* ErrLog::SetThreadContext(ThreadContext* context)
+{
+  ThreadContext* prevContext = m_threadContext;
+  m_threadContext = context;
+  return prevContext;
+}
+
+void ErrLog::SetFileName(const string &fileName)
+{
+  if(m_threadContext) {
+    m_threadContext->fileName = fileName;
+  }
+  else {
+    m_fileName = fileName;
+  }
+}
+
+bool ErrLog::IsMsgEmitted(const PdscMsg &msg, IErrConsumer* consumer)
+{
+  if(m_quietMode) {
+    return false;
+  }
+
+  MsgLevel msgLevel = msg.GetMsgLevel();
+  if(m_bSuppressAllInfo) {
+    if(msgLevel == MsgLevel::LEVEL_WARNING3 || msgLevel == MsgLevel::LEVEL_INFO || msgLevel == MsgLevel::LEVEL_INFO2) {
+      return false;
+    }
+  }
+  if(m_bSuppressAllWarning) {
+    if(msgLevel == MsgLevel::LEVEL_WARNING || msgLevel == MsgLevel::LEVEL_WARNING2) {
+      return false;
+    }
+  }
+  if(SuppressMessage(msg.GetMsgNum())) {
+    return false;
+  }
+
+  return consumer || m_tmpLevelVerbose || msgLevel >= m_msgOutLevel;
+}
+
 void ErrLog::PDSC_PrintMessage(const PdscMsg &msg)
+{
+  if(m_threadContext) {
+    m_threadContext->messages.push_back({ msg, m_threadContext->fileName });
+    return;
+  }
+
+  PrintMessage(msg, m_fileName, m_ErrConsumer);
+}
+
+void ErrLog::PrintThreadMessage(const ThreadContext& context, const ThreadMsg& threadMsg)
+{
+  PrintMessage(threadMsg.msg, threadMsg.fileName, context.consumer ? context.consumer : m_ErrConsumer);
+}
+
+void ErrLog::PrintThreadMessages(ThreadContext& context)
+{
+  for(const auto& threadMsg : context.messages) {
+    PrintThreadMessage(context, threadMsg);
+  }
+  context.messages.clear();
+}
+
+void ErrLog::PrintMessage(const PdscMsg &msg, const string &fileName, IErrConsumer* consumer)
 {
   static int prevWasMsg = 0, prevSuppressed = 0;
 
@@ -543,7 +522,7 @@ void ErrLog::PDSC_PrintMessage(const PdscMsg &msg)
     return;
   }
 
-  if (m_ErrConsumer && m_ErrConsumer->Consume(msg, m_fileName)) {
+  if (consumer && consumer->Consume(msg, fileName)) {
     return;
   }
 
@@ -582,8 +561,8 @@ void ErrLog::PDSC_PrintMessage(const PdscMsg &msg)
       NewLine();
       TxtOut("*** %s %s:", GetMsgLevelText(msgLevel).c_str(), msg.GetMsgNum().c_str());
 
-      if(!m_fileName.empty()) {
-        TxtOut(" %s", m_fileName.c_str());
+      if(!fileName.empty()) {
+        TxtOut(" %s", fileName.c_str());
       }
       if(lineNo != -1) {
         TxtOut(" (Line %i) ", lineNo);
@@ -10,6 +10,7 @@
 
 #include "RteFsUtils.h"
 
+#include <algorithm>
 #include <vector>
 #include <list>
 #include <string>
@@ -110,3 +111,48 @@ TEST_F(ErrLogTest, PdscMessage) {
   ErrLog::Get()->Save();
   ErrLog::Get()->ClearLogMessages();
 }
+
+TEST_F(ErrLogTest, ThreadContext) {
+  ErrLog::Get()->ClearLogMessages();
+  ErrLog::Get()->SetFileName("ThreadContext.test");
+
+  ErrLog::ThreadContext context;
+  EXPECT_TRUE(ErrLog::SetThreadContext(&context) == nullptr);
+  ErrLog::Get()->SetFileName("Worker.test");
+  LogMsg("M001", VAL("TEXT", "first"), 1, 0);
+  LogMsg("M002", VAL("TEXT", "second"), VAL("TEXT2", "third"), 2, 0);
+  EXPECT_EQ("Worker.test", ErrLog::Get()->GetFileName());
+  EXPECT_EQ(&context, ErrLog::SetThreadContext(nullptr));
+  EXPECT_EQ("ThreadContext.test", ErrLog::Get()->GetFileName());
+
+  EXPECT_TRUE(ErrLog::Get()->GetLogMessages().empty());
+  ASSERT_EQ(2, context.messages.size());
+  EXPECT_EQ("M001", context.messages.front().msg.GetMsgNum());
+  EXPECT_EQ("M002", context.messages.back().msg.GetMsgNum());
+  EXPECT_EQ("Worker.test", context.messages.back().fileName);
+
+  ErrLog::Get()->PrintThreadMessages(context);
+  EXPECT_TRUE(context.messages.empty());
+  const auto& messages = ErrLog::Get()->GetLogMessages();
+  EXPECT_TRUE(find(messages.begin(), messages.end(), "first") != messages.end());
+  EXPECT_TRUE(find(messages.begin(), messages.end(), "secondthird") != messages.end());
+  ErrLog::Get()->ClearLogMessages();
+}
+
+TEST_F(ErrLogTest, DeferredSubstitutes) {
+  ErrLog::Get()->ClearLogMessages();
+
+  int formatted = 0;
+  const auto value = [&formatted]() { formatted++; return string("deferred"); };
+
+  ErrLog::Get()->SetQuietMode();
+  LogMsg("M001", VAL("TEXT", value));
+  ErrLog::Get()->SetQuietMode(false);
+  EXPECT_EQ(0, formatted);
+
+  LogMsg("M001", VAL("TEXT", value), NUM(42));
+  EXPECT_EQ(1, formatted);
+  const auto& messages = ErrLog::Get()->GetLogMessages();
+  EXPECT_TRUE(find(messages.begin(), messages.end(), "deferred") != messages.end());
+  ErrLog::Get()->ClearLogMessages();
+}
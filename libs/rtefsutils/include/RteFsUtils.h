@@ -91,6 +91,19 @@ public:
    * @return true if file content is equal to given string
   */
   static bool CmpFileMem(const std::string& fileName, const std::string& buffer);
+  /**
+   * @brief calculate hash of file content
+   * @param fileName name of file to be processed
+   * @return hash of file content as returned by RteUtils::GetHash(), empty string if file cannot be read
+  */
+  static std::string GetFileHash(const std::string& fileName);
+  /**
+   * @brief compare content of two files, file sizes are checked first and reading stops at the first difference
+   * @param fileName1 name of first file
+   * @param fileName2 name of second file
+   * @return true if both files can be read and have the same content
+  */
+  static bool CmpFiles(const std::string& fileName1, const std::string& fileName2);
   /**
    * @brief replace occurrences of "%Instance%" in file content with 'nInst' and store content in string 'buffer'
    * @param fileName name of file to be processed
@@ -230,6 +243,22 @@ public:
   */
   static std::string LexicallyNormal(const std::string& path);
 
+  /**
+   * @brief get weakly canonical path, same as std::filesystem::weakly_canonical
+   *
+   * Canonical names of existing absolute directories are memoized in a process-wide cache,
+   * a file path is composed of the canonical name of its directory and the file name as given.
+   * The cache is limited in size, it should be cleared at the start of each run.
+   * @param path path to be processed
+   * @return string containing the weakly canonical path, empty string in case of error
+  */
+  static std::string WeaklyCanonical(const std::string& path);
+
+  /**
+   * @brief clear cache of canonical directory names, required if directories or symbolic links have been renamed, added or removed
+  */
+  static void ClearCanonicalPathCache();
+
   /**
    * @brief determine relative path in respect to base directory
    * @param path path to be processed
@@ -19,15 +19,56 @@
 #include "WildCards.h"
 
 #include <chrono>
+#include <cstring>
 #include <sstream>
 #include <fstream>
 #include <iostream>
 #include <iomanip>
+#include <mutex>
 #include <regex>
 #include <thread>
+#include <unordered_map>
 
 using namespace std;
 
+// results of fs::canonical() for existing absolute directories, see RteFsUtils::WeaklyCanonical()
+static constexpr size_t MAX_CANONICAL_PATHS = 0x10000;
+static mutex s_canonicalPathMutex;
+static unordered_map<string, string> s_canonicalPaths;
+
+// path is absolute and lexically normal
+static string CanonicalPath(const fs::path& path)
+{
+  const string key = path.generic_string();
+  {
+    lock_guard<mutex> lock(s_canonicalPathMutex);
+    auto it = s_canonicalPaths.find(key);
+    if (it != s_canonicalPaths.end()) {
+      return it->second;
+    }
+  }
+  error_code ec;
+  const fs::file_status st = fs::symlink_status(path, ec);
+  const bool isSymlink = fs::is_symlink(st);
+  if (fs::is_directory(isSymlink ? fs::status(path, ec) : st) || !path.has_relative_path()) {
+    const string canonical = fs::canonical(path, ec).generic_string();
+    if (ec) {
+      return fs::weakly_canonical(path, ec).generic_string();
+    }
+    lock_guard<mutex> lock(s_canonicalPathMutex);
+    if (s_canonicalPaths.size() >= MAX_CANONICAL_PATHS) {
+      s_canonicalPaths.clear();
+    }
+    s_canonicalPaths[key] = canonical;
+    return canonical;
+  }
+  if (isSymlink) {
+    return fs::weakly_canonical(path, ec).generic_string();
+  }
+  // files and not existing paths: canonical parent directory and the name as given
+  return (fs::path(CanonicalPath(path.parent_path())) / path.filename()).generic_string();
+}
+
 string RteFsUtils::MakePathCanonical(const string& path)
 {
   error_code ec;
@@ -115,6 +156,39 @@ bool RteFsUtils::CmpFileMem(const string& fileName, const string& buffer) {
   return buffer == fileBuffer;
 }
 
+string RteFsUtils::GetFileHash(const string& fileName) {
+  string fileBuffer;
+  if (!ReadFile(fileName, fileBuffer)) {
+    return RteUtils::EMPTY_STRING;
+  }
+  return RteUtils::GetHash(fileBuffer);
+}
+
+bool RteFsUtils::CmpFiles(const string& fileName1, const string& fileName2) {
+  error_code ec1, ec2;
+  const auto size1 = fs::file_size(fileName1, ec1);
+  const auto size2 = fs::file_size(fileName2, ec2);
+  if (ec1 || ec2 || size1 != size2) {
+    return false;
+  }
+  ifstream file1(fileName1, ios::binary);
+  ifstream file2(fileName2, ios::binary);
+  if (!file1 || !file2) {
+    return false;
+  }
+  // compare chunks, the first difference ends the comparison
+  char buffer1[4096], buffer2[4096];
+  while (file1 && file2) {
+    file1.read(buffer1, sizeof(buffer1));
+    file2.read(buffer2, sizeof(buffer2));
+    const auto count = file1.gcount();
+    if (count != file2.gcount() || memcmp(buffer1, buffer2, static_cast<size_t>(count)) != 0) {
+      return false;
+    }
+  }
+  return file1.eof() && file2.eof();
+}
+
 bool RteFsUtils::ExpandFile(const string& fileName, int nInst, string& buffer) {
   // Open file and read content
   string fileBuffer;
@@ -571,12 +645,27 @@ string RteFsUtils::LexicallyNormal(const string& path) {
   return lexicallyNormal;
 }
 
+string RteFsUtils::WeaklyCanonical(const string& path) {
+  fs::path p(path);
+  // dot elements and redundant separators are left to the file system
+  if (!p.is_absolute() || !p.has_filename() || p.lexically_normal().generic_string() != p.generic_string()) {
+    error_code ec;
+    return fs::weakly_canonical(p, ec).generic_string();
+  }
+  return CanonicalPath(p);
+}
+
+void RteFsUtils::ClearCanonicalPathCache() {
+  lock_guard<mutex> lock(s_canonicalPathMutex);
+  s_canonicalPaths.clear();
+}
+
 string RteFsUtils::RelativePath(const string& path, const string& base, bool withHeadingDot) {
   if (path.empty() || base.empty()) {
     return "";
   }
-  error_code ec;
-  string relativePath = fs::relative(path, base, ec).generic_string();
+  // same as fs::relative() with cached canonical names
+  string relativePath = fs::path(WeaklyCanonical(path)).lexically_relative(WeaklyCanonical(base)).generic_string();
   if (withHeadingDot) {
     if (!relativePath.empty() && relativePath.find("./") != 0 && relativePath.find("../") != 0) {
       relativePath.insert(0, "./");
@@ -194,6 +194,24 @@ TEST_F(RteFsUtilsTest, CmpFileMem) {
   EXPECT_EQ(ret, false);
 }
 
+TEST_F(RteFsUtilsTest, GetFileHash) {
+  RteFsUtils::CreateFile(filenameRegular, bufferFoo);
+  const string hashFoo = RteFsUtils::GetFileHash(filenameRegular);
+  EXPECT_EQ(16U, hashFoo.size());
+  EXPECT_EQ(hashFoo, RteFsUtils::GetFileHash(filenameBackslash));
+
+  RteFsUtils::CreateFile(filenameRegular, bufferBar);
+  EXPECT_NE(hashFoo, RteFsUtils::GetFileHash(filenameRegular));
+
+  // FNV-1a offset basis for empty content
+  RteFsUtils::CreateFile(filenameRegular, "");
+  EXPECT_EQ("cbf29ce484222325", RteFsUtils::GetFileHash(filenameRegular));
+
+  EXPECT_TRUE(RteFsUtils::GetFileHash(pathInvalid).empty());
+  EXPECT_TRUE(RteFsUtils::GetFileHash("").empty());
+  RteFsUtils::RemoveFile(filenameRegular);
+}
+
 TEST_F(RteFsUtilsTest, CopyBufferToFile) {
   bool ret;
   error_code ec;
@@ -822,6 +840,36 @@ TEST_F(RteFsUtilsTest, SetTreeReadOnly) {
   RteFsUtils::RemoveDir(dirnameSubdir);
 }
 
+TEST_F(RteFsUtilsTest, CmpFiles) {
+  const string fileFoo = dirnameSubdir + "/foo.txt";
+  const string fileFoo2 = dirnameSubdir + "/foo2.txt";
+  const string fileBar = dirnameSubdir + "/bar.txt";
+  const string fileLonger = dirnameSubdir + "/longer.txt";
+  RteFsUtils::CreateFile(fileFoo, bufferFoo);
+  RteFsUtils::CreateFile(fileFoo2, bufferFoo);
+  RteFsUtils::CreateFile(fileBar, bufferBar);
+  RteFsUtils::CreateFile(fileLonger, bufferFoo + bufferBar);
+
+  EXPECT_TRUE(RteFsUtils::CmpFiles(fileFoo, fileFoo2));
+  EXPECT_FALSE(RteFsUtils::CmpFiles(fileFoo, fileBar));
+  EXPECT_FALSE(RteFsUtils::CmpFiles(fileFoo, fileLonger));
+  EXPECT_FALSE(RteFsUtils::CmpFiles(fileFoo, pathInvalid));
+  EXPECT_FALSE(RteFsUtils::CmpFiles(pathInvalid, pathInvalid));
+
+  // files larger than one chunk, same size and different last byte
+  const string fileLarge = dirnameSubdir + "/large.txt";
+  const string fileLarge2 = dirnameSubdir + "/large2.txt";
+  const string fileLarge3 = dirnameSubdir + "/large3.txt";
+  const string large(10000, 'x');
+  RteFsUtils::CreateFile(fileLarge, large);
+  RteFsUtils::CreateFile(fileLarge2, large);
+  RteFsUtils::CreateFile(fileLarge3, large.substr(0, large.size() - 1) + "y");
+  EXPECT_TRUE(RteFsUtils::CmpFiles(fileLarge, fileLarge2));
+  EXPECT_FALSE(RteFsUtils::CmpFiles(fileLarge, fileLarge3));
+
+  RteFsUtils::RemoveDir(dirnameSubdir);
+}
+
 TEST_F(RteFsUtilsTest, MakePathCanonical) {
   string ret;
   error_code ec;
@@ -933,6 +981,44 @@ TEST_F(RteFsUtilsTest, LexicallyNormal) {
   EXPECT_EQ(dirPath, dirnameSubdir);
 }
 
+TEST_F(RteFsUtilsTest, WeaklyCanonical) {
+  error_code ec;
+  RteFsUtils::CreateFile(filenameRegular, "foo");
+  const string absBase = fs::current_path(ec).append(dirnameBase).generic_string();
+  const string absLink = absBase + "/link";
+  fs::create_directory_symlink(absBase + "/dir", absLink, ec);
+  const bool hasLink = !ec;
+
+  vector<string> paths = {
+    absBase,
+    absBase + "/dir/subdir",
+    absBase + "/dir/subdir/file.txt",
+    absBase + "/dir/subdir/non/existing/file.txt",
+    absBase + "/dir/subdir/../subdir/file.txt",
+    absBase + "/dir/subdir/",
+    dirnameSubdir + "/file.txt",
+    "non/existing/file.txt",
+  };
+  if (hasLink) {
+    paths.push_back(absLink);
+    paths.push_back(absLink + "/subdir");
+    paths.push_back(absLink + "/subdir/file.txt");
+    paths.push_back(absLink + "/subdir/../subdir2");
+  }
+  // second pass uses cached directories
+  for (int pass = 0; pass < 2; pass++) {
+    for (const auto& path : paths) {
+      EXPECT_EQ(fs::weakly_canonical(path, ec).generic_string(), RteFsUtils::WeaklyCanonical(path)) << path;
+    }
+  }
+  if (hasLink) {
+    EXPECT_EQ(RteFsUtils::RelativePath(absLink + "/subdir/file.txt", absBase), "dir/subdir/file.txt");
+    fs::remove(absLink, ec);
+  }
+  RteFsUtils::ClearCanonicalPathCache();
+  RteFsUtils::RemoveDir(dirnameSubdir);
+}
+
 TEST_F(RteFsUtilsTest, RelativePath) {
   string relPath;
   string absSubdir = RteFsUtils::AbsolutePath(dirnameSubdir).generic_string();
@@ -40,6 +40,7 @@ static const unsigned int RTE_MB_ICONASTERISK    = 0x00000040;
 
 class RteKernel;
 class RteGenerator;
+class RteTarget;
 /**
  * @brief Class to allow RTE to call application or API functions, defaults do nothing
 */
@@ -121,6 +122,14 @@ public:
   */
   virtual std::string ExpandString(const std::string& str);
 
+  /**
+   * @brief expand command or file using key sequences "$P", "$D", etc. for the given target
+   * @param str string to expand
+   * @param target pointer to RteTarget the sequences are resolved for, kernel's active target if nullptr
+   * @return expanded string
+  */
+  virtual std::string ExpandString(const std::string& str, RteTarget* target);
+
   /**
    * @brief send message to the application main window by calling a function specific to OS
    * @param Msg message to send
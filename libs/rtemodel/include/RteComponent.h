@@ -188,6 +188,26 @@ public:
   */
    const std::string& GetVersionString() const override;
 
+  /**
+   * @brief get parsed component or API version, cached when the component ID is constructed
+   * @return SemVer of the version string
+  */
+   const SemVer& GetSemVer() const { return m_semVer; }
+
+  /**
+   * @brief get component ID
+   * @param withVersion true to append version
+   * @return component ID cached when the component ID is constructed
+  */
+   std::string GetComponentID(bool withVersion) const override;
+
+  /**
+   * @brief get component ID without copying it, cached when the component ID is constructed
+   * @param withVersion true to append version
+   * @return reference to cached component ID, see GetComponentID()
+  */
+   const std::string& GetCachedComponentID(bool withVersion) const { return m_componentID[withVersion ? 1 : 0]; }
+
   /**
    * @brief get component vendor string from this item or parent( bundle, component container or pack)
    * @return vendor string
@@ -241,10 +261,30 @@ protected:
   */
    std::string ConstructID() override;
 
+  /**
+   * @brief update cached component IDs and version after calls to SetAttributes(), AddAttributes() and ClearAttributes()
+  */
+   void ProcessAttributes() override;
+
+  /**
+   * @brief fill cached component IDs and parsed version, called from ConstructID() and ProcessAttributes()
+  */
+   void CacheComponentIDs();
+
   /**
    * @brief item corresponding <files> element
   */
   RteFileContainer* m_files;
+
+  /**
+   * @brief parsed version
+  */
+  SemVer m_semVer;
+
+  /**
+   * @brief component ID without and with version
+  */
+  std::string m_componentID[2];
 };
 
 /**
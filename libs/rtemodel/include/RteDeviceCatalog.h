@@ -0,0 +1,198 @@
+#ifndef RteDeviceCatalog_H
+#define RteDeviceCatalog_H
+/******************************************************************************/
+/* RTE - CMSIS Run-Time Environment */
+/******************************************************************************/
+/** @file RteDeviceCatalog.h
+* @brief CMSIS RTE Data Model
+*/
+/******************************************************************************/
+/*
+ * Copyright (c) 2023 Arm Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+/******************************************************************************/
+#include "RteDevice.h"
+
+#include <unordered_map>
+
+/**
+ * @brief flat vendor/family/subfamily/device/variant/processor hierarchy of all devices from a collection of packs.
+ *
+ * The catalog is built once for all packs of a global model and is shared by the filtered models.
+ * Nodes, device items and device names are stored in contiguous arrays referring to each other by index,
+ * a model selects its part of the catalog with a Visibility object filled by Filter().
+ * Families and device items are indexed per pack, Filter() only visits the entries of the given packs.
+ * The selection gives the same result as adding the device families of the model's packs to
+ * RteDeviceVendor and RteDeviceItemAggregate objects (see RteModel::FillDeviceTree()).
+*/
+class RteDeviceCatalog
+{
+public:
+  /**
+   * @brief invalid index
+  */
+  static constexpr uint32_t NONE = 0xFFFFFFFF;
+
+  /**
+   * @brief struct containing visibility flags of catalog entries for a collection of packs,
+   *        the lists of set flags allow to reset a selection without scanning the whole catalog
+  */
+  struct Visibility {
+    std::vector<bool> families; // families adding at least one unique device name
+    std::vector<bool> entries;  // device items of the tree
+    std::vector<bool> nodes;    // nodes containing visible device items
+    std::vector<bool> keys;     // unique device names
+    std::vector<uint32_t> familyList; // visible families in ascending order
+    std::vector<uint32_t> entryList;
+    std::vector<uint32_t> nodeList;
+    std::vector<uint32_t> keyList;
+
+    /**
+     * @brief reset all flags set by RteDeviceCatalog::Filter()
+    */
+    void Clear();
+  };
+
+  /**
+   * @brief constructor, builds the catalog
+   * @param packs collection of packs to build the catalog for, in the order of a package map
+  */
+  RteDeviceCatalog(const std::vector<RtePackage*>& packs);
+
+  /**
+   * @brief check if the catalog contains given pack
+   * @param pack pointer to RtePackage
+   * @return true if pack is part of the catalog
+  */
+  bool HasPackage(RtePackage* pack) const { return m_packIndex.find(pack) != m_packIndex.end(); }
+
+  /**
+   * @brief select catalog entries for a collection of packs
+   * @param packs collection of packs, at most one version of each pack
+   * @param visibility Visibility object to fill
+   * @return true if all packs are part of the catalog
+  */
+  bool Filter(const std::vector<RtePackage*>& packs, Visibility& visibility) const;
+
+  /**
+   * @brief get visible device families in the order they were added to the model
+   * @param visibility selection filled by Filter()
+   * @param families list of RteDeviceFamily pointers to fill
+  */
+  void GetFamilies(const Visibility& visibility, std::list<RteDeviceFamily*>& families) const;
+
+  /**
+   * @brief get device by name and vendor, see RteModel::GetDevice()
+   * @param visibility selection filled by Filter()
+   * @param deviceName device name, optionally with processor name suffix
+   * @param vendor vendor name, empty to search all vendors
+   * @param bSearchTree true to search the tree if no device has the name
+   * @return RteDevice pointer, nullptr if not found
+  */
+  RteDevice* GetDevice(const Visibility& visibility, const std::string& deviceName, const std::string& vendor, bool bSearchTree) const;
+
+  /**
+   * @brief collect devices of the tree matching a name pattern, see RteDeviceItemAggregate::GetDevices()
+   * @param visibility selection filled by Filter()
+   * @param devices list of RteDevice pointers to fill
+   * @param namePattern device name pattern, empty to collect all devices
+   * @param vendor vendor name, empty for all vendors
+   * @param depth tree depth to consider
+  */
+  void GetDevices(const Visibility& visibility, std::list<RteDevice*>& devices, const std::string& namePattern,
+                  const std::string& vendor, RteDeviceItem::TYPE depth) const;
+
+  /**
+   * @brief get number of unique device names
+   * @param visibility selection filled by Filter()
+   * @param vendor vendor name, empty for all vendors
+   * @return number of unique device names including names with processor suffix
+  */
+  size_t GetDeviceCount(const Visibility& visibility, const std::string& vendor) const;
+
+protected:
+  struct Node {
+    RteDeviceItem::TYPE type;
+    uint32_t name;       // index in m_names
+    uint32_t parent;
+    uint32_t firstChild; // range in m_children, sorted by name
+    uint32_t childCount;
+    uint32_t firstEntry; // range in m_entries
+    uint32_t entryCount;
+  };
+
+  struct Entry {
+    RteDeviceItem* item;
+    uint32_t node;
+    uint32_t parent;     // entry of the parent item, NONE for families
+    uint32_t family;
+    uint32_t pack;
+  };
+
+  struct Family {
+    RteDeviceFamily* family;
+    uint32_t pack;
+    uint32_t firstKey;   // range in m_familyKeys
+    uint32_t keyCount;
+    uint32_t firstEntry; // range in m_familyEntries
+    uint32_t entryCount;
+  };
+
+  struct Key {
+    uint32_t vendor;     // index in m_names
+    uint32_t name;       // index in m_names
+    uint32_t firstDevice; // range in m_keyDevices
+    uint32_t deviceCount;
+  };
+
+  struct KeyDevice {
+    RteDevice* device;
+    uint32_t family;
+  };
+
+  uint32_t InternName(const std::string& name);
+  void AddKey(uint32_t vendor, const std::string& name, RteDevice* device, uint32_t family);
+  void AddKeys(RteDeviceItem* item, uint32_t vendor, uint32_t family);
+  void AddEntry(uint32_t node, RteDeviceItem* item, uint32_t parentEntry, uint32_t family);
+  uint32_t EnsureChild(uint32_t node, const std::string& name, RteDeviceItem::TYPE type);
+  void Flatten();
+
+  const std::string& GetName(uint32_t node) const { return m_names[m_nodes[node].name]; }
+  uint32_t FindKey(uint32_t vendor, const std::string& name) const;
+  const std::vector<uint32_t>* FindKeys(const std::string& name) const;
+  uint32_t FindChild(const Visibility& visibility, uint32_t node, const std::string& name) const;
+  uint32_t FindVendorNode(const Visibility& visibility, const std::string& vendor) const;
+  uint32_t FindDeviceNode(const Visibility& visibility, uint32_t node, const std::string& deviceName) const;
+  RteDeviceItem* GetDeviceItem(const Visibility& visibility, uint32_t node) const;
+  RteDevice* GetKeyDevice(const Visibility& visibility, uint32_t key) const;
+  void CollectDevices(const Visibility& visibility, uint32_t node, std::list<RteDevice*>& devices,
+                      const std::string& namePattern, RteDeviceItem::TYPE depth) const;
+
+  std::vector<RtePackage*> m_packs; // non-deprecated packs first, then deprecated ones
+  uint32_t m_firstDeprecatedPack;
+  std::unordered_map<RtePackage*, uint32_t> m_packIndex;
+  std::vector<uint32_t> m_packFamilies; // first family of each pack, families are added pack by pack
+  std::vector<Family> m_families;
+  std::vector<uint32_t> m_familyKeys;
+  std::vector<uint32_t> m_familyEntries; // entries of each family in ascending order
+  std::vector<Node> m_nodes;        // m_nodes[0] is the vendor list, parents precede their children
+  std::vector<uint32_t> m_children;
+  std::vector<Entry> m_entries;     // grouped by node, in order of addition within a node
+  std::vector<Key> m_keys;
+  std::vector<KeyDevice> m_keyDevices;
+  std::unordered_map<uint64_t, uint32_t> m_keyIndex; // vendor and name index to key
+  std::unordered_map<uint32_t, std::vector<uint32_t> > m_keysByName; // name index to keys sorted by vendor name
+  std::vector<std::string> m_names;
+  std::unordered_map<std::string, uint32_t> m_nameIndex;
+
+  // temporary data used during construction
+  uint32_t m_entryCount;
+  std::vector<std::map<std::string, uint32_t, AlnumCmp::LenLessNoCase> > m_childMaps;
+  std::vector<std::vector<std::pair<uint32_t, Entry> > > m_nodeEntries; // entries with their order of addition
+  std::vector<std::vector<KeyDevice> > m_keyDeviceLists;
+  std::vector<std::vector<uint32_t> > m_familyEntryLists;
+};
+
+#endif // RteDeviceCatalog_H
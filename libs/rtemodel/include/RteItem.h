@@ -598,6 +598,14 @@ public:
   */
   virtual std::string ExpandString(const std::string& str) const;
 
+  /**
+   * @brief expands key sequences ("$P", "$D", etc.) in the supplied string for the given target.
+   * @param str string to expand
+   * @param target pointer to RteTarget the sequences are resolved for
+   * @return expanded string
+  */
+  std::string ExpandString(const std::string& str, RteTarget* target) const;
+
   /**
    * @brief get item's description
    * @return description of the item if exist,or empty string
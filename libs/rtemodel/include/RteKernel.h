@@ -214,6 +214,14 @@ public:
   */
   std::string GetLocalPdscFile(const XmlItem& attributes, const std::string& rtePath, std::string& packId);
 
+  /**
+   * @brief getter for pdsc files of all packs in the local repository index, each pdsc file is loaded once to get its version
+   * @param rtePath pack path
+   * @param pdscFiles map to fill with pack ID (vendor::name@version) to pdsc file
+   * @return true if local repository index does not exist or is parsed successfully
+  */
+  bool GetLocalPdscFiles(const std::string& rtePath, std::map<std::string, std::string>& pdscFiles);
+
   /**
    * @brief getter for pdsc file pointed by the pack 'path' attribute
    * @param attributes pack attributes
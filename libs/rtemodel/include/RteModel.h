@@ -18,13 +18,18 @@
 #include "RteComponent.h"
 #include "RteCondition.h"
 #include "RteDevice.h"
+#include "RteDeviceCatalog.h"
 #include "RtePackage.h"
+#include "RtePackageCatalog.h"
 #include "RteTarget.h"
 #include "RteInstance.h"
 #include "RteExample.h"
 #include "RteBoard.h"
 #include "RteGenerator.h"
 
+#include <memory>
+#include <mutex>
+
 class RteComponentGroup;
 class RteProject;
 
@@ -149,16 +154,23 @@ public:
   void SetPackageFilter(const RtePackageFilter& filter) { m_packageFilter = filter; }
 
   /**
-   * @brief getter for packages contained in this object
+   * @brief getter for packages contained in this object, a filtered model fills the map on first request
    * @return reference to RtePackageMap object
   */
-  const RtePackageMap& GetPackages() const { return m_packages; }
+  const RtePackageMap& GetPackages() const;
 
   /**
-   * @brief getter for packages with latest version
+   * @brief getter for packages with latest version, a filtered model fills the map on first request
    * @return reference to RtePackageMap object
   */
-  const RtePackageMap& GetLatestPackages() const { return m_latestPackages; }
+  const RtePackageMap& GetLatestPackages() const;
+
+  /**
+   * @brief collect packages contained in this object without filling maps
+   * @param packs vector of RtePackage pointers to fill in the order of GetPackages() or GetLatestPackages()
+   * @param bLatest true to collect only packages with latest version
+  */
+  void GetPackages(std::vector<RtePackage*>& packs, bool bLatest) const;
 
   /**
    * @brief getter for boards contained in this object
@@ -324,13 +336,19 @@ public:
    * @brief getter for number of components
    * @return number of components as integer
   */
-  size_t GetComponentCount() const { return m_componentList.size(); }
+  size_t GetComponentCount() const { return GetComponentList().size(); }
 
   /**
-   * @brief getter for collection of components
+   * @brief getter for collection of components, a filtered model fills the collection on first request
    * @return collection of component ID mapped to RteComponent pointer
   */
-  const RteComponentMap& GetComponentList() const { return m_componentList; }
+  const RteComponentMap& GetComponentList() const;
+
+  /**
+   * @brief collect components without filling the component collection
+   * @param components list of RteComponent pointers to fill, sorted by component ID
+  */
+  void GetComponents(std::list<RteComponent*>& components) const;
 
   /**
    * @brief getter for condition object determined by given package ID and condition ID
@@ -354,10 +372,28 @@ public:
    RteCondition* GetCondition() const override { return nullptr;}
 
   /**
-   * @brief getter for collection of device vendors
+   * @brief getter for device catalog shared with filtered models
+   * @return shared pointer to RteDeviceCatalog, empty if devices are not filled yet
+  */
+  const std::shared_ptr<RteDeviceCatalog>& GetDeviceCatalog() const { return m_deviceCatalog; }
+
+  /**
+   * @brief getter for package catalog shared with filtered models, created on first request
+   * @return shared pointer to RtePackageCatalog, empty for a filtered model
+  */
+  std::shared_ptr<RtePackageCatalog> GetPackageCatalog() const;
+
+  /**
+   * @brief check if this model is a view of the package catalog of a global model
+   * @return true if packs and components are selected from a catalog
+  */
+  bool IsPackageView() const { return m_bPackageView; }
+
+  /**
+   * @brief getter for collection of device vendors, created on first request
    * @return collection of vendor ID mapped to RteDeviceVendor pointer
   */
-  const std::map<std::string, RteDeviceVendor*>& GetDeviceVendors() const { return m_deviceVendors; }
+  const std::map<std::string, RteDeviceVendor*>& GetDeviceVendors() const;
 
   /**
    * @brief find vendor by given vendor ID
@@ -412,10 +448,10 @@ public:
   int GetDeviceCount(const std::string& vendor) const;
 
   /**
-   * @brief getter for device tree represented by a RteDeviceItemAggregate object
+   * @brief getter for device tree represented by a RteDeviceItemAggregate object, created on first request
    * @return RteDeviceItemAggregate pointer
   */
-  RteDeviceItemAggregate* GetDeviceTree() const { return m_deviceTree; }
+  RteDeviceItemAggregate* GetDeviceTree() const;
 
   /**
    * @brief find recursively a device aggregate given by device and vendor name
@@ -554,12 +590,15 @@ public:
 protected:
 
   void ClearDevices();
+  void EnsureDeviceItems() const;
+  void EnsurePackages() const;
+  RtePackage* FilterPackages(RteModel* globalModel, RtePackage* devicePackage);
 
   virtual void FillComponentList(RtePackage* devicePackage);
   virtual void AddItemsFromPack(RtePackage* pack); // adds taxonomy, components, csolution related items
 
   virtual void FillDeviceTree();
-  virtual void FillDeviceTree(RtePackage* pack);
+  virtual void FillBoards(RtePackage* pack);
 
   void AddPackItemsToList(const Collection<RteItem*>& srcCollection, Collection<RteItem*>& dstCollection);
 
@@ -573,21 +612,30 @@ protected:
 
   // components, APIs, taxonomy
   RteApiMap m_apiList; // collection of available APIs
-  RteComponentMap m_componentList; // full collection of unique components
+  mutable RteComponentMap m_componentList; // full collection of unique components, filled from catalog on request for a view
   std::map<std::string, RteItem*> m_taxonomy; // collection of standard Class descriptions
   RteBundleMap m_bundles; // collection of available bundles
 
   // device information
-  std::map<std::string, RteDeviceVendor*> m_deviceVendors;
-  RteDeviceItemAggregate* m_deviceTree;// vendor/family/subfamily/device/variant/processor
+  std::shared_ptr<RteDeviceCatalog> m_deviceCatalog; // built by global model, shared with filtered ones
+  RteDeviceCatalog::Visibility m_deviceVisibility; // catalog entries of this model
+  mutable std::map<std::string, RteDeviceVendor*> m_deviceVendors; // filled from catalog on request
+  RteDeviceItemAggregate* m_deviceTree;// vendor/family/subfamily/device/variant/processor, filled from catalog on request
   bool m_bUseDeviceTree; // flag is set to true by Pack Installer, uVision does not use RteDeviceItemAggregate items any more
+  mutable bool m_bDeviceItemsFilled; // m_deviceVendors and m_deviceTree are filled
+  mutable std::mutex m_deviceMutex;
 
   // boards
   RteBoardMap m_boards;
 
   // packs
-  RtePackageMap m_packages; // sorted package map (full id to package, latest versions first)
-  RtePackageMap m_latestPackages; // latests packages (common id to package)
+  mutable RtePackageMap m_packages; // sorted package map (full id to package, latest versions first)
+  mutable RtePackageMap m_latestPackages; // latests packages (common id to package)
+  mutable std::shared_ptr<RtePackageCatalog> m_packageCatalog; // built by global model, shared with filtered ones
+  RtePackageCatalog::Visibility m_packageVisibility; // catalog packs of a view
+  bool m_bPackageView; // packs and components are selected from m_packageCatalog, maps are filled on request
+  mutable bool m_bPackagesFilled; // m_packages, m_latestPackages and m_componentList of a view are filled
+  mutable std::mutex m_packageMutex;
   std::list<RtePackage*> m_packageDuplicates;
   RtePackageFilter m_packageFilter;
 
@@ -89,6 +89,12 @@ public:
   */
   const std::string& GetCommonID() const { return m_commonID; }
 
+  /**
+   * @brief get parsed pack version, cached when the pack ID is constructed
+   * @return SemVer of the pack version
+  */
+  const SemVer& GetSemVer() const { return m_semVer; }
+
   /**
    * @brief helper static method  to extract common ID from full pack ID by stripping version information
    * @param id full or common ID
@@ -664,6 +670,7 @@ private:
 
   std::set<std::string> m_keywords; // collected keyword
   std::string m_commonID; // common or 'family' pack ID
+  SemVer m_semVer; // parsed pack version
 };
 
 /**
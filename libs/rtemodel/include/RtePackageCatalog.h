@@ -0,0 +1,171 @@
+#ifndef RtePackageCatalog_H
+#define RtePackageCatalog_H
+/******************************************************************************/
+/* RTE - CMSIS Run-Time Environment */
+/******************************************************************************/
+/** @file RtePackageCatalog.h
+* @brief CMSIS RTE Data Model
+*/
+/******************************************************************************/
+/*
+ * Copyright (c) 2023 Arm Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+/******************************************************************************/
+#include "RtePackage.h"
+
+#include <unordered_map>
+
+/**
+ * @brief packs and unique components of a global model with dense indexes.
+ *
+ * The catalog is built once for all packs of a global model and is shared by the filtered models.
+ * A filtered model is a view of the catalog: a Visibility object filled by Filter() selects its packs,
+ * the components of the view are resolved on request.
+ * Components are indexed per pack, a view only visits the components of its own packs.
+ * The selection gives the same packs and components as copying them into the maps of the filtered model
+ * (see RteModel::FilterModel() and RteModel::FillComponentList()).
+*/
+class RtePackageCatalog
+{
+public:
+  /**
+   * @brief invalid index
+  */
+  static constexpr uint32_t NONE = 0xFFFFFFFF;
+
+  /**
+   * @brief struct containing visibility flags of catalog packs for a filtered model
+  */
+  struct Visibility {
+    std::vector<bool> packs;  // selected packs, registered with full ID
+    std::vector<bool> latest; // latest filtered version of each pack, registered with common ID if not selected
+    std::vector<uint32_t> packList;   // indexes of selected and latest packs in ascending order
+    std::vector<uint32_t> components; // indexes of components provided by visible packs in ascending order
+    uint32_t devicePack = NONE; // pack taking precedence for components
+  };
+
+  /**
+   * @brief constructor, builds the catalog
+   * @param packages sorted collection of packs to build the catalog for
+  */
+  RtePackageCatalog(const RtePackageMap& packages);
+
+  /**
+   * @brief check if the catalog contains given pack
+   * @param pack pointer to RtePackage
+   * @return true if pack is part of the catalog
+  */
+  bool HasPackage(RtePackage* pack) const { return m_packIndex.find(pack) != m_packIndex.end(); }
+
+  /**
+   * @brief getter for IDs of the latest pack versions in the catalog
+   * @return set of full pack IDs
+  */
+  const std::set<std::string>& GetLatestPackIds() const { return m_latestPackIds; }
+
+  /**
+   * @brief select packs passing a package filter
+   * @param filter RtePackageFilter with latest installed packs set to GetLatestPackIds()
+   * @param devicePackage pack providing the device, can be nullptr
+   * @param visibility Visibility object to fill
+   * @return effective device pack: the given one if it passes the filter, otherwise the latest filtered version of it
+  */
+  RtePackage* Filter(const RtePackageFilter& filter, RtePackage* devicePackage, Visibility& visibility) const;
+
+  /**
+   * @brief collect visible packs in the order of the filtered model's package map
+   * @param visibility selection filled by Filter()
+   * @param packs vector of RtePackage pointers to fill
+   * @param bLatest true to collect only the latest version of each pack
+  */
+  void GetPackages(const Visibility& visibility, std::vector<RtePackage*>& packs, bool bLatest) const;
+
+  /**
+   * @brief fill package maps of a filtered model
+   * @param visibility selection filled by Filter()
+   * @param packages RtePackageMap to fill with visible packs
+   * @param latestPackages RtePackageMap to fill with latest packs mapped to their common IDs
+  */
+  void GetPackages(const Visibility& visibility, RtePackageMap& packages, RtePackageMap& latestPackages) const;
+
+  /**
+   * @brief get visible pack, see RteModel::GetPackage()
+   * @param visibility selection filled by Filter()
+   * @param id full pack ID or common ID of a latest pack that is not selected
+   * @return RtePackage pointer, nullptr if not found
+  */
+  RtePackage* GetPackage(const Visibility& visibility, const std::string& id) const;
+
+  /**
+   * @brief get latest visible version of a pack, see RteModel::GetLatestPackage()
+   * @param visibility selection filled by Filter()
+   * @param id full or common pack ID
+   * @return RtePackage pointer, nullptr if not found
+  */
+  RtePackage* GetLatestPackage(const Visibility& visibility, const std::string& id) const;
+
+  /**
+   * @brief get number of unique component IDs in the catalog
+   * @return number of unique component IDs
+  */
+  size_t GetComponentCount() const { return m_componentIds.size(); }
+
+  /**
+   * @brief get component of a view by index
+   * @param visibility selection filled by Filter()
+   * @param index unique component index, components are sorted by ID, see Visibility::components
+   * @return RteComponent pointer, nullptr if no visible pack provides the component
+  */
+  RteComponent* GetComponent(const Visibility& visibility, size_t index) const;
+
+  /**
+   * @brief get component of a view by ID
+   * @param visibility selection filled by Filter()
+   * @param id unique component ID
+   * @return RteComponent pointer, nullptr if not found
+  */
+  RteComponent* GetComponent(const Visibility& visibility, const std::string& id) const;
+
+protected:
+  struct Package {
+    RtePackage* pack;
+    uint32_t group;    // index in m_groups
+    uint32_t rank;     // 1: dominating, 2: regular, 3: deprecated
+  };
+
+  struct Group {
+    std::string commonId;
+    uint32_t firstPack; // range in m_packs, latest version first
+    uint32_t packCount;
+  };
+
+  struct Candidate {
+    RteComponent* component;
+    uint32_t pack;
+  };
+
+  void CollectComponents(RteItem* item, uint32_t pack, std::vector<Candidate>& candidates) const;
+  uint32_t FindPackage(const std::string& id) const;
+  uint32_t FindGroup(const std::string& commonId) const;
+  uint32_t GetLatestPackage(const Visibility& visibility, uint32_t group) const;
+
+  std::vector<std::string> m_packIds; // keys of the global package map
+  std::vector<Package> m_packs;
+  std::unordered_map<RtePackage*, uint32_t> m_packIndex;
+  std::unordered_map<std::string, uint32_t> m_packIdIndex;
+  std::vector<Group> m_groups;
+  std::unordered_map<std::string, uint32_t> m_groupIndex;
+  std::vector<bool> m_latest; // latest version of each pack
+  std::set<std::string> m_latestPackIds;
+
+  std::vector<std::string> m_componentIds; // sorted
+  std::vector<uint32_t> m_componentFirst;  // range in m_candidates, m_componentIds.size() + 1 entries
+  std::vector<Candidate> m_candidates;     // grouped by component ID, in pack order
+  std::vector<uint32_t> m_packComponentFirst; // range in m_packComponents, m_packs.size() + 1 entries
+  std::vector<uint32_t> m_packComponents;  // unique component indexes provided by each pack, ascending
+  std::unordered_map<std::string, uint32_t> m_componentIndex;
+};
+
+#endif // RtePackageCatalog_H
@@ -878,6 +878,12 @@ public:
   */
   bool ShouldUpdateRte() const;
 
+  /**
+   * @brief set maximum number of threads updating config file backups and copying files
+   * @param maxThreads maximum number of threads, 0 for the number of hardware threads
+  */
+  static void SetMaxThreads(unsigned int maxThreads) { m_maxThreads = maxThreads; }
+
 protected:
   virtual RteTarget* CreateTarget(RteModel* filteredModel, const std::string& name, const std::map<std::string, std::string>& attributes);
   void AddTargetInfo(const std::string& targetName);
@@ -907,6 +913,10 @@ protected:
   bool UpdateFileInstance(RteFileInstance* fi, RteFile* f, bool bMerge, bool bUpdateComponent);
   void UpdateFileInstanceVersion(RteFileInstance* fi, const std::string& savedVersion);
   void UpdateConfigFileBackups(RteFileInstance* fi, RteFile* f);
+  // collects backup updates of config files instead of doing them
+  void WriteInstanceFiles(const std::string& targetName, std::map<RteFileInstance*, std::vector<RteFile*> >& backups);
+  // updates backups of different file instances concurrently
+  void UpdateConfigFileBackups(const std::map<RteFileInstance*, std::vector<RteFile*> >& backups);
 
   void CollectSettings(const std::string& targetName);
 
@@ -944,6 +954,8 @@ protected:
   std::string m_sActiveTarget;
   std::string m_rteFolder;
 
+  static unsigned int m_maxThreads;
+
 public:
   static const std::string DEFAULT_RTE_FOLDER;
 
@@ -65,32 +65,38 @@ void RteCallback::SetGlobal(RteCallback* callback)
 }
 
 string RteCallback::ExpandString(const string& str) {
+  return ExpandString(str, nullptr);
+}
 
-  const RteKernel* kernel = GetRteKernel();
-  if (!kernel) {
-    return RteUtils::EMPTY_STRING;
-  }
+string RteCallback::ExpandString(const string& str, RteTarget* target) {
 
-  const auto activeProject = kernel->GetActiveProject();
-  if (!activeProject) {
-    return RteUtils::EMPTY_STRING;
+  if (!target) {
+    const RteKernel* kernel = GetRteKernel();
+    if (!kernel) {
+      return RteUtils::EMPTY_STRING;
+    }
+    target = kernel->GetActiveTarget();
+    if (!target) {
+      return RteUtils::EMPTY_STRING;
+    }
   }
-  const auto activeTarget = kernel->GetActiveTarget();
-  if (!activeTarget) {
+
+  const auto project = target->GetProject();
+  if (!project) {
     return RteUtils::EMPTY_STRING;
   }
 
-  const string& prjPath(activeProject->GetProjectPath());
-  const string& prjPathFile(prjPath + activeProject->GetName() + ".cprj");
-  const string& packPath(activeTarget->GetDevicePackage()->GetAbsolutePackagePath());
-  const string& deviceName(activeTarget->GetDeviceName());
-  const string& generatorInputFile(activeTarget->GetGeneratorInputFile());
+  const string& prjPath(project->GetProjectPath());
+  const string& prjPathFile(prjPath + project->GetName() + ".cprj");
+  const string& packPath(target->GetDevicePackage()->GetAbsolutePackagePath());
+  const string& deviceName(target->GetDeviceName());
+  const string& generatorInputFile(target->GetGeneratorInputFile());
 
   if (prjPath.empty() || prjPathFile.empty() || packPath.empty() || deviceName.empty()) {
     return RteUtils::EMPTY_STRING;
   }
 
-  const string& boardName = activeTarget->GetAttribute("Bname");
+  const string& boardName = target->GetAttribute("Bname");
 
   string res(str);
   RteUtils::ReplaceAll(res, "$P", prjPath);
@@ -76,7 +76,7 @@ bool RteComponent::Dominates(RteComponent *that) const {
 
   // both dominate: return true if this component version newer than that one
   if (thisDominating && thatDominating) {
-    return (VersionCmp::Compare(GetVersionString(), that->GetVersionString()) > 0);
+    return m_semVer.Compare(that->GetSemVer()) > 0;
   }
 
   return false;
@@ -180,9 +180,34 @@ const string& RteComponent::GetCbundleName() const
 
 string RteComponent::ConstructID()
 {
+  CacheComponentIDs();
   return GetComponentUniqueID();
 };
 
+void RteComponent::ProcessAttributes()
+{
+  CacheComponentIDs();
+}
+
+void RteComponent::CacheComponentIDs()
+{
+  // IDs are computed once here: lookups by ID are frequent and may run concurrently
+  m_componentID[0].clear();
+  m_componentID[1].clear();
+  m_componentID[0] = GetComponentID(false);
+  m_componentID[1] = GetComponentID(true);
+  m_semVer = SemVer(GetVersionString());
+}
+
+string RteComponent::GetComponentID(bool withVersion) const
+{
+  const string& id = m_componentID[withVersion ? 1 : 0];
+  if (id.empty()) { // not constructed yet
+    return RteItem::GetComponentID(withVersion);
+  }
+  return id;
+}
+
 
 string RteComponent::GetDisplayName() const
 {
@@ -0,0 +1,530 @@
+/******************************************************************************/
+/* RTE - CMSIS Run-Time Environment */
+/******************************************************************************/
+/** @file RteDeviceCatalog.cpp
+* @brief CMSIS RTE Data model
+*/
+/******************************************************************************/
+/*
+ * Copyright (c) 2023 Arm Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+/******************************************************************************/
+#include "RteDeviceCatalog.h"
+
+#include "RtePackage.h"
+
+#include "DeviceVendor.h"
+#include "WildCards.h"
+
+#include <algorithm>
+
+using namespace std;
+
+RteDeviceCatalog::RteDeviceCatalog(const vector<RtePackage*>& packs) :
+  m_firstDeprecatedPack(0),
+  m_entryCount(0)
+{
+  // packs in the order RteModel adds them: non-deprecated first
+  m_packs.reserve(packs.size());
+  for (bool bDeprecated : { false, true }) {
+    if (bDeprecated) {
+      m_firstDeprecatedPack = (uint32_t)m_packs.size();
+    }
+    for (auto pack : packs) {
+      if (pack && pack->IsDeprecated() == bDeprecated) {
+        m_packIndex[pack] = (uint32_t)m_packs.size();
+        m_packs.push_back(pack);
+      }
+    }
+  }
+
+  m_nodes.push_back(Node{ RteDeviceItem::VENDOR_LIST, InternName("DeviceList"), NONE, 0, 0, 0, 0 });
+  m_childMaps.resize(1);
+  m_nodeEntries.resize(1);
+  m_packFamilies.reserve(m_packs.size() + 1);
+  for (uint32_t pack = 0; pack < m_packs.size(); pack++) {
+    m_packFamilies.push_back((uint32_t)m_families.size());
+    RteDeviceFamilyContainer* families = m_packs[pack]->GetDeviceFamiles();
+    if (!families) {
+      continue;
+    }
+    for (auto child : families->GetChildren()) {
+      RteDeviceFamily* fam = dynamic_cast<RteDeviceFamily*>(child);
+      if (!fam) {
+        continue;
+      }
+      const string vendorName = fam->GetVendorName();
+      if (vendorName.empty()) {
+        continue; // cannot be assigned to a vendor
+      }
+      uint32_t family = (uint32_t)m_families.size();
+      m_families.push_back(Family{ fam, pack, (uint32_t)m_familyKeys.size(), 0, 0, 0 });
+      AddKeys(fam, InternName(vendorName), family);
+      m_families[family].keyCount = (uint32_t)m_familyKeys.size() - m_families[family].firstKey;
+      AddEntry(0, fam, NONE, family);
+    }
+  }
+  m_packFamilies.push_back((uint32_t)m_families.size());
+  Flatten();
+}
+
+uint32_t RteDeviceCatalog::InternName(const string& name)
+{
+  auto it = m_nameIndex.find(name);
+  if (it != m_nameIndex.end()) {
+    return it->second;
+  }
+  uint32_t index = (uint32_t)m_names.size();
+  m_names.push_back(name);
+  m_nameIndex[name] = index;
+  return index;
+}
+
+void RteDeviceCatalog::AddKey(uint32_t vendor, const string& name, RteDevice* device, uint32_t family)
+{
+  uint32_t nameIndex = InternName(name);
+  uint64_t id = ((uint64_t)vendor << 32) | nameIndex;
+  auto it = m_keyIndex.find(id);
+  uint32_t key;
+  if (it != m_keyIndex.end()) {
+    key = it->second;
+  } else {
+    key = (uint32_t)m_keys.size();
+    m_keys.push_back(Key{ vendor, nameIndex, 0, 0 });
+    m_keyDeviceLists.emplace_back();
+    m_keyIndex[id] = key;
+    m_keysByName[nameIndex].push_back(key);
+  }
+  m_familyKeys.push_back(key);
+  m_keyDeviceLists[key].push_back(KeyDevice{ device, family });
+}
+
+// same names as RteDeviceVendor::AddDeviceItem() inserts
+void RteDeviceCatalog::AddKeys(RteDeviceItem* item, uint32_t vendor, uint32_t family)
+{
+  if (item->GetDeviceItemCount()) {
+    for (auto subItem : item->GetDeviceItems()) {
+      AddKeys(subItem, vendor, family);
+    }
+    return;
+  }
+  if (item->GetType() <= RteDeviceItem::SUBFAMILY) {
+    return;
+  }
+  RteDevice* d = dynamic_cast<RteDevice*>(item);
+  if (!d || d->GetName().empty()) {
+    return;
+  }
+  AddKey(vendor, d->GetName(), d, family);
+  if (d->GetProcessorCount() > 1) {
+    for (auto& [pname, processor] : d->GetProcessors()) {
+      AddKey(vendor, d->GetName() + ':' + pname, d, family);
+    }
+  }
+}
+
+// same hierarchy as RteDeviceItemAggregate::AddDeviceItem() creates, view dependent checks are done by Filter()
+void RteDeviceCatalog::AddEntry(uint32_t node, RteDeviceItem* item, uint32_t parentEntry, uint32_t family)
+{
+  RteDeviceItem::TYPE type = item->GetType();
+  RteDeviceItem::TYPE nodeType = m_nodes[node].type;
+  if (nodeType == type || nodeType == RteDeviceItem::PROCESSOR) {
+    if (!item->GetPackage()) {
+      return;
+    }
+    uint32_t entry = m_entryCount++;
+    m_nodeEntries[node].emplace_back(entry, Entry{ item, node, parentEntry, family, m_families[family].pack });
+    if (nodeType == RteDeviceItem::PROCESSOR) {
+      return;
+    }
+    if (item->GetDeviceItemCount()) {
+      for (auto subItem : item->GetDeviceItems()) {
+        AddEntry(node, subItem, entry, family);
+      }
+    } else if (type >= RteDeviceItem::DEVICE && item->GetProcessorCount() > 1) {
+      for (auto& [pname, processor] : item->GetProcessors()) {
+        AddEntry(EnsureChild(node, item->GetName() + ':' + pname, RteDeviceItem::PROCESSOR), item, entry, family);
+      }
+    }
+    return;
+  } else if (nodeType == RteDeviceItem::VENDOR_LIST) {
+    AddEntry(EnsureChild(node, item->GetVendorName(), RteDeviceItem::VENDOR), item, parentEntry, family);
+    return;
+  } else if (nodeType > type) {
+    return;
+  }
+  AddEntry(EnsureChild(node, item->GetName(), type), item, parentEntry, family);
+}
+
+uint32_t RteDeviceCatalog::EnsureChild(uint32_t node, const string& name, RteDeviceItem::TYPE type)
+{
+  auto it = m_childMaps[node].find(name);
+  if (it != m_childMaps[node].end()) {
+    return it->second;
+  }
+  uint32_t child = (uint32_t)m_nodes.size();
+  m_nodes.push_back(Node{ type, InternName(name), node, 0, 0, 0, 0 });
+  m_childMaps.emplace_back();
+  m_nodeEntries.emplace_back();
+  m_childMaps[node][name] = child;
+  return child;
+}
+
+void RteDeviceCatalog::Flatten()
+{
+  // children and entries are stored in node order: parent entries precede their child entries
+  m_children.reserve(m_nodes.size());
+  m_entries.reserve(m_entryCount);
+  vector<uint32_t> entryIndex(m_entryCount, NONE);
+  m_familyEntryLists.resize(m_families.size());
+  for (uint32_t n = 0; n < m_nodes.size(); n++) {
+    Node& node = m_nodes[n];
+    node.firstChild = (uint32_t)m_children.size();
+    for (auto& [name, child] : m_childMaps[n]) {
+      m_children.push_back(child);
+    }
+    node.childCount = (uint32_t)m_children.size() - node.firstChild;
+    node.firstEntry = (uint32_t)m_entries.size();
+    for (auto& [id, entry] : m_nodeEntries[n]) {
+      if (entry.parent != NONE) {
+        entry.parent = entryIndex[entry.parent];
+      }
+      entryIndex[id] = (uint32_t)m_entries.size();
+      m_familyEntryLists[entry.family].push_back(entryIndex[id]);
+      m_entries.push_back(entry);
+    }
+    node.entryCount = (uint32_t)m_entries.size() - node.firstEntry;
+  }
+  m_familyEntries.reserve(m_entries.size());
+  for (uint32_t f = 0; f < m_families.size(); f++) {
+    m_families[f].firstEntry = (uint32_t)m_familyEntries.size();
+    m_familyEntries.insert(m_familyEntries.end(), m_familyEntryLists[f].begin(), m_familyEntryLists[f].end());
+    m_families[f].entryCount = (uint32_t)m_familyEntryLists[f].size();
+  }
+
+  size_t keyDeviceCount = 0;
+  for (auto& keyDevices : m_keyDeviceLists) {
+    keyDeviceCount += keyDevices.size();
+  }
+  m_keyDevices.reserve(keyDeviceCount);
+  for (uint32_t k = 0; k < m_keys.size(); k++) {
+    m_keys[k].firstDevice = (uint32_t)m_keyDevices.size();
+    m_keyDevices.insert(m_keyDevices.end(), m_keyDeviceLists[k].begin(), m_keyDeviceLists[k].end());
+    m_keys[k].deviceCount = (uint32_t)m_keyDeviceLists[k].size();
+  }
+  for (auto& [name, keys] : m_keysByName) {
+    sort(keys.begin(), keys.end(), [this](uint32_t a, uint32_t b) {
+      return m_names[m_keys[a].vendor] < m_names[m_keys[b].vendor];
+    });
+  }
+
+  m_childMaps.clear();
+  m_childMaps.shrink_to_fit();
+  m_nodeEntries.clear();
+  m_nodeEntries.shrink_to_fit();
+  m_keyDeviceLists.clear();
+  m_keyDeviceLists.shrink_to_fit();
+  m_familyEntryLists.clear();
+  m_familyEntryLists.shrink_to_fit();
+}
+
+void RteDeviceCatalog::Visibility::Clear()
+{
+  for (auto [flags, indexes] : { make_pair(&families, &familyList), make_pair(&entries, &entryList),
+                                 make_pair(&nodes, &nodeList), make_pair(&keys, &keyList) }) {
+    for (uint32_t i : *indexes) {
+      (*flags)[i] = false;
+    }
+    indexes->clear();
+  }
+}
+
+bool RteDeviceCatalog::Filter(const vector<RtePackage*>& packs, Visibility& visibility) const
+{
+  // flags are allocated once, later selections only reset the flags set before
+  visibility.Clear();
+  if (visibility.families.size() != m_families.size() || visibility.entries.size() != m_entries.size() ||
+      visibility.nodes.size() != m_nodes.size() || visibility.keys.size() != m_keys.size()) {
+    visibility.families.assign(m_families.size(), false);
+    visibility.entries.assign(m_entries.size(), false);
+    visibility.nodes.assign(m_nodes.size(), false);
+    visibility.keys.assign(m_keys.size(), false);
+  }
+
+  bool bAllPacks = true;
+  vector<uint32_t> packIndexes;
+  packIndexes.reserve(packs.size());
+  for (auto pack : packs) {
+    auto it = m_packIndex.find(pack);
+    if (it != m_packIndex.end()) {
+      packIndexes.push_back(it->second);
+    } else if (pack) {
+      bAllPacks = false;
+    }
+  }
+  sort(packIndexes.begin(), packIndexes.end());
+  packIndexes.erase(unique(packIndexes.begin(), packIndexes.end()), packIndexes.end());
+
+  // a family is added if it provides at least one new device name for its vendor
+  vector<uint32_t> candidates;
+  for (uint32_t pack : packIndexes) {
+    for (uint32_t f = m_packFamilies[pack]; f < m_packFamilies[pack + 1]; f++) {
+      const Family& family = m_families[f];
+      bool bInserted = false;
+      for (uint32_t i = family.firstKey; i < family.firstKey + family.keyCount; i++) {
+        uint32_t key = m_familyKeys[i];
+        if (!visibility.keys[key]) {
+          visibility.keys[key] = true;
+          visibility.keyList.push_back(key);
+          bInserted = true;
+        }
+      }
+      if (bInserted) {
+        visibility.families[f] = true;
+        visibility.familyList.push_back(f);
+        candidates.insert(candidates.end(), m_familyEntries.begin() + family.firstEntry,
+                          m_familyEntries.begin() + family.firstEntry + family.entryCount);
+      }
+    }
+  }
+
+  // one item per pack and node, deprecated items only if a node has no other ones:
+  // parent entries precede their children and the entries of a node are ordered by pack
+  sort(candidates.begin(), candidates.end());
+  uint32_t node = NONE;
+  uint32_t lastPack = NONE; // pack of the last visible entry of the node
+  for (uint32_t e : candidates) {
+    const Entry& entry = m_entries[e];
+    if (entry.node != node) {
+      node = entry.node;
+      lastPack = NONE;
+    }
+    if (entry.parent != NONE && !visibility.entries[entry.parent]) {
+      continue;
+    }
+    if (entry.pack == lastPack || (entry.pack >= m_firstDeprecatedPack && lastPack < m_firstDeprecatedPack)) {
+      continue;
+    }
+    visibility.entries[e] = true;
+    visibility.entryList.push_back(e);
+    lastPack = entry.pack;
+    for (uint32_t n = node; n != NONE && !visibility.nodes[n]; n = m_nodes[n].parent) {
+      visibility.nodes[n] = true;
+      visibility.nodeList.push_back(n);
+    }
+  }
+  if (!visibility.nodes[0]) {
+    visibility.nodes[0] = true;
+    visibility.nodeList.push_back(0);
+  }
+  return bAllPacks;
+}
+
+void RteDeviceCatalog::GetFamilies(const Visibility& visibility, list<RteDeviceFamily*>& families) const
+{
+  for (uint32_t f : visibility.familyList) {
+    families.push_back(m_families[f].family);
+  }
+}
+
+uint32_t RteDeviceCatalog::FindKey(uint32_t vendor, const string& name) const
+{
+  auto itn = m_nameIndex.find(name);
+  if (itn == m_nameIndex.end()) {
+    return NONE;
+  }
+  auto it = m_keyIndex.find(((uint64_t)vendor << 32) | itn->second);
+  return it != m_keyIndex.end() ? it->second : NONE;
+}
+
+const vector<uint32_t>* RteDeviceCatalog::FindKeys(const string& name) const
+{
+  auto itn = m_nameIndex.find(name);
+  if (itn == m_nameIndex.end()) {
+    return nullptr;
+  }
+  auto it = m_keysByName.find(itn->second);
+  return it != m_keysByName.end() ? &it->second : nullptr;
+}
+
+RteDevice* RteDeviceCatalog::GetKeyDevice(const Visibility& visibility, uint32_t key) const
+{
+  if (key == NONE || !visibility.keys[key]) {
+    return nullptr;
+  }
+  // the first family providing the name has added it
+  const Key& k = m_keys[key];
+  for (uint32_t i = k.firstDevice; i < k.firstDevice + k.deviceCount; i++) {
+    if (visibility.families[m_keyDevices[i].family]) {
+      return m_keyDevices[i].device;
+    }
+  }
+  return nullptr;
+}
+
+RteDevice* RteDeviceCatalog::GetDevice(const Visibility& visibility, const string& deviceName, const string& vendor, bool bSearchTree) const
+{
+  // try without processor name if specified
+  bool bPrefix = deviceName.find(':') > 0;
+  const string deviceNamePrefix = bPrefix ? RteUtils::GetPrefix(deviceName) : RteUtils::EMPTY_STRING;
+  if (!vendor.empty()) {
+    auto itv = m_nameIndex.find(DeviceVendor::GetCanonicalVendorName(vendor));
+    if (itv != m_nameIndex.end()) {
+      RteDevice* d = GetKeyDevice(visibility, FindKey(itv->second, deviceName));
+      if (!d && bPrefix) {
+        d = GetKeyDevice(visibility, FindKey(itv->second, deviceNamePrefix));
+      }
+      if (d) {
+        return d;
+      }
+    }
+  } else {
+    // vendors are searched in alphabetical order, full name first
+    RteDevice* d = nullptr;
+    const string* foundVendor = nullptr;
+    for (const vector<uint32_t>* keys : { FindKeys(deviceName), bPrefix ? FindKeys(deviceNamePrefix) : nullptr }) {
+      if (!keys) {
+        continue;
+      }
+      for (uint32_t key : *keys) {
+        const string& keyVendor = m_names[m_keys[key].vendor];
+        if (foundVendor && !(keyVendor < *foundVendor)) {
+          break;
+        }
+        RteDevice* keyDevice = GetKeyDevice(visibility, key);
+        if (keyDevice) {
+          d = keyDevice;
+          foundVendor = &keyVendor;
+          break;
+        }
+      }
+    }
+    if (d) {
+      return d;
+    }
+  }
+  if (!bSearchTree) {
+    return nullptr;
+  }
+
+  uint32_t node = 0;
+  if (!vendor.empty()) {
+    node = FindVendorNode(visibility, vendor);
+  }
+  if (node != NONE) {
+    node = FindDeviceNode(visibility, node, deviceName);
+  }
+  return node != NONE ? dynamic_cast<RteDevice*>(GetDeviceItem(visibility, node)) : nullptr;
+}
+
+uint32_t RteDeviceCatalog::FindChild(const Visibility& visibility, uint32_t node, const string& name) const
+{
+  const Node& n = m_nodes[node];
+  auto first = m_children.begin() + n.firstChild;
+  auto last = first + n.childCount;
+  AlnumCmp::LenLessNoCase less;
+  auto it = lower_bound(first, last, name, [this, &less](uint32_t child, const string& value) {
+    return less(GetName(child), value);
+  });
+  if (it != last && !less(name, GetName(*it)) && visibility.nodes[*it]) {
+    return *it;
+  }
+  return NONE;
+}
+
+uint32_t RteDeviceCatalog::FindVendorNode(const Visibility& visibility, const string& vendor) const
+{
+  return FindChild(visibility, 0, DeviceVendor::GetCanonicalVendorName(vendor));
+}
+
+// same search as RteDeviceItemAggregate::GetDeviceAggregate()
+uint32_t RteDeviceCatalog::FindDeviceNode(const Visibility& visibility, uint32_t node, const string& deviceName) const
+{
+  uint32_t child = FindChild(visibility, node, deviceName);
+  if (child != NONE && m_nodes[child].type > RteDeviceItem::SUBFAMILY) {
+    return child;
+  }
+  const Node& n = m_nodes[node];
+  for (uint32_t i = n.firstChild; i < n.firstChild + n.childCount; i++) {
+    if (!visibility.nodes[m_children[i]]) {
+      continue;
+    }
+    child = FindDeviceNode(visibility, m_children[i], deviceName);
+    if (child != NONE) {
+      return child;
+    }
+  }
+  return NONE;
+}
+
+// same selection as RteDeviceItemAggregate::GetDeviceItem()
+RteDeviceItem* RteDeviceCatalog::GetDeviceItem(const Visibility& visibility, uint32_t node) const
+{
+  RteDeviceItem* first = nullptr;
+  const Node& n = m_nodes[node];
+  for (uint32_t e = n.firstEntry; e < n.firstEntry + n.entryCount; e++) {
+    if (!visibility.entries[e]) {
+      continue;
+    }
+    RteDeviceItem* item = m_entries[e].item;
+    if (item->GetPackageState() == PackageState::PS_INSTALLED || item->GetPackageState() == PackageState::PS_GENERATED) {
+      return item;
+    }
+    if (!first) {
+      first = item;
+    }
+  }
+  return first;
+}
+
+void RteDeviceCatalog::GetDevices(const Visibility& visibility, list<RteDevice*>& devices, const string& namePattern,
+                                  const string& vendor, RteDeviceItem::TYPE depth) const
+{
+  if (vendor.empty()) {
+    CollectDevices(visibility, 0, devices, namePattern, depth);
+    return;
+  }
+  uint32_t node = FindVendorNode(visibility, vendor);
+  if (node != NONE) {
+    CollectDevices(visibility, node, devices, namePattern, depth);
+  }
+}
+
+// same traversal as RteDeviceItemAggregate::GetDevices()
+void RteDeviceCatalog::CollectDevices(const Visibility& visibility, uint32_t node, list<RteDevice*>& devices,
+                                      const string& namePattern, RteDeviceItem::TYPE depth) const
+{
+  const Node& n = m_nodes[node];
+  if (n.type > depth) {
+    return;
+  }
+  if (n.type > RteDeviceItem::SUBFAMILY) {
+    RteDevice* d = dynamic_cast<RteDevice*>(GetDeviceItem(visibility, node));
+    if (d && (namePattern.empty() || WildCards::Match(namePattern, d->GetName()))) {
+      devices.push_back(d);
+    }
+  }
+  for (uint32_t i = n.firstChild; i < n.firstChild + n.childCount; i++) {
+    if (visibility.nodes[m_children[i]]) {
+      CollectDevices(visibility, m_children[i], devices, namePattern, depth);
+    }
+  }
+}
+
+size_t RteDeviceCatalog::GetDeviceCount(const Visibility& visibility, const string& vendor) const
+{
+  if (vendor.empty()) {
+    return visibility.keyList.size();
+  }
+  size_t count = 0;
+  for (uint32_t k : visibility.keyList) {
+    if (m_names[m_keys[k].vendor] == vendor) {
+      count++;
+    }
+  }
+  return count;
+}
+
+// End of RteDeviceCatalog.cpp
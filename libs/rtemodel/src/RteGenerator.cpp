@@ -128,7 +128,7 @@ string RteGenerator::GetExecutable(RteTarget* target, const std::string& hostTyp
   if (cmd.find("http:") == 0 || cmd.find("https:") == 0) // a URL?
     return EMPTY_STRING; // return empty string here , GetExpandedWebLine() will return URL then
 
-  cmd = ExpandString(cmd);
+  cmd = ExpandString(cmd, target);
   fs::path path(cmd);
 
   if (target && path.is_relative()) {
@@ -150,7 +150,7 @@ vector<pair<string, string> > RteGenerator::GetExpandedArguments(RteTarget* targ
         continue;
       if (!dryRun && arg->GetAttribute("mode") == "dry-run")
         continue;
-      args.push_back({arg->GetAttribute("switch"), ExpandString(arg->GetText())});
+      args.push_back({arg->GetAttribute("switch"), ExpandString(arg->GetText(), target)});
     }
   }
   return args;
@@ -194,7 +194,7 @@ string RteGenerator::GetExpandedWebLine(RteTarget* target) const
         url += key;
         url += "=";
       }
-      string value = ExpandString(arg->GetText());
+      string value = ExpandString(arg->GetText(), target);
       url += value;
       delimiter = '&'; // delimiter between arguments
     }
@@ -209,7 +209,7 @@ string RteGenerator::GetExpandedGpdsc(RteTarget* target, const string& genDir) c
   if (gpdsc.empty()) {
     gpdsc = target->GetProject()->GetName() + ".gpdsc";
   } else {
-    gpdsc = ExpandString(gpdsc);
+    gpdsc = ExpandString(gpdsc, target);
   }
 
   if (!genDir.empty() && fs::path(gpdsc).is_absolute()) {
@@ -226,7 +226,7 @@ string RteGenerator::GetExpandedGpdsc(RteTarget* target, const string& genDir) c
 
 string RteGenerator::GetExpandedWorkingDir(RteTarget* target, const string& genDir) const
 {
-  string wd = genDir.empty() ? ExpandString(GetWorkingDir()) : genDir;
+  string wd = genDir.empty() ? ExpandString(GetWorkingDir(), target) : genDir;
   fs::path path(wd);
   if (wd.empty() || path.is_relative()) {
     // use project directory
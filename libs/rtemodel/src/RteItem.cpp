@@ -843,6 +843,17 @@ string RteItem::ExpandString(const string& str) const
   return str;
 }
 
+string RteItem::ExpandString(const string& str, RteTarget* target) const
+{
+  if (str.empty())
+    return str;
+
+  RteCallback* pCallback = GetCallback();
+  if (pCallback)
+    return pCallback->ExpandString(str, target);
+  return str;
+}
+
 string RteItem::GetDownloadUrl(bool withVersion, const char* extension) const
 {
   string url = EMPTY_STRING;
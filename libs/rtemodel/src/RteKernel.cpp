@@ -20,6 +20,7 @@
 
 #include "RteUtils.h"
 #include "RteFsUtils.h"
+#include "RteTrace.h"
 #include "XmlFormatter.h"
 
 using namespace std;
@@ -241,6 +242,7 @@ RtePackage* RteKernel::LoadPack(const string& pdscFile, PackageState packState)
   if(pdscFile.empty()) {
     return nullptr;
   }
+  RteTraceScope trace("rte", "LoadPack");
   RteItemBuilder rteItemBuilder(GetGlobalModel(), packState);
   unique_ptr<XMLTree> xmlTree = CreateUniqueXmlTree(&rteItemBuilder);
   bool success = xmlTree->AddFileName(pdscFile, true);
@@ -256,6 +258,8 @@ RtePackage* RteKernel::LoadPack(const string& pdscFile, PackageState packState)
 bool RteKernel::LoadPacks(const std::list<std::string>& pdscFiles, std::list<RtePackage*>& packs) const
 {
   if (!pdscFiles.empty()) {
+    RteTraceScope trace("rte", "LoadPacks");
+    trace.AddArg("files", pdscFiles.size());
     RteItemBuilder rteItemBuilder(GetGlobalModel(), GetGlobalModel()->GetPackageState());
     unique_ptr<XMLTree> xmlTree = CreateUniqueXmlTree(&rteItemBuilder);
     bool success = xmlTree->SetFileNames(pdscFiles, true);
@@ -353,8 +357,10 @@ bool RteKernel::LoadAndInsertPacks(std::list<RtePackage*>& packs, std::list<std:
   if (!globalModel) {
     return false;
   }
+  RteTraceScope trace("rte", "LoadAndInsertPacks");
   std::list<RtePackage*> newPacks;
   pdscFiles.unique();
+  trace.AddArg("files", pdscFiles.size());
   for (const auto& pdscFile : pdscFiles) {
     RtePackage* pack = LoadPack(pdscFile);
     if (!pack) {
@@ -437,6 +443,29 @@ string RteKernel::GetLocalPdscFile(const XmlItem& attributes, const string& rteP
   return RteUtils::EMPTY_STRING;
 }
 
+bool RteKernel::GetLocalPdscFiles(const string& rtePath, map<string, string>& pdscFiles)
+{
+  unique_ptr<XMLTree> xmlTree = CreateUniqueXmlTree(nullptr);
+  Collection<XMLTreeElement*> indexList;
+  if (!GetLocalPacks(rtePath, xmlTree, indexList)) {
+    return false;
+  }
+  for (const auto& item : indexList) {
+    const string& name = item->GetAttribute("name");
+    const string& vendor = item->GetAttribute("vendor");
+    // Load the local pack to get its version. The 'version' attribute in the local repository index is ignored.
+    list<string> localPdscFiles;
+    RteFsUtils::GetPackageDescriptionFiles(localPdscFiles, RteFsUtils::GetAbsPathFromLocalUrl(item->GetAttribute("url")), 1);
+    for (const auto& localPdscFile : localPdscFiles) {
+      unique_ptr<RtePackage> pack(LoadPack(localPdscFile));
+      if (pack) {
+        pdscFiles[RtePackage::ComposePackageID(vendor, name, pack->GetVersionString())] = localPdscFile;
+      }
+    }
+  }
+  return true;
+}
+
 string RteKernel::GetPdscFileFromPath(const XmlItem& attributes, const string& cprjPath, string& packId)
 {
   const string& name = attributes.GetAttribute("name");
@@ -20,6 +20,7 @@
 
 #include "RteFsUtils.h"
 #include "RteConstants.h"
+#include "RteTrace.h"
 
 #include "XMLTree.h"
 
@@ -32,6 +33,9 @@ RteModel::RteModel(RteItem* parent, PackageState packageState) :
   m_callback(NULL),
   m_apiList(VersionCmp::Greater(RteConstants::PREFIX_CVERSION_CHAR)),
   m_bUseDeviceTree(true),
+  m_bDeviceItemsFilled(false),
+  m_bPackageView(false),
+  m_bPackagesFilled(false),
   m_filterContext(NULL)
 {
   m_deviceTree = new RteDeviceItemAggregate("DeviceList", RteDeviceItem::VENDOR_LIST, NULL);
@@ -44,6 +48,9 @@ RteModel::RteModel(PackageState packageState) :
   m_packageState(packageState),
   m_callback(NULL),
   m_bUseDeviceTree(false),
+  m_bDeviceItemsFilled(false),
+  m_bPackageView(false),
+  m_bPackagesFilled(false),
   m_filterContext(NULL)
 {
   m_deviceTree = new RteDeviceItemAggregate("DeviceList", RteDeviceItem::VENDOR_LIST, NULL);
@@ -65,6 +72,7 @@ void RteModel::Clear()
 void RteModel::ClearModel()
 {
   ClearDevices();
+  m_deviceCatalog.reset();
 
   m_componentList.clear();
   m_apiList.clear();
@@ -83,6 +91,10 @@ void RteModel::ClearModel()
   m_packageDuplicates.clear();
   m_packages.clear();
   m_latestPackages.clear();
+  m_packageCatalog.reset();
+  m_packageVisibility = RtePackageCatalog::Visibility();
+  m_bPackageView = false;
+  m_bPackagesFilled = false;
 
   RteItem::Clear();
 }
@@ -94,6 +106,8 @@ void RteModel::ClearDevices()
   }
   m_deviceVendors.clear();
   m_deviceTree->Clear();
+  m_bDeviceItemsFilled = false;
+  m_deviceVisibility.Clear();
   m_boards.clear();
 }
 
@@ -110,6 +124,9 @@ void RteModel::SetCallback(RteCallback* callback)
 
 RtePackage* RteModel::GetPackage(const string& id) const
 {
+  if (IsPackageView()) {
+    return m_packageCatalog->GetPackage(m_packageVisibility, id);
+  }
   auto it = m_packages.find(id);
   if (it != m_packages.end())
     return it->second;
@@ -119,6 +136,9 @@ RtePackage* RteModel::GetPackage(const string& id) const
 
 RtePackage* RteModel::GetLatestPackage(const string& id) const
 {
+  if (IsPackageView()) {
+    return m_packageCatalog->GetLatestPackage(m_packageVisibility, id);
+  }
   auto it = m_latestPackages.find(RtePackage::CommonIdFromId(id));
   if (it != m_latestPackages.end())
     return it->second;
@@ -154,16 +174,72 @@ RtePackage* RteModel::GetPackage(const XmlItem& attr) const
   if (VersionCmp::RangeCompare(pack->GetVersionString(), versionRange) == 0)
     return pack; // the latest matches the range
 
-  for (auto itp = m_packages.begin(); itp != m_packages.end(); itp++) {
-    pack = itp->second;
-    if (pack->GetPackageID(false) != commonId)
+  vector<RtePackage*> packs;
+  GetPackages(packs, false);
+  for (auto p : packs) {
+    if (p->GetPackageID(false) != commonId)
       continue;
-    if (VersionCmp::RangeCompare(pack->GetVersionString(), versionRange) == 0)
-      return pack; // the latest matches the range
+    if (VersionCmp::RangeCompare(p->GetVersionString(), versionRange) == 0)
+      return p; // the latest matches the range
   }
   return NULL;
 }
 
+const RtePackageMap& RteModel::GetPackages() const
+{
+  EnsurePackages();
+  return m_packages;
+}
+
+const RtePackageMap& RteModel::GetLatestPackages() const
+{
+  EnsurePackages();
+  return m_latestPackages;
+}
+
+void RteModel::GetPackages(vector<RtePackage*>& packs, bool bLatest) const
+{
+  if (IsPackageView()) {
+    m_packageCatalog->GetPackages(m_packageVisibility, packs, bLatest);
+    return;
+  }
+  const RtePackageMap& packages = bLatest ? m_latestPackages : m_packages;
+  packs.reserve(packs.size() + packages.size());
+  for (auto& [id, pack] : packages) {
+    packs.push_back(pack);
+  }
+}
+
+shared_ptr<RtePackageCatalog> RteModel::GetPackageCatalog() const
+{
+  if (IsPackageView()) {
+    return nullptr; // a view covers only a part of its catalog
+  }
+  lock_guard<mutex> lock(m_packageMutex);
+  if (!m_packageCatalog) {
+    m_packageCatalog = make_shared<RtePackageCatalog>(m_packages);
+  }
+  return m_packageCatalog;
+}
+
+// package maps and component list of a view are only needed by clients iterating them
+void RteModel::EnsurePackages() const
+{
+  if (!IsPackageView())
+    return;
+  lock_guard<mutex> lock(m_packageMutex);
+  if (m_bPackagesFilled)
+    return;
+  m_bPackagesFilled = true;
+  m_packageCatalog->GetPackages(m_packageVisibility, m_packages, m_latestPackages);
+  for (uint32_t i : m_packageVisibility.components) {
+    RteComponent* c = m_packageCatalog->GetComponent(m_packageVisibility, i);
+    if (c) {
+      m_componentList.emplace_hint(m_componentList.end(), c->GetID(), c);
+    }
+  }
+}
+
 RteBoard* RteModel::FindBoard(const string& displayName) const
 {
   const RteBoardMap& availableBoards = GetBoards();
@@ -212,7 +288,9 @@ RteComponent* RteModel::FindComponents(const RteItem& item, std::list<RteCompone
     RtePackage* pack = GetAvailablePackage(packId);
     return pack ? pack->FindComponents(item, components) : nullptr;
   }
-  for (auto [key, pack] : m_packages) {
+  vector<RtePackage*> packs;
+  GetPackages(packs, false);
+  for (auto pack : packs) {
     pack->FindComponents(item, components);
   }
   return components.empty()? nullptr : *(components.begin());
@@ -233,6 +311,9 @@ RteComponent* RteModel::GetComponent(const string& uniqueID) const
   }
 
   // look in the components
+  if (IsPackageView()) {
+    return m_packageCatalog->GetComponent(m_packageVisibility, uniqueID);
+  }
   RteComponentMap::const_iterator itc = m_componentList.find(uniqueID);
   if (itc != m_componentList.end()) {
     return itc->second;
@@ -243,14 +324,45 @@ RteComponent* RteModel::GetComponent(const string& uniqueID) const
 RteComponent* RteModel::FindComponent(const std::string& id) const
 {
   bool withVersion = id.find(RteConstants::PREFIX_CVERSION_CHAR) != string::npos;
+  if (IsPackageView()) {
+    for (uint32_t i : m_packageVisibility.components) {
+      RteComponent* c = m_packageCatalog->GetComponent(m_packageVisibility, i);
+      if (c && c->GetCachedComponentID(withVersion) == id) {
+        return c;
+      }
+    }
+    return nullptr;
+  }
   for (auto [_, c] : m_componentList) {
-    if (c->GetComponentID(withVersion) == id) {
+    if (c->GetCachedComponentID(withVersion) == id) {
       return c;
     }
   }
   return nullptr;
 }
 
+const RteComponentMap& RteModel::GetComponentList() const
+{
+  EnsurePackages();
+  return m_componentList;
+}
+
+void RteModel::GetComponents(list<RteComponent*>& components) const
+{
+  if (!IsPackageView()) {
+    for (auto [_, c] : m_componentList) {
+      components.push_back(c);
+    }
+    return;
+  }
+  for (uint32_t i : m_packageVisibility.components) {
+    RteComponent* c = m_packageCatalog->GetComponent(m_packageVisibility, i);
+    if (c) {
+      components.push_back(c);
+    }
+  }
+}
+
 RteComponent* RteModel::GetComponent(RteComponentInstance* ci, bool matchVersion) const
 {
   if (ci->IsApi() || matchVersion) {
@@ -370,10 +482,14 @@ void RteModel::Construct()
 
 void RteModel::InsertPacks(const list<RtePackage*>& packs)
 {
+  RteTraceScope trace("rte", "InsertPacks");
+  trace.AddArg("packs", packs.size());
   for (auto it = packs.begin(); it != packs.end(); it++) {
     InsertPack(dynamic_cast<RtePackage*>(*it));
   }
+  m_packageCatalog.reset(); // packs have changed
   FillComponentList(nullptr); // no device package yet
+  m_deviceCatalog.reset();
   FillDeviceTree();
 }
 
@@ -409,7 +525,7 @@ void RteModel::InsertPack(RtePackage* package)
   // add to latest package map
   const string& commonId = package->GetCommonID();
   RtePackage* p = GetLatestPackage(commonId);
-  if (!p || p == insertedPack || VersionCmp::Compare(package->GetVersionString(), p->GetVersionString()) > 0) {
+  if (!p || p == insertedPack || package->GetSemVer().Compare(p->GetSemVer()) > 0) {
     m_latestPackages[commonId] = package;
   }
   if (insertedPack) {
@@ -422,6 +538,7 @@ void RteModel::InsertPack(RtePackage* package)
 
 bool RteModel::Validate()
 {
+  RteTraceScope trace("rte", "Validate");
   m_bValid = RteItem::Validate();
   if (!m_errors.empty())
     m_bValid = false;
@@ -448,6 +565,25 @@ RtePackage* RteModel::FilterModel(RteModel* globalModel, RtePackage* devicePacka
 {
   Clear();
 
+  // packs are selected from the catalog of the global model, own maps are filled if not available
+  m_packageCatalog = globalModel->GetPackageCatalog();
+  if (m_packageCatalog && (!devicePackage || m_packageCatalog->HasPackage(devicePackage))) {
+    m_bPackageView = true;
+    m_packageFilter.SetLatestInstalledPacks(m_packageCatalog->GetLatestPackIds()); // filter requires global latests
+    devicePackage = m_packageCatalog->Filter(m_packageFilter, devicePackage, m_packageVisibility);
+  } else {
+    m_packageCatalog.reset();
+    devicePackage = FilterPackages(globalModel, devicePackage);
+  }
+
+  FillComponentList(devicePackage);
+  m_deviceCatalog = globalModel->GetDeviceCatalog();
+  FillDeviceTree();
+  return devicePackage; // now effective
+}
+
+RtePackage* RteModel::FilterPackages(RteModel* globalModel, RtePackage* devicePackage)
+{
   // first add all latest packs
   set<string> latestPackIds;
   const RtePackageMap& latestPackages = globalModel->GetLatestPackages();
@@ -470,7 +606,7 @@ RtePackage* RteModel::FilterModel(RteModel* globalModel, RtePackage* devicePacka
     }
     const string& commonId = pack->GetCommonID();
     RtePackage* p = GetLatestPackage(commonId);
-    if (!p || VersionCmp::Compare(pack->GetVersionString(), p->GetVersionString()) > 0) {
+    if (!p || pack->GetSemVer().Compare(p->GetSemVer()) > 0) {
       m_latestPackages[commonId] = pack;
     }
   }
@@ -486,10 +622,7 @@ RtePackage* RteModel::FilterModel(RteModel* globalModel, RtePackage* devicePacka
     if (m_packages.find(id) == m_packages.end())
       m_packages[itp->first] = pack;
   }
-
-  FillComponentList(devicePackage);
-  FillDeviceTree();
-  return devicePackage; // now effective
+  return devicePackage;
 }
 
 void RteModel::AddItemsFromPack(RtePackage* pack)
@@ -514,7 +647,24 @@ void RteModel::AddItemsFromPack(RtePackage* pack)
   AddPackItemsToList(pack->GetSolutionDescriptors(), m_solutionDescriptors);
 
   // fill api and component list
-  pack->InsertInModel(this);
+  if (!IsPackageView()) {
+    pack->InsertInModel(this);
+    return;
+  }
+  // components of a view are selected from the catalog, only bundles and APIs are inserted
+  RteItem* components = pack->GetComponents();
+  if (components) {
+    for (auto child : components->GetChildren()) {
+      RteBundle* b = dynamic_cast<RteBundle*>(child);
+      if (b) {
+        InsertBundle(b);
+      }
+    }
+  }
+  RteItem* apis = pack->GetApis();
+  if (apis) {
+    apis->InsertInModel(this);
+  }
 }
 
 void RteModel::AddPackItemsToList(const Collection<RteItem*>& srcCollection, Collection<RteItem*>& dstCollection)
@@ -548,23 +698,23 @@ void RteModel::FillComponentList(RtePackage* devicePackage)
     AddItemsFromPack(devicePackage);
   }
 
+  vector<RtePackage*> packs;
+  GetPackages(packs, false);
+
   // evaluate dominate packages first
-  RtePackageMap::iterator itp;
-  for (itp = m_packages.begin(); itp != m_packages.end(); itp++) {
-    RtePackage* package = itp->second;
+  for (auto package : packs) {
     if (package == devicePackage)
       continue;
     if (package->IsDeprecated())
       continue;
     if (package->IsDominating()) {
-      AddItemsFromPack(itp->second);
+      AddItemsFromPack(package);
     }
   }
 
   // evaluated sorted collection, deprecated packs in the second run
   bool bHasDeprecated = false;
-  for (itp = m_packages.begin(); itp != m_packages.end(); itp++) {
-    RtePackage* package = itp->second;
+  for (auto package : packs) {
     if (package->IsDeprecated()) {
       bHasDeprecated = true;
       continue;
@@ -577,8 +727,7 @@ void RteModel::FillComponentList(RtePackage* devicePackage)
   }
   if (!bHasDeprecated)
     return;
-  for (itp = m_packages.begin(); itp != m_packages.end(); itp++) {
-    RtePackage* package = itp->second;
+  for (auto package : packs) {
     if (!package->IsDeprecated())
       continue;
     if (package == devicePackage)
@@ -598,7 +747,7 @@ void RteModel::InsertComponent(RteComponent* c)
     if (IsFiltered(a) && IsApiDominatingOrNewer(a)) {
       m_apiList[id] = a;
     }
-  } else {
+  } else if (!IsPackageView()) { // a view selects components from the catalog
     // do not allow duplicates (filtering is performed later)
     if (GetComponent(id))
       return;
@@ -617,7 +766,7 @@ bool RteModel::IsApiDominatingOrNewer(RteApi* a) {
     return true; // use new api anyway since it is dominating
   if (!packageDominating && existingDominating)
     return false;
-  return VersionCmp::Compare(aExisting->GetVersionString(), a->GetVersionString()) < 0;
+  return aExisting->GetSemVer().Compare(a->GetSemVer()) < 0;
 }
 
 
@@ -645,8 +794,15 @@ void RteModel::InsertBundle(RteBundle* b)
   m_bundles[id] = b;
 }
 
+const map<string, RteDeviceVendor*>& RteModel::GetDeviceVendors() const
+{
+  EnsureDeviceItems();
+  return m_deviceVendors;
+}
+
 RteDeviceVendor* RteModel::FindDeviceVendor(const string& vendor) const
 {
+  EnsureDeviceItems();
   auto it = m_deviceVendors.find(vendor);
   if (it != m_deviceVendors.end())
     return it->second;
@@ -658,10 +814,10 @@ RteDeviceVendor* RteModel::EnsureDeviceVendor(const string& vendor)
 {
   if (vendor.empty())
     return NULL;
-  RteDeviceVendor* dv = FindDeviceVendor(vendor);
-  if (dv)
-    return dv;
-  dv = new RteDeviceVendor(vendor);
+  auto it = m_deviceVendors.find(vendor);
+  if (it != m_deviceVendors.end())
+    return it->second;
+  RteDeviceVendor* dv = new RteDeviceVendor(vendor);
   m_deviceVendors[vendor] = dv;
   return dv;
 }
@@ -680,11 +836,12 @@ void RteModel::GetDevices(list<RteDevice*>& devices, const string& namePattern,
 {
   if (namePattern.empty() || namePattern.find_first_of("*?[") != string::npos) {
     if (IsUseDeviceTree()) {
-      m_deviceTree->GetDevices(devices, namePattern, vendor, depth); // pattern match
+      if (m_deviceCatalog) {
+        m_deviceCatalog->GetDevices(m_deviceVisibility, devices, namePattern, vendor, depth); // pattern match
+      }
       return;
     }
-    for (auto it = m_deviceVendors.begin(); it != m_deviceVendors.end(); it++) {
-      RteDeviceVendor* dv = it->second;
+    for (auto& [vendorName, dv] : GetDeviceVendors()) {
       dv->GetDevices(devices, namePattern);
     }
     return;
@@ -696,53 +853,50 @@ void RteModel::GetDevices(list<RteDevice*>& devices, const string& namePattern,
 
 RteDevice* RteModel::GetDevice(const string& deviceName, const string& vendor) const
 {
-  if (!vendor.empty()) {
-    string vendorName = DeviceVendor::GetCanonicalVendorName(vendor);
-    RteDeviceVendor* dv = FindDeviceVendor(vendorName);
-    if (dv) {
-      RteDevice* d = dv->GetDevice(deviceName);
-      if (d)
-        return d;
-
-    }
-  } else {
-    for (auto it = m_deviceVendors.begin(); it != m_deviceVendors.end(); it++) {
-      RteDeviceVendor* dv = it->second;
-      RteDevice* d = dv->GetDevice(deviceName);
-      if (d)
-        return d;
-    }
-  }
-  if (IsUseDeviceTree())
-    return dynamic_cast<RteDevice*>(m_deviceTree->GetDeviceItem(deviceName, vendor));
-  return NULL;
+  if (!m_deviceCatalog)
+    return NULL;
+  return m_deviceCatalog->GetDevice(m_deviceVisibility, deviceName, vendor, IsUseDeviceTree());
 }
 
 int RteModel::GetDeviceCount() const
 {
-  int count = 0;
-  for (auto it = m_deviceVendors.begin(); it != m_deviceVendors.end(); it++) {
-    RteDeviceVendor* dv = it->second;
-    count += dv->GetCount();
-  }
-  return count;
-
+  return m_deviceCatalog ? (int)m_deviceCatalog->GetDeviceCount(m_deviceVisibility, RteUtils::EMPTY_STRING) : 0;
 }
+
 int RteModel::GetDeviceCount(const string& vendor) const
 {
-  RteDeviceVendor* dv = FindDeviceVendor(vendor);
-  if (dv)
-    return dv->GetCount();
-  return 0;
+  return m_deviceCatalog ? (int)m_deviceCatalog->GetDeviceCount(m_deviceVisibility, vendor) : 0;
 }
 
+RteDeviceItemAggregate* RteModel::GetDeviceTree() const
+{
+  EnsureDeviceItems();
+  return m_deviceTree;
+}
 
 RteDeviceItemAggregate* RteModel::GetDeviceAggregate(const string& deviceName, const string& vendor) const {
-  return (m_deviceTree->GetDeviceAggregate(deviceName, vendor));
+  return (GetDeviceTree()->GetDeviceAggregate(deviceName, vendor));
 }
 
 RteDeviceItemAggregate* RteModel::GetDeviceItemAggregate(const string& name, const string& vendor) const {
-  return (m_deviceTree->GetDeviceItemAggregate(name, vendor));
+  return (GetDeviceTree()->GetDeviceItemAggregate(name, vendor));
+}
+
+// RteDeviceVendor and RteDeviceItemAggregate objects are only needed by tools displaying devices
+void RteModel::EnsureDeviceItems() const
+{
+  lock_guard<mutex> lock(m_deviceMutex);
+  if (m_bDeviceItemsFilled || !m_deviceCatalog)
+    return;
+  m_bDeviceItemsFilled = true;
+  list<RteDeviceFamily*> families;
+  m_deviceCatalog->GetFamilies(m_deviceVisibility, families);
+  RteModel* model = const_cast<RteModel*>(this);
+  for (auto fam : families) {
+    model->AddDeviceItem(fam);
+    if (IsUseDeviceTree()) // additionally add device info as a tree
+      m_deviceTree->AddDeviceItem(fam);
+  }
 }
 
 // fill device and board information
@@ -750,49 +904,43 @@ void RteModel::FillDeviceTree()
 {
   ClearDevices();
 
-  bool bHasDeprecated = false;
   // use only latest packages
-  RtePackageMap::iterator it;
-  for (it = m_latestPackages.begin(); it != m_latestPackages.end(); it++) {
-    RtePackage* package = it->second;
+  vector<RtePackage*> latestPacks;
+  GetPackages(latestPacks, true);
+
+  // devices are selected from the catalog of the global model, own one is built if not available
+  if (!m_deviceCatalog || !m_deviceCatalog->Filter(latestPacks, m_deviceVisibility)) {
+    vector<RtePackage*> packs;
+    GetPackages(packs, false);
+    m_deviceCatalog = make_shared<RteDeviceCatalog>(packs);
+    m_deviceCatalog->Filter(latestPacks, m_deviceVisibility);
+  }
+
+  bool bHasDeprecated = false;
+  for (auto package : latestPacks) {
     if (!package)
       continue;
     if (package->IsDeprecated()) {
       bHasDeprecated = true;
       continue;
     }
-    FillDeviceTree(package);
+    FillBoards(package);
   }
 
   if (!bHasDeprecated)
     return;
-  for (it = m_latestPackages.begin(); it != m_latestPackages.end(); it++) {
-    RtePackage* package = it->second;
+  for (auto package : latestPacks) {
     if (!package)
       continue;
     if (!package->IsDeprecated()) {
       continue;
     }
-    FillDeviceTree(package);
+    FillBoards(package);
   }
 }
 
-void RteModel::FillDeviceTree(RtePackage* package)
+void RteModel::FillBoards(RtePackage* package)
 {
-  RteDeviceFamilyContainer* families = package->GetDeviceFamiles();
-  if (families) {
-    for (auto child : families->GetChildren()) {
-      RteDeviceFamily* fam = dynamic_cast<RteDeviceFamily*>(child);
-      if (fam) {
-        bool bInserted = AddDeviceItem(fam);
-        if (!bInserted)
-          continue;
-        if (!IsUseDeviceTree()) // additionally add device info as a tree
-          continue;
-        m_deviceTree->AddDeviceItem(fam);
-      }
-    }
-  }
   RteItem* boards = package->GetBoards();
   if (boards) {
     for (auto child : boards->GetChildren()) {
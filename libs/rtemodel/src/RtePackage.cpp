@@ -721,6 +721,7 @@ string RtePackage::ConstructID()
 
   string id = RtePackage::GetPackageIDfromAttributes(*this, true);
   m_commonID = RtePackage::GetPackageIDfromAttributes(*this, false);
+  m_semVer = SemVer(GetVersionString());
 
   m_nDeprecated = IsDeprecated() ? 1 : 0;
   m_nDominating = IsDominating() ? 1 : 0;
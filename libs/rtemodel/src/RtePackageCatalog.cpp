@@ -0,0 +1,301 @@
+/******************************************************************************/
+/* RTE - CMSIS Run-Time Environment */
+/******************************************************************************/
+/** @file RtePackageCatalog.cpp
+* @brief CMSIS RTE Data model
+*/
+/******************************************************************************/
+/*
+ * Copyright (c) 2023 Arm Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+/******************************************************************************/
+#include "RtePackageCatalog.h"
+
+#include "RteComponent.h"
+
+#include <algorithm>
+
+using namespace std;
+
+RtePackageCatalog::RtePackageCatalog(const RtePackageMap& packages)
+{
+  // packs in the order of the global package map: grouped by common ID, latest version first
+  m_packIds.reserve(packages.size());
+  m_packs.reserve(packages.size());
+  for (auto& [id, pack] : packages) {
+    if (!pack) {
+      continue;
+    }
+    const string& commonId = pack->GetCommonID();
+    if (m_groups.empty() || RtePackage::ComparePackageIDs(m_groups.back().commonId, commonId) != 0) {
+      m_groups.push_back(Group{ commonId, (uint32_t)m_packs.size(), 0 });
+    }
+    m_groupIndex.emplace(commonId, (uint32_t)m_groups.size() - 1);
+    m_groups.back().packCount++;
+
+    uint32_t rank = pack->IsDeprecated() ? 3 : (pack->IsDominating() ? 1 : 2);
+    m_packIndex[pack] = (uint32_t)m_packs.size();
+    m_packIdIndex[pack->GetID()] = (uint32_t)m_packs.size();
+    m_packIds.push_back(id);
+    m_packs.push_back(Package{ pack, (uint32_t)m_groups.size() - 1, rank });
+  }
+
+  // the first version of a group is the latest one, the global model uses it for its latest package map
+  m_latest.assign(m_packs.size(), false);
+  for (auto& group : m_groups) {
+    m_latest[group.firstPack] = true;
+    m_latestPackIds.insert(m_packs[group.firstPack].pack->GetID());
+  }
+
+  // unique components in the order RtePackage::InsertInModel() provides them
+  vector<Candidate> candidates;
+  for (uint32_t p = 0; p < m_packs.size(); p++) {
+    CollectComponents(m_packs[p].pack->GetComponents(), p, candidates);
+  }
+  stable_sort(candidates.begin(), candidates.end(), [](const Candidate& a, const Candidate& b) {
+    return a.component->GetID() < b.component->GetID();
+  });
+  m_candidates.reserve(candidates.size());
+  for (auto& c : candidates) {
+    const string& id = c.component->GetID();
+    if (m_componentIds.empty() || m_componentIds.back() != id) {
+      m_componentIndex[id] = (uint32_t)m_componentIds.size();
+      m_componentIds.push_back(id);
+      m_componentFirst.push_back((uint32_t)m_candidates.size());
+    }
+    m_candidates.push_back(c);
+  }
+  m_componentFirst.push_back((uint32_t)m_candidates.size());
+
+  // components of each pack, a view collects them from its packs only
+  vector<vector<uint32_t> > packComponents(m_packs.size());
+  for (uint32_t i = 0; i + 1 < m_componentFirst.size(); i++) {
+    for (uint32_t j = m_componentFirst[i]; j < m_componentFirst[i + 1]; j++) {
+      vector<uint32_t>& components = packComponents[m_candidates[j].pack];
+      if (components.empty() || components.back() != i) {
+        components.push_back(i);
+      }
+    }
+  }
+  m_packComponentFirst.reserve(m_packs.size() + 1);
+  m_packComponents.reserve(m_componentIds.size());
+  for (auto& components : packComponents) {
+    m_packComponentFirst.push_back((uint32_t)m_packComponents.size());
+    m_packComponents.insert(m_packComponents.end(), components.begin(), components.end());
+  }
+  m_packComponentFirst.push_back((uint32_t)m_packComponents.size());
+}
+
+// same traversal as RteItem::InsertInModel(): components do not descend, bundles and other containers do
+void RtePackageCatalog::CollectComponents(RteItem* item, uint32_t pack, vector<Candidate>& candidates) const
+{
+  if (!item) {
+    return;
+  }
+  for (auto child : item->GetChildren()) {
+    RteComponent* c = dynamic_cast<RteComponent*>(child);
+    if (!c) {
+      CollectComponents(child, pack, candidates);
+    } else if (!c->IsApi()) {
+      candidates.push_back(Candidate{ c, pack });
+    }
+  }
+}
+
+RtePackage* RtePackageCatalog::Filter(const RtePackageFilter& filter, RtePackage* devicePackage, Visibility& visibility) const
+{
+  visibility.packs.assign(m_packs.size(), false);
+  visibility.packList.clear();
+  visibility.components.clear();
+  visibility.devicePack = NONE;
+
+  if (filter.IsUseAllPacks()) {
+    // only the latest installed packs pass the filter
+    visibility.latest = m_latest;
+    for (auto& group : m_groups) {
+      visibility.packList.push_back(group.firstPack);
+    }
+  } else {
+    visibility.latest.assign(m_packs.size(), false);
+    // selected packs pass the filter
+    set<string> selectedCommonIds;
+    vector<uint32_t> groups;
+    for (auto& id : filter.GetSelectedPackages()) {
+      selectedCommonIds.insert(RtePackage::CommonIdFromId(id));
+      auto it = m_packIdIndex.find(id);
+      if (it != m_packIdIndex.end() && !visibility.packs[it->second]) {
+        visibility.packs[it->second] = true;
+        visibility.packList.push_back(it->second);
+        groups.push_back(m_packs[it->second].group);
+      }
+    }
+    // latest installed version of packs without explicitly selected version
+    for (auto& commonId : filter.GetLatestPacks()) {
+      if (selectedCommonIds.find(commonId) != selectedCommonIds.end()) {
+        continue;
+      }
+      auto it = m_groupIndex.find(commonId);
+      if (it != m_groupIndex.end() && !visibility.latest[m_groups[it->second].firstPack]) {
+        visibility.latest[m_groups[it->second].firstPack] = true;
+        visibility.packList.push_back(m_groups[it->second].firstPack);
+      }
+    }
+    // latest selected version of the other packs
+    for (uint32_t g : groups) {
+      const Group& group = m_groups[g];
+      for (uint32_t p = group.firstPack; p < group.firstPack + group.packCount; p++) {
+        if (visibility.packs[p]) {
+          visibility.latest[p] = true;
+          break;
+        }
+      }
+    }
+    sort(visibility.packList.begin(), visibility.packList.end());
+  }
+
+  // components provided by the visible packs
+  for (uint32_t p : visibility.packList) {
+    visibility.components.insert(visibility.components.end(), m_packComponents.begin() + m_packComponentFirst[p],
+                                 m_packComponents.begin() + m_packComponentFirst[p + 1]);
+  }
+  sort(visibility.components.begin(), visibility.components.end());
+  visibility.components.erase(unique(visibility.components.begin(), visibility.components.end()), visibility.components.end());
+
+  if (!devicePackage) {
+    return nullptr;
+  }
+  auto it = m_packIndex.find(devicePackage);
+  if (it == m_packIndex.end()) {
+    return devicePackage; // not in catalog, caller takes care
+  }
+  uint32_t p = it->second;
+  if (!visibility.packs[p] && !visibility.latest[p]) {
+    // the latest filtered version replaces the device pack
+    p = GetLatestPackage(visibility, m_packs[p].group);
+  }
+  visibility.devicePack = p;
+  return p != NONE ? m_packs[p].pack : nullptr;
+}
+
+uint32_t RtePackageCatalog::GetLatestPackage(const Visibility& visibility, uint32_t group) const
+{
+  const Group& g = m_groups[group];
+  for (uint32_t p = g.firstPack; p < g.firstPack + g.packCount; p++) {
+    if (visibility.latest[p]) {
+      return p;
+    }
+  }
+  return NONE;
+}
+
+// a latest pack that is not selected is the only visible version of its group
+void RtePackageCatalog::GetPackages(const Visibility& visibility, vector<RtePackage*>& packs, bool bLatest) const
+{
+  for (uint32_t p : visibility.packList) {
+    if (!bLatest || visibility.latest[p]) {
+      packs.push_back(m_packs[p].pack);
+    }
+  }
+}
+
+// each group has at most one latest pack
+void RtePackageCatalog::GetPackages(const Visibility& visibility, RtePackageMap& packages, RtePackageMap& latestPackages) const
+{
+  for (uint32_t p : visibility.packList) {
+    if (visibility.packs[p]) {
+      packages.emplace_hint(packages.end(), m_packIds[p], m_packs[p].pack);
+    }
+    if (visibility.latest[p]) {
+      const string& commonId = m_groups[m_packs[p].group].commonId;
+      latestPackages.emplace_hint(latestPackages.end(), commonId, m_packs[p].pack);
+      if (!visibility.packs[p]) {
+        packages[commonId] = m_packs[p].pack;
+      }
+    }
+  }
+}
+
+uint32_t RtePackageCatalog::FindPackage(const string& id) const
+{
+  auto it = lower_bound(m_packIds.begin(), m_packIds.end(), id, RtePackageComparator());
+  if (it != m_packIds.end() && RtePackage::ComparePackageIDs(id, *it) == 0) {
+    return (uint32_t)(it - m_packIds.begin());
+  }
+  return NONE;
+}
+
+uint32_t RtePackageCatalog::FindGroup(const string& commonId) const
+{
+  auto it = lower_bound(m_groups.begin(), m_groups.end(), commonId, [](const Group& g, const string& id) {
+    return RtePackage::ComparePackageIDs(g.commonId, id) < 0;
+  });
+  if (it != m_groups.end() && RtePackage::ComparePackageIDs(commonId, it->commonId) == 0) {
+    return (uint32_t)(it - m_groups.begin());
+  }
+  return NONE;
+}
+
+RtePackage* RtePackageCatalog::GetPackage(const Visibility& visibility, const string& id) const
+{
+  uint32_t p = FindPackage(id);
+  if (p != NONE && visibility.packs[p]) {
+    return m_packs[p].pack;
+  }
+  // latest packs that are not selected are registered with their common ID
+  uint32_t g = FindGroup(id);
+  if (g == NONE) {
+    return nullptr;
+  }
+  p = GetLatestPackage(visibility, g);
+  if (p != NONE && !visibility.packs[p]) {
+    return m_packs[p].pack;
+  }
+  return nullptr;
+}
+
+RtePackage* RtePackageCatalog::GetLatestPackage(const Visibility& visibility, const string& id) const
+{
+  uint32_t g = FindGroup(RtePackage::CommonIdFromId(id));
+  if (g == NONE) {
+    return nullptr;
+  }
+  uint32_t p = GetLatestPackage(visibility, g);
+  return p != NONE ? m_packs[p].pack : nullptr;
+}
+
+// the first component in the order of RteModel::FillComponentList() wins:
+// device pack, dominating packs, other packs, deprecated packs
+RteComponent* RtePackageCatalog::GetComponent(const Visibility& visibility, size_t index) const
+{
+  RteComponent* component = nullptr;
+  uint32_t rank = NONE;
+  for (uint32_t i = m_componentFirst[index]; i < m_componentFirst[index + 1]; i++) {
+    const Candidate& c = m_candidates[i];
+    if (c.pack == visibility.devicePack) {
+      return c.component;
+    }
+    if (!visibility.packs[c.pack] && !visibility.latest[c.pack]) {
+      continue;
+    }
+    // candidates are in pack order, the first one of the best rank wins
+    uint32_t packRank = m_packs[c.pack].rank;
+    if (packRank < rank) {
+      component = c.component;
+      rank = packRank;
+    }
+  }
+  return component;
+}
+
+RteComponent* RtePackageCatalog::GetComponent(const Visibility& visibility, const string& id) const
+{
+  auto it = m_componentIndex.find(id);
+  if (it == m_componentIndex.end()) {
+    return nullptr;
+  }
+  return GetComponent(visibility, it->second);
+}
+
+// End of RtePackageCatalog.cpp
@@ -28,6 +28,8 @@ using namespace std;
 
 const std::string RteProject::DEFAULT_RTE_FOLDER = "RTE";
 
+unsigned int RteProject::m_maxThreads = 0;
+
 
 RteLicenseInfo::RteLicenseInfo(RteItem* parent) :
   RteItem("license", parent)
@@ -600,20 +602,53 @@ void RteProject::InitFileInstance(RteFileInstance* fi, RteFile* f, int index, Rt
 
 void RteProject::WriteInstanceFiles(const std::string& targetName)
 {
-  for (auto it = m_files.begin(); it != m_files.end(); ++it) {
-    const string& fileID = it->first;
-    RteFileInstance* fi = it->second;
+  map<RteFileInstance*, vector<RteFile*> > backups;
+  WriteInstanceFiles(targetName, backups);
+  UpdateConfigFileBackups(backups);
+}
+
+void RteProject::WriteInstanceFiles(const string& targetName, map<RteFileInstance*, vector<RteFile*> >& backups)
+{
+  for (auto it = m_files.begin(); it != m_files.end();) {
+    auto itcurrent = it++;
+    const string& fileID = itcurrent->first;
+    RteFileInstance* fi = itcurrent->second;
     if (fi->IsRemoved() || fi->GetTargetCount() == 0) {
       RemoveFileInstance(fileID);
     } else if (fi->IsUsedByTarget(targetName)){
       RteFile* f = fi->GetFile(targetName);
-      if (f && !RteFsUtils::Exists(fi->GetAbsolutePath())) {
+      if (!f) {
+        continue;
+      }
+      if (!RteFsUtils::Exists(fi->GetAbsolutePath())) {
+        // the copy backs up the file with its base file, pending backup updates must be done before
+        auto itb = backups.find(fi);
+        if (itb != backups.end()) {
+          for (RteFile* backupFile : itb->second) {
+            UpdateConfigFileBackups(fi, backupFile);
+          }
+          backups.erase(itb);
+        }
         UpdateFileInstance(fi, f, false, false);
       }
-      UpdateConfigFileBackups(fi, f);
+      backups[fi].push_back(f);
     }
   }
 }
+
+void RteProject::UpdateConfigFileBackups(const map<RteFileInstance*, vector<RteFile*> >& backups)
+{
+  // backup files of different file instances do not interfere, updates of one instance keep their order
+  vector<pair<RteFileInstance*, const vector<RteFile*>*> > tasks;
+  for (auto& [fi, files] : backups) {
+    tasks.push_back({ fi, &files });
+  }
+  RteUtils::RunConcurrently(tasks.size(), [&](size_t i) {
+    for (RteFile* f : *tasks[i].second) {
+      UpdateConfigFileBackups(tasks[i].first, f);
+    }
+  }, m_maxThreads);
+}
 bool RteProject::UpdateFileInstance(RteFileInstance* fi, RteFile* f, bool bMerge, bool bUpdateComponent)
 {
   if (!ShouldUpdateRte())
@@ -690,7 +725,9 @@ void RteProject::UpdateConfigFileBackups(RteFileInstance* fi, RteFile* f)
   // copy current file if version differs
   string updateFile = RteUtils::AppendFileUpdateVersion(absPath, updateVersion);
   if (!baseFile.empty() && baseVersion != updateVersion)  { // only copy update if base exists
-    RteFsUtils::CopyCheckFile(src, updateFile, false);
+    if (!RteFsUtils::CmpFiles(src, updateFile)) {
+      RteFsUtils::CopyCheckFile(src, updateFile, false);
+    }
     RteFsUtils::SetFileReadOnly(updateFile, true);
   } else {
     updateFile.clear(); // no need in that
@@ -1072,23 +1109,35 @@ void RteProject::Update()
 
   // copy files if update is enabled
   if (ShouldUpdateRte()) {
+    // missing config files are copied in target order, their backups are updated afterwards
+    map<RteFileInstance*, vector<RteFile*> > backups;
     for (auto itt = m_targets.begin(); itt != m_targets.end(); itt++) {
-      WriteInstanceFiles(itt->first);
+      WriteInstanceFiles(itt->first, backups);
     }
+    UpdateConfigFileBackups(backups);
+
     // add forced copy files
+    vector<pair<string, string> > copies; // source and destination
+    set<string> destinations;
     for (auto itf = forcedFiles.begin(); itf != forcedFiles.end(); itf++) {
       RteFile* f = *itf;
       string dst = GetProjectPath() + f->GetInstancePathName(EMPTY_STRING, 0, GetRteFolder());
 
       error_code ec;
-      if (fs::exists(dst, ec))
+      if (fs::exists(dst, ec) || !destinations.insert(dst).second)
         continue;
-      string src = f->GetOriginalAbsolutePath();
-      if (!RteFsUtils::CopyCheckFile(src, dst, false)) {
+      copies.push_back({ f->GetOriginalAbsolutePath(), dst });
+    }
+    vector<char> copied(copies.size(), 0);
+    RteUtils::RunConcurrently(copies.size(), [&](size_t i) {
+      copied[i] = RteFsUtils::CopyCheckFile(copies[i].first, copies[i].second, false);
+    }, m_maxThreads);
+    for (size_t i = 0; i < copies.size(); i++) {
+      if (!copied[i]) {
         string str = "Error: cannot copy file\n";
-        str += src;
+        str += copies[i].first;
         str += "\n to\n";
-        str += dst;
+        str += copies[i].second;
         str += "\nOperation failed\n";
         GetCallback()->OutputErrMessage(str);
       }
@@ -18,6 +18,7 @@
 #include "RteInstance.h"
 #include "RteModel.h"
 #include "RteFsUtils.h"
+#include "RteTrace.h"
 
 #include <fstream>
 #include <sstream>
@@ -1116,7 +1117,7 @@ RteComponent* RteTarget::GetLatestPotentialComponent(const string& id) const
 {
   for (auto it = m_potentialComponents.begin(); it != m_potentialComponents.end(); it++) {
     RteComponent* c = it->second;
-    if (c->GetComponentID(false) == id)
+    if (c->GetCachedComponentID(false) == id)
       return c;
   }
   return NULL;
@@ -1231,7 +1232,7 @@ void RteTarget::AddFilteredComponent(RteComponent* c)
     }
 
     // check pack version, not component version !
-    if (VersionCmp::Compare(pack->GetVersionString(), insertedPack->GetVersionString()) < 0)
+    if (pack->GetSemVer().Compare(insertedPack->GetSemVer()) < 0)
       return; // the inserted component comes from newer package
   }
 
@@ -1272,6 +1273,7 @@ void RteTarget::UpdateFilterModel()
   if (!IsTargetSupported())
     return;
 
+  RteTraceScope trace("rte", "UpdateFilterModel");
   ClearFilteredComponents();
   m_filteredModel->SetFilterContext(GetFilterContext());
   RteModel* globalModel = GetModel(); // global one
@@ -1279,6 +1281,7 @@ void RteTarget::UpdateFilterModel()
   if (m_effectiveDevicePackage != GetDevicePackage())
     ProcessAttributes(); // updates device
   FilterComponents();
+  trace.AddArg("components", m_filteredComponents.size());
 }
 
 void RteTarget::FilterComponents()
@@ -1300,10 +1303,9 @@ void RteTarget::FilterComponents()
   }
 
   // fill unique filtered list from filtered model
-  const RteComponentMap& componentList = m_filteredModel->GetComponentList();
-  RteComponentMap::const_iterator itc;
-  for (itc = componentList.begin(); itc != componentList.end(); itc++) {
-    RteComponent* c = itc->second;
+  list<RteComponent*> components;
+  m_filteredModel->GetComponents(components);
+  for (auto c : components) {
     if (deviceStartup && c->IsDeviceStartup())
       continue; // always take device startup from generated project
     ConditionResult r = c->Evaluate(GetFilterContext());
@@ -1312,6 +1314,7 @@ void RteTarget::FilterComponents()
     }
   }
   // categorize component and filter files
+  RteComponentMap::const_iterator itc;
   for (itc = m_filteredComponents.begin(); itc != m_filteredComponents.end(); itc++) {
     RteComponent* c = itc->second;
     RteApi* a = GetApi(c->GetAttributes());
@@ -7,6 +7,7 @@
 #include "RteModelTestConfig.h"
 
 #include "RteItem.h"
+#include "RteComponent.h"
 #include "RteCondition.h"
 #include "RtePackage.h"
 #include <map>
@@ -66,6 +67,22 @@ TEST(RteItemTest, GetComponentID_reduced_attributes) {
   EXPECT_EQ("Class:Group", item.GetTaxonomyDescriptionID());
 }
 
+TEST(RteItemTest, CachedComponentID) {
+  RteComponent component(nullptr);
+  component.SetTag("component");
+  component.SetAttributes({ {"Cvendor", "Vendor"}, {"Cclass", "Class"}, {"Cgroup", "Group"}, {"Cversion", "1.0.0"} });
+  component.Construct();
+  EXPECT_EQ("Vendor::Class:Group@1.0.0", component.GetCachedComponentID(true));
+  EXPECT_EQ("Vendor::Class:Group", component.GetCachedComponentID(false));
+  EXPECT_EQ("Vendor::Class:Group@1.0.0", component.GetComponentID(true));
+
+  // cached IDs follow attribute changes
+  component.AddAttributes({ {"Csub", "Sub"}, {"Cversion", "2.0.0"} }, true);
+  EXPECT_EQ("Vendor::Class:Group:Sub@2.0.0", component.GetCachedComponentID(true));
+  EXPECT_EQ("Vendor::Class:Group:Sub", component.GetComponentID(false));
+  EXPECT_EQ(0, component.GetSemVer().Compare(SemVer("2.0.0")));
+}
+
 TEST(RteItemTest, ComponentAttributesFromId) {
 
   string id = "Vendor::Class&Bundle:Group:Sub&Variant@9.9.9";
@@ -0,0 +1,363 @@
+/*
+ * Copyright (c) 2023 Arm Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+*/
+
+// RteModelBenchmark.cpp : performance scenarios for the RTE model on synthetic packs
+//
+// Usage: RteModelBenchmark [-p packs] [-c components] [-d devices] [-l condition depth] [-r repeats] [-o output.json]
+//
+// Generates packs in a temporary pack root and reports time and peak resident set size of each scenario as JSON
+
+#include "RteComponent.h"
+#include "RteKernelSlim.h"
+#include "RteModel.h"
+#include "RteProject.h"
+#include "RteTarget.h"
+#include "RteFsUtils.h"
+#include "VersionCmp.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <filesystem>
+#include <functional>
+#include <iostream>
+#include <random>
+#include <sstream>
+
+#ifdef _WIN32
+#include <windows.h>
+#include <psapi.h>
+#else
+#include <sys/resource.h>
+#endif
+
+using namespace std;
+
+namespace {
+
+  struct BenchmarkParameters {
+    int packs = 20;
+    int components = 50;
+    int devices = 20;
+    int depth = 10;
+    int repeats = 5;
+  };
+
+  struct BenchmarkResult {
+    string name;
+    double minMs;
+    double meanMs;
+    uint64_t peakRssKb;
+    size_t count;
+  };
+
+  uint64_t GetPeakRssKb()
+  {
+#ifdef _WIN32
+    PROCESS_MEMORY_COUNTERS counters;
+    if (GetProcessMemoryInfo(GetCurrentProcess(), &counters, sizeof(counters))) {
+      return counters.PeakWorkingSetSize / 1024;
+    }
+    return 0;
+#else
+    struct rusage usage;
+    if (getrusage(RUSAGE_SELF, &usage) != 0) {
+      return 0;
+    }
+#ifdef __APPLE__
+    return usage.ru_maxrss / 1024; // bytes
+#else
+    return usage.ru_maxrss;        // kilobytes
+#endif
+#endif
+  }
+
+  string PackName(int p)
+  {
+    return "Pack" + to_string(p);
+  }
+
+  string DeviceName(int p, int d)
+  {
+    return "BENCH" + to_string(p) + "_DEV" + to_string(d);
+  }
+
+  // pack p provides K devices, a chain of L conditions and M components each requiring the next one
+  string GeneratePdsc(const BenchmarkParameters& params, int p)
+  {
+    ostringstream os;
+    os << "<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n";
+    os << "<package schemaVersion=\"1.7.7\" xmlns:xs=\"http://www.w3.org/2001/XMLSchema-instance\" xs:noNamespaceSchemaLocation=\"PACK.xsd\">\n";
+    os << "  <vendor>Bench</vendor>\n";
+    os << "  <name>" << PackName(p) << "</name>\n";
+    os << "  <description>Synthetic benchmark pack</description>\n";
+    os << "  <url>https://www.keil.com/pack/</url>\n";
+    os << "  <releases>\n    <release version=\"1.0.0\">generated</release>\n  </releases>\n";
+
+    os << "  <devices>\n";
+    os << "    <family Dfamily=\"Bench Family " << p << "\" Dvendor=\"ARM:82\">\n";
+    os << "      <processor Dcore=\"Cortex-M4\" DcoreVersion=\"r0p1\" Dfpu=\"SP_FPU\" Dmpu=\"MPU\" Dendian=\"Little-endian\" Dclock=\"100000000\"/>\n";
+    for (int d = 0; d < params.devices; d++) {
+      os << "      <device Dname=\"" << DeviceName(p, d) << "\">\n";
+      os << "        <memory id=\"IROM1\" start=\"0x00000000\" size=\"0x40000\" startup=\"1\" default=\"1\"/>\n";
+      os << "        <memory id=\"IRAM1\" start=\"0x20000000\" size=\"0x10000\" init=\"0\" default=\"1\"/>\n";
+      os << "      </device>\n";
+    }
+    os << "    </family>\n";
+    os << "  </devices>\n";
+
+    os << "  <conditions>\n";
+    os << "    <condition id=\"Level0\">\n      <require Dvendor=\"ARM:82\"/>\n    </condition>\n";
+    for (int l = 1; l <= params.depth; l++) {
+      os << "    <condition id=\"Level" << l << "\">\n";
+      os << "      <require condition=\"Level" << (l - 1) << "\"/>\n";
+      os << "      <accept Dcore=\"Cortex-M3\"/>\n";
+      os << "      <accept Dcore=\"Cortex-M4\"/>\n";
+      os << "    </condition>\n";
+    }
+    for (int c = 0; c + 1 < params.components; c++) {
+      os << "    <condition id=\"Requires" << c << "\">\n";
+      os << "      <require condition=\"Level" << params.depth << "\"/>\n";
+      os << "      <require Cclass=\"Bench\" Cgroup=\"" << PackName(p) << "\" Csub=\"C" << (c + 1) << "\"/>\n";
+      os << "    </condition>\n";
+    }
+    os << "  </conditions>\n";
+
+    os << "  <components>\n";
+    for (int c = 0; c < params.components; c++) {
+      string condition = c + 1 < params.components ? "Requires" + to_string(c) : "Level" + to_string(params.depth);
+      os << "    <component Cclass=\"Bench\" Cgroup=\"" << PackName(p) << "\" Csub=\"C" << c << "\" Cversion=\"1.0.0\" condition=\"" << condition << "\">\n";
+      os << "      <description>Component " << c << "</description>\n";
+      os << "      <files>\n";
+      os << "        <file category=\"source\" name=\"Source/c" << c << ".c\"/>\n";
+      os << "        <file category=\"header\" name=\"Include/c" << c << ".h\"/>\n";
+      os << "      </files>\n";
+      os << "    </component>\n";
+    }
+    os << "  </components>\n";
+    os << "</package>\n";
+    return os.str();
+  }
+
+  bool GeneratePacks(const BenchmarkParameters& params, const string& packRoot)
+  {
+    for (int p = 0; p < params.packs; p++) {
+      const string dir = packRoot + "/Bench/" + PackName(p) + "/1.0.0";
+      if (!RteFsUtils::CreateDirectories(dir) ||
+        !RteFsUtils::CopyBufferToFile(dir + "/Bench." + PackName(p) + ".pdsc", GeneratePdsc(params, p), false)) {
+        cerr << "cannot write pack to " << dir << endl;
+        return false;
+      }
+    }
+    return true;
+  }
+
+  // run a scenario several times, the function returns the number of processed items
+  BenchmarkResult Measure(const string& name, int repeats, const function<size_t()>& scenario)
+  {
+    BenchmarkResult result{ name, 0.0, 0.0, 0, 0 };
+    double total = 0.0;
+    for (int i = 0; i < repeats; i++) {
+      auto start = chrono::steady_clock::now();
+      result.count = scenario();
+      double ms = chrono::duration<double, milli>(chrono::steady_clock::now() - start).count();
+      total += ms;
+      result.minMs = i == 0 ? ms : min(result.minMs, ms);
+    }
+    result.meanMs = repeats > 0 ? total / repeats : 0.0;
+    result.peakRssKb = GetPeakRssKb();
+    return result;
+  }
+
+  // pack versions, every fifth one with a pre-release part
+  vector<string> GenerateVersions(size_t count)
+  {
+    mt19937 rnd(1);
+    vector<string> versions;
+    versions.reserve(count);
+    for (size_t i = 0; i < count; i++) {
+      string v = to_string(rnd() % 20) + "." + to_string(rnd() % 50) + "." + to_string(rnd() % 200);
+      if (i % 5 == 0) {
+        v += (rnd() % 2 ? "-rc" : "-dev") + to_string(rnd() % 10);
+      }
+      versions.push_back(v);
+    }
+    return versions;
+  }
+
+  bool LoadPacks(RteKernelSlim& kernel, const string& packRoot)
+  {
+    kernel.SetCmsisPackRoot(packRoot);
+    list<string> files;
+    kernel.GetInstalledPacks(files, false);
+    list<RtePackage*> packs;
+    if (!kernel.LoadPacks(files, packs)) {
+      return false;
+    }
+    kernel.GetGlobalModel()->InsertPacks(packs);
+    return true;
+  }
+
+  string ToJson(const BenchmarkParameters& params, const vector<BenchmarkResult>& results)
+  {
+    ostringstream os;
+    os << "{\n  \"parameters\": {\"packs\": " << params.packs << ", \"components\": " << params.components
+      << ", \"devices\": " << params.devices << ", \"depth\": " << params.depth << ", \"repeats\": " << params.repeats << "},\n";
+    os << "  \"results\": [\n";
+    for (size_t i = 0; i < results.size(); i++) {
+      const BenchmarkResult& r = results[i];
+      os << "    {\"name\": \"" << r.name << "\", \"min_ms\": " << r.minMs << ", \"mean_ms\": " << r.meanMs
+        << ", \"peak_rss_kb\": " << r.peakRssKb << ", \"count\": " << r.count << "}" << (i + 1 < results.size() ? "," : "") << "\n";
+    }
+    os << "  ]\n}\n";
+    return os.str();
+  }
+
+  bool ProcessArguments(int argc, char* argv[], BenchmarkParameters& params, string& outFile)
+  {
+    for (int i = 1; i < argc; i++) {
+      const string arg = argv[i];
+      if (arg == "-o" && i + 1 < argc) {
+        outFile = argv[++i];
+        continue;
+      }
+      int* value = arg == "-p" ? &params.packs : arg == "-c" ? &params.components :
+        arg == "-d" ? &params.devices : arg == "-l" ? &params.depth : arg == "-r" ? &params.repeats : nullptr;
+      if (!value || i + 1 >= argc || atoi(argv[i + 1]) <= 0) {
+        cerr << "Usage: RteModelBenchmark [-p packs] [-c components] [-d devices] [-l condition depth] [-r repeats] [-o output.json]" << endl;
+        return false;
+      }
+      *value = atoi(argv[++i]);
+    }
+    return true;
+  }
+}
+
+//------------------------------------------------------------------
+int main(int argc, char* argv[])
+{
+  BenchmarkParameters params;
+  string outFile;
+  if (!ProcessArguments(argc, argv, params, outFile)) {
+    return 1;
+  }
+
+  error_code ec;
+  const string packRoot = (filesystem::temp_directory_path(ec) / "RteModelBenchmark").generic_string();
+  RteFsUtils::RemoveDir(packRoot);
+  if (!GeneratePacks(params, packRoot)) {
+    return 1;
+  }
+
+  vector<BenchmarkResult> results;
+  results.push_back(Measure("load_packs", params.repeats, [&]() -> size_t {
+    RteKernelSlim kernel;
+    return LoadPacks(kernel, packRoot) ? kernel.GetGlobalModel()->GetPackages().size() : 0;
+  }));
+
+  RteKernelSlim kernel;
+  if (!LoadPacks(kernel, packRoot)) {
+    cerr << "cannot load packs from " << packRoot << endl;
+    return 1;
+  }
+  RteGlobalModel* globalModel = kernel.GetGlobalModel();
+  RteProject* project = new RteProject(); // the model takes the ownership
+  globalModel->AddProject(0, project);
+  globalModel->SetActiveProjectId(project->GetProjectId());
+  project->AddTarget("Benchmark", map<string, string>(), true, true);
+  project->SetActiveTarget("Benchmark");
+  RteTarget* target = project->GetActiveTarget();
+
+  // filter the model for a device of each pack in turn
+  int device = 0;
+  results.push_back(Measure("filter_model", params.repeats, [&]() -> size_t {
+    size_t components = 0;
+    for (int p = 0; p < params.packs; p++) {
+      target->SetAttributes({ {"Dname", DeviceName(p, device % params.devices)}, {"Dvendor", "ARM:82"} });
+      target->UpdateFilterModel();
+      components += target->GetFilteredComponents().size();
+    }
+    device++;
+    return components;
+  }));
+
+  results.push_back(Measure("resolve_components", params.repeats, [&]() -> size_t {
+    size_t found = 0;
+    RteModel* filteredModel = target->GetFilteredModel();
+    for (int p = 0; p < params.packs; p++) {
+      for (int c = 0; c < params.components; c++) {
+        const string id = "Bench::Bench:" + PackName(p) + ":C" + to_string(c) + "@1.0.0";
+        if (filteredModel->FindComponent(id) && globalModel->FindComponent(id)) {
+          found++;
+        }
+      }
+    }
+    return found;
+  }));
+
+  // enumerate all components of the model: constructed IDs vs cached ones
+  const RteComponentMap& componentList = globalModel->GetComponentList();
+  results.push_back(Measure("construct_component_ids", params.repeats, [&]() -> size_t {
+    size_t length = 0;
+    for (auto& [_, c] : componentList) {
+      length += c->ConstructComponentID(true).size() + c->ConstructComponentID(false).size();
+    }
+    return length ? componentList.size() : 0;
+  }));
+  results.push_back(Measure("cached_component_ids", params.repeats, [&]() -> size_t {
+    size_t length = 0;
+    for (auto& [_, c] : componentList) {
+      length += c->GetCachedComponentID(true).size() + c->GetCachedComponentID(false).size();
+    }
+    return length ? componentList.size() : 0;
+  }));
+
+  // select the head of each component chain and let the solver select the rest
+  results.push_back(Measure("resolve_dependencies", params.repeats, [&]() -> size_t {
+    target->ClearSelectedComponents();
+    for (int p = 0; p < params.packs; p++) {
+      RteComponent* c = target->GetFilteredModel()->FindComponent("Bench::Bench:" + PackName(p) + ":C0");
+      if (c) {
+        target->SelectComponent(c, 1, false);
+      }
+    }
+    project->EvaluateComponentDependencies(target);
+    project->ResolveDependencies(target);
+    return target->CollectSelectedComponentAggregates().size();
+  }));
+
+  // sort pack versions as strings and as pre-parsed SemVer objects
+  const vector<string> versions = GenerateVersions(100000);
+  results.push_back(Measure("sort_version_strings", params.repeats, [&]() -> size_t {
+    vector<string> sorted = versions;
+    stable_sort(sorted.begin(), sorted.end(), VersionCmp::Less());
+    return sorted.size();
+  }));
+  results.push_back(Measure("sort_versions", params.repeats, [&]() -> size_t {
+    vector<pair<SemVer, const string*> > parsed;
+    parsed.reserve(versions.size());
+    for (auto& v : versions) {
+      parsed.emplace_back(SemVer(v), &v);
+    }
+    stable_sort(parsed.begin(), parsed.end(), [](const auto& a, const auto& b) {
+      return a.first.Compare(b.first) < 0;
+    });
+    return parsed.size();
+  }));
+
+  RteFsUtils::RemoveDir(packRoot);
+
+  const string json = ToJson(params, results);
+  if (outFile.empty()) {
+    cout << json;
+  } else if (!RteFsUtils::CopyBufferToFile(outFile, json, false)) {
+    cerr << "cannot write " << outFile << endl;
+    return 1;
+  }
+  return 0;
+}
+
+// End of RteModelBenchmark.cpp
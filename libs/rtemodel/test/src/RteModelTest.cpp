@@ -199,6 +199,115 @@ TEST(RteModelTest, LoadPacks) {
   EXPECT_TRUE(gen == extGenRteCallback.m_pExtGenerator);
 }
 
+TEST(RteModelTest, FilterDevices) {
+  RteKernelSlim rteKernel;
+  rteKernel.SetCmsisPackRoot(RteModelTestConfig::CMSIS_PACK_ROOT);
+  list<string> files;
+  rteKernel.GetInstalledPacks(files, false);
+  list<RtePackage*> packs;
+  EXPECT_TRUE(rteKernel.LoadPacks(files, packs));
+  RteGlobalModel* globalModel = rteKernel.GetGlobalModel();
+  ASSERT_NE(globalModel, nullptr);
+  globalModel->InsertPacks(packs);
+
+  RteDevice* device = globalModel->GetDevice("RteTest_ARMCM4_FP", "ARM:82");
+  ASSERT_NE(device, nullptr);
+  EXPECT_EQ(device->GetPackage()->GetPackageID(), "ARM::RteTest_DFP@0.2.0");
+  list<RteDevice*> devices;
+  globalModel->GetDevices(devices, "RteTest_ARMCM4*", "ARM", RteDeviceItem::VARIANT);
+  EXPECT_EQ(devices.size(), 3);
+
+  // filtered model selects devices of an older pack from the catalog shared with the global model
+  RteModel filteredModel(globalModel);
+  RtePackageFilter filter;
+  filter.SetUseAllPacks(false);
+  filter.SetSelectedPackages({ "ARM::RteTest_DFP@0.1.1" });
+  filteredModel.SetPackageFilter(filter);
+  filteredModel.FilterModel(globalModel, nullptr);
+  EXPECT_EQ(filteredModel.GetDeviceCatalog(), globalModel->GetDeviceCatalog());
+  device = filteredModel.GetDevice("RteTest_ARMCM4_FP", "ARM:82");
+  ASSERT_NE(device, nullptr);
+  EXPECT_EQ(device->GetPackage()->GetPackageID(), "ARM::RteTest_DFP@0.1.1");
+  devices.clear();
+  filteredModel.GetDevices(devices, "", "ARM", RteDeviceItem::VARIANT);
+  for (auto d : devices) {
+    EXPECT_EQ(d->GetPackage()->GetPackageID(), "ARM::RteTest_DFP@0.1.1");
+  }
+  EXPECT_EQ(devices.size(), 5);
+  EXPECT_EQ(filteredModel.GetDeviceCount(), 4); // only devices without variants and the variants are counted
+  RteDeviceItemAggregate* da = filteredModel.GetDeviceAggregate("RteTest_ARMCM4_FP", "ARM");
+  ASSERT_NE(da, nullptr);
+  EXPECT_EQ(da->GetDeviceItem(), device);
+}
+
+TEST(RteModelTest, FilterPackages) {
+  RteKernelSlim rteKernel;
+  rteKernel.SetCmsisPackRoot(RteModelTestConfig::CMSIS_PACK_ROOT);
+  list<string> files;
+  rteKernel.GetInstalledPacks(files, false);
+  list<RtePackage*> packs;
+  EXPECT_TRUE(rteKernel.LoadPacks(files, packs));
+  RteGlobalModel* globalModel = rteKernel.GetGlobalModel();
+  ASSERT_NE(globalModel, nullptr);
+  globalModel->InsertPacks(packs);
+  EXPECT_FALSE(globalModel->IsPackageView());
+
+  // filtered model is a view of the package catalog shared with the global model
+  RteModel filteredModel(globalModel);
+  RtePackageFilter filter;
+  filter.SetUseAllPacks(false);
+  filter.SetSelectedPackages({ "ARM::RteTest_DFP@0.1.1" });
+  filteredModel.SetPackageFilter(filter);
+  filteredModel.FilterModel(globalModel, nullptr);
+  EXPECT_TRUE(filteredModel.IsPackageView());
+  EXPECT_EQ(filteredModel.GetPackageCatalog(), nullptr);
+  EXPECT_NE(globalModel->GetPackageCatalog(), nullptr);
+
+  RtePackage* pack = filteredModel.GetPackage("ARM::RteTest_DFP@0.1.1");
+  ASSERT_NE(pack, nullptr);
+  EXPECT_EQ(filteredModel.GetPackage("ARM::RteTest_DFP@0.2.0"), nullptr);
+  EXPECT_NE(globalModel->GetPackage("ARM::RteTest_DFP@0.2.0"), nullptr);
+  EXPECT_EQ(filteredModel.GetLatestPackage("ARM::RteTest_DFP"), pack);
+
+  list<RteComponent*> components;
+  filteredModel.GetComponents(components);
+  EXPECT_FALSE(components.empty());
+  for (auto c : components) {
+    EXPECT_EQ(c->GetPackage(), pack);
+    EXPECT_EQ(filteredModel.GetComponent(c->GetID()), c);
+  }
+  // maps are filled on request
+  EXPECT_EQ(filteredModel.GetPackages().size(), 1);
+  EXPECT_EQ(filteredModel.GetLatestPackages().size(), 1);
+  EXPECT_EQ(filteredModel.GetComponentList().size(), components.size());
+}
+
+TEST(RteModelTest, CachedComponentID) {
+  RteKernelSlim rteKernel;
+  rteKernel.SetCmsisPackRoot(RteModelTestConfig::CMSIS_PACK_ROOT);
+  list<string> files;
+  rteKernel.GetInstalledPacks(files, false);
+  list<RtePackage*> packs;
+  EXPECT_TRUE(rteKernel.LoadPacks(files, packs));
+  RteGlobalModel* globalModel = rteKernel.GetGlobalModel();
+  ASSERT_NE(globalModel, nullptr);
+  globalModel->InsertPacks(packs);
+  const RteComponentMap& componentList = globalModel->GetComponentList();
+  ASSERT_FALSE(componentList.empty());
+
+  // cached IDs match constructed ones and are stable across calls
+  for (auto& [_, c] : componentList) {
+    const string& cachedWithVersion = c->GetCachedComponentID(true);
+    const string& cachedWithoutVersion = c->GetCachedComponentID(false);
+    EXPECT_EQ(c->ConstructComponentID(true), cachedWithVersion);
+    EXPECT_EQ(c->ConstructComponentID(false), cachedWithoutVersion);
+    EXPECT_EQ(&cachedWithVersion, &c->GetCachedComponentID(true));
+    RteComponent* found = globalModel->FindComponent(cachedWithVersion);
+    ASSERT_NE(found, nullptr);
+    EXPECT_EQ(found->GetCachedComponentID(true), cachedWithVersion);
+  }
+}
+
 class RteModelPrjTest : public RteModelTestConfig
 {
 protected:
@@ -600,6 +709,42 @@ TEST_F(RteModelPrjTest, LoadCprjConfigVer) {
 
 }
 
+TEST_F(RteModelPrjTest, LoadCprjConfigVer_ConcurrentBackups) {
+  // backups of several config file instances are updated concurrently, the result must match the serial update
+  map<string, string> rteFiles[2];
+  const unsigned int maxThreads[2] = { 1, 4 };
+  for (int i = 0; i < 2; i++) {
+    if (i > 0) {
+      SetUp(); // restore the original project files
+    }
+    RteProject::SetMaxThreads(maxThreads[i]);
+    RteKernelSlim rteKernel;
+    rteKernel.SetCmsisPackRoot(RteModelTestConfig::CMSIS_PACK_ROOT);
+    RteCprjProject* loadedCprjProject = rteKernel.LoadCprj(RteTestM3_ConfigFolder_cprj);
+    ASSERT_NE(loadedCprjProject, nullptr);
+
+    error_code ec;
+    const string rteDir = RteUtils::ExtractFilePath(RteTestM3_cprj, true) + loadedCprjProject->GetRteFolder();
+    for (auto& entry : fs::recursive_directory_iterator(rteDir, ec)) {
+      if (entry.is_regular_file(ec)) {
+        string content;
+        EXPECT_TRUE(RteFsUtils::ReadFile(entry.path().generic_string(), content));
+        rteFiles[i][fs::relative(entry.path(), rteDir, ec).generic_string()] = content;
+      }
+    }
+  }
+  RteProject::SetMaxThreads(0);
+
+  size_t backups = 0;
+  for (auto& [name, _] : rteFiles[0]) {
+    if (name.find(".base@") != string::npos || name.find(".update@") != string::npos) {
+      backups++;
+    }
+  }
+  EXPECT_GT(backups, 4U);
+  EXPECT_EQ(rteFiles[0], rteFiles[1]);
+}
+
 TEST_F(RteModelPrjTest, GetLocalPdscFile) {
   RteKernelSlim rteKernel;
   const string& expectedPdsc = UpdateLocalIndex();
@@ -619,6 +764,20 @@ TEST_F(RteModelPrjTest, GetLocalPdscFile) {
   EXPECT_TRUE(fs::equivalent(pdsc, expectedPdsc, ec));
 }
 
+TEST_F(RteModelPrjTest, GetLocalPdscFiles) {
+  RteKernelSlim rteKernel;
+  const string& expectedPdsc = UpdateLocalIndex();
+
+  map<string, string> pdscFiles;
+  EXPECT_TRUE(rteKernel.GetLocalPdscFiles(localRepoDir, pdscFiles));
+
+  // check returned packId and pdsc
+  ASSERT_EQ(pdscFiles.size(), 1U);
+  EXPECT_EQ(pdscFiles.begin()->first, "LocalVendor::LocalPack@0.1.0");
+  error_code ec;
+  EXPECT_TRUE(fs::equivalent(pdscFiles.begin()->second, expectedPdsc, ec));
+}
+
 TEST_F(RteModelPrjTest, GenerateHeadersTestDefault)
 {
   m_toolInfo = ToolInfo{ "TestExe", "1.0.0" };
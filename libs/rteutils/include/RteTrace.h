@@ -0,0 +1,134 @@
+#ifndef RteTrace_H
+#define RteTrace_H
+/******************************************************************************/
+/* RTE  -  CMSIS Run-Time Environment                                         */
+/******************************************************************************/
+/** @file  RteTrace.h
+  * @brief opt-in collection of timing and allocation events
+*/
+/******************************************************************************/
+/*
+ * Copyright (c) 2023 Arm Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+/******************************************************************************/
+
+#include <cstdint>
+#include <string>
+#include <utility>
+#include <vector>
+
+/**
+ * @brief static class collecting trace events, written in Chrome trace event format
+ *
+ * Tracing is disabled by default, RteTraceScope objects do nothing until Enable() is called.
+ * Allocated bytes are only counted if the application reports allocations via CountAllocation(),
+ * for example from a replacement of the global operator new.
+*/
+class RteTrace
+{
+private:
+  RteTrace() {}; // private constructor to forbid instantiation of a utility class
+
+public:
+  /**
+   * @brief integer event arguments: name and value
+  */
+  typedef std::vector<std::pair<std::string, int64_t> > Args;
+
+  /**
+   * @brief enable or disable event collection, enabling discards collected events and restarts the clock
+   * @param enable true to enable
+  */
+  static void Enable(bool enable);
+
+  /**
+   * @brief check if event collection is enabled
+   * @return true if enabled
+  */
+  static bool IsEnabled();
+
+  /**
+   * @brief get time elapsed since tracing was enabled
+   * @return time in microseconds
+  */
+  static int64_t Now();
+
+  /**
+   * @brief add complete event, does nothing if tracing is disabled
+   * @param category event category
+   * @param name event name
+   * @param start start time in microseconds as returned by Now()
+   * @param duration duration in microseconds
+   * @param args event arguments
+  */
+  static void AddEvent(const std::string& category, const std::string& name, int64_t start, int64_t duration, const Args& args);
+
+  /**
+   * @brief count allocation in the calling thread while tracing is enabled, must not allocate itself
+   * @param size number of allocated bytes
+  */
+  static void CountAllocation(size_t size) noexcept;
+
+  /**
+   * @brief get number of bytes allocated by the calling thread
+   * @return bytes reported by CountAllocation()
+  */
+  static uint64_t GetAllocatedBytes() noexcept;
+
+  /**
+   * @brief get collected events
+   * @return JSON string in Chrome trace event format
+  */
+  static std::string GetChromeTrace();
+
+  /**
+   * @brief write collected events to a file
+   * @param fileName file to write, can be opened in chrome://tracing or Perfetto
+   * @return true if successful
+  */
+  static bool WriteChromeTrace(const std::string& fileName);
+};
+
+/**
+ * @brief scoped timer adding a complete event with allocated bytes on destruction
+*/
+class RteTraceScope
+{
+public:
+  /**
+   * @brief constructor, starts timer if tracing is enabled
+   * @param category event category
+   * @param name event name
+  */
+  RteTraceScope(const char* category, const std::string& name);
+
+  /**
+   * @brief destructor, adds the event
+  */
+  ~RteTraceScope();
+
+  /**
+   * @brief check if the scope is recorded
+   * @return true if tracing was enabled when the scope was created
+  */
+  bool IsEnabled() const { return m_enabled; }
+
+  /**
+   * @brief add integer argument to the event
+   * @param name argument name
+   * @param value argument value
+  */
+  void AddArg(const char* name, int64_t value);
+
+private:
+  bool m_enabled;
+  const char* m_category;
+  std::string m_name;
+  int64_t m_start;
+  uint64_t m_allocated;
+  RteTrace::Args m_args;
+};
+
+#endif // RteTrace_H
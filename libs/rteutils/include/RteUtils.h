@@ -25,6 +25,7 @@
 #include <set>
 #include <vector>
 #include <algorithm>
+#include <functional>
 
 
 class RteUtils
@@ -345,6 +346,12 @@ public:
    * @return XML specification of attributes
   */
   static std::string ToXmlString(const std::map<std::string, std::string>& attributes);
+  /**
+   * @brief calculate 64-bit FNV-1a hash of data
+   * @param data string to be hashed
+   * @return hash as 16 digits hexadecimal string
+  */
+  static std::string GetHash(const std::string& data);
   /**
    * @brief remove duplicate elements from vector without changing the order of elements
    * @param input vector to be processed
@@ -358,6 +365,15 @@ public:
     elemVec.erase(end, elemVec.end());
   }
 
+  /**
+   * @brief execute tasks 0 ... count-1 on worker threads, the calling thread is one of the workers
+   * @param count number of tasks
+   * @param task function executing the task with the given index, tasks must not depend on each other
+   * @param maxThreads maximum number of threads, 0 for the number of hardware threads
+   * @throw first exception thrown by a task, rethrown after all threads have finished
+  */
+  static void RunConcurrently(size_t count, const std::function<void(size_t)>& task, unsigned int maxThreads = 0);
+
   static const std::string EMPTY_STRING;
   static const std::string DASH_STRING;
   static const std::string CRLF_STRING;
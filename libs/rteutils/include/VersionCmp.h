@@ -14,6 +14,7 @@
  */
 /******************************************************************************/
 
+#include <cstdint>
 #include <string>
 #include <set>
 
@@ -170,4 +171,75 @@ public:
   };
 };
 
+/**
+ * @brief parsed version string, compares like VersionCmp::Compare() without parsing the strings again.
+ *
+ * Numeric major.minor.patch segments are packed into a sortable key, so versions without pre-release
+ * part are compared as integers. Only the pre-release part is kept as string, it is compared on demand.
+ * Objects are intended to be created once per version string and cached with the item providing the version.
+*/
+class SemVer
+{
+public:
+  /**
+   * @brief default constructor, equivalent to version "0.0.0"
+  */
+  SemVer();
+
+  /**
+   * @brief constructor, parses version string
+   * @param version version string, build metadata is ignored
+  */
+  explicit SemVer(const std::string& version);
+
+  /**
+   * @brief compare with another version
+   * @param that SemVer to compare with
+   * @param cs true in case of case sensitive comparison
+   * @return same result as VersionCmp::Compare() for the version strings
+  */
+  int Compare(const SemVer& that, bool cs = true) const;
+
+  /**
+   * @brief check if major.minor.patch segments are numeric and packed into a key
+   * @return true if GetKey() is valid
+  */
+  bool HasKey() const { return m_bKey; }
+
+  /**
+   * @brief getter for sortable key of numeric major.minor.patch segments
+   * @return key, 0 if HasKey() returns false
+  */
+  uint64_t GetKey() const { return m_key; }
+
+  /**
+   * @brief get sortable key of a plain numeric version string without parsing it into an object
+   * @param version version string in the form major[.minor[.patch]], build metadata is ignored
+   * @param key returns the key
+   * @return true if the string is a plain numeric version
+  */
+  static bool ParseKey(const std::string& version, uint64_t& key);
+
+  /**
+   * @brief compare keys returned by GetKey() or ParseKey()
+   * @param key1 first key
+   * @param key2 second key
+   * @return 0 if equal, +/-3 if major, +/-2 if minor, +/-1 if patch segment differs
+  */
+  static int CompareKeys(uint64_t key1, uint64_t key2);
+
+protected:
+  static void Split(const std::string& version, std::string& core, std::string& release, bool& bRelease);
+  static void SplitSegments(const std::string& core, std::string segments[3]);
+  static bool IsNumeric(const std::string& segment);
+  static int CompareCores(const std::string& core1, const std::string& core2, bool cs);
+  std::string GetCore() const;
+
+  uint64_t m_key;        // numeric major.minor.patch segments
+  bool m_bKey;
+  bool m_bRelease;
+  std::string m_release; // pre-release part including nested parts
+  std::string m_core;    // major.minor.patch part, only kept if it cannot be packed into a key
+};
+
 #endif // VersionCmp_H
@@ -0,0 +1,188 @@
+/******************************************************************************/
+/* RTE  -  CMSIS Run-Time Environment                                         */
+/******************************************************************************/
+/** @file  RteTrace.cpp
+  * @brief opt-in collection of timing and allocation events
+*/
+/******************************************************************************/
+/*
+ * Copyright (c) 2023 Arm Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+/******************************************************************************/
+
+#include "RteTrace.h"
+
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <fstream>
+#include <mutex>
+#include <sstream>
+
+using namespace std;
+
+namespace {
+  struct TraceEvent {
+    string category;
+    string name;
+    int64_t start;
+    int64_t duration;
+    uint32_t thread;
+    RteTrace::Args args;
+  };
+
+  atomic<bool> s_enabled(false);
+  atomic<uint32_t> s_threadCount(0);
+  chrono::steady_clock::time_point s_startTime = chrono::steady_clock::now();
+  mutex s_mutex;
+  vector<TraceEvent> s_events;
+
+  // plain data only: the counter is updated from operator new
+  thread_local uint64_t s_allocatedBytes = 0;
+
+  uint32_t GetThreadIndex()
+  {
+    thread_local uint32_t index = ++s_threadCount;
+    return index;
+  }
+
+  void WriteJsonString(ostream& os, const string& s)
+  {
+    os << '"';
+    for (char ch : s) {
+      switch (ch) {
+      case '"':  os << "\\\""; break;
+      case '\\': os << "\\\\"; break;
+      case '\n': os << "\\n"; break;
+      case '\r': os << "\\r"; break;
+      case '\t': os << "\\t"; break;
+      default:
+        if ((unsigned char)ch < 0x20) {
+          char buf[8];
+          snprintf(buf, sizeof(buf), "\\u%04x", (unsigned)ch);
+          os << buf;
+        } else {
+          os << ch;
+        }
+      }
+    }
+    os << '"';
+  }
+}
+
+void RteTrace::Enable(bool enable)
+{
+  unique_lock<mutex> lock(s_mutex);
+  if (enable) {
+    s_events.clear();
+    s_startTime = chrono::steady_clock::now();
+  }
+  s_enabled = enable;
+}
+
+bool RteTrace::IsEnabled()
+{
+  return s_enabled.load(memory_order_relaxed);
+}
+
+int64_t RteTrace::Now()
+{
+  return chrono::duration_cast<chrono::microseconds>(chrono::steady_clock::now() - s_startTime).count();
+}
+
+void RteTrace::AddEvent(const string& category, const string& name, int64_t start, int64_t duration, const Args& args)
+{
+  if (!IsEnabled()) {
+    return;
+  }
+  uint32_t thread = GetThreadIndex();
+  unique_lock<mutex> lock(s_mutex);
+  s_events.push_back(TraceEvent{ category, name, start, duration, thread, args });
+}
+
+void RteTrace::CountAllocation(size_t size) noexcept
+{
+  if (s_enabled.load(memory_order_relaxed)) {
+    s_allocatedBytes += size;
+  }
+}
+
+uint64_t RteTrace::GetAllocatedBytes() noexcept
+{
+  return s_allocatedBytes;
+}
+
+string RteTrace::GetChromeTrace()
+{
+  ostringstream os;
+  os << "{\"traceEvents\":[";
+  unique_lock<mutex> lock(s_mutex);
+  for (size_t i = 0; i < s_events.size(); i++) {
+    const TraceEvent& e = s_events[i];
+    os << (i ? ",\n" : "\n") << "{\"name\":";
+    WriteJsonString(os, e.name);
+    os << ",\"cat\":";
+    WriteJsonString(os, e.category);
+    os << ",\"ph\":\"X\",\"ts\":" << e.start << ",\"dur\":" << e.duration << ",\"pid\":1,\"tid\":" << e.thread;
+    if (!e.args.empty()) {
+      os << ",\"args\":{";
+      for (size_t a = 0; a < e.args.size(); a++) {
+        os << (a ? "," : "");
+        WriteJsonString(os, e.args[a].first);
+        os << ':' << e.args[a].second;
+      }
+      os << '}';
+    }
+    os << '}';
+  }
+  os << "\n],\"displayTimeUnit\":\"ms\"}\n";
+  return os.str();
+}
+
+bool RteTrace::WriteChromeTrace(const string& fileName)
+{
+  ofstream file(fileName, ios::binary | ios::trunc);
+  if (!file) {
+    return false;
+  }
+  file << GetChromeTrace();
+  file.close();
+  return !file.fail();
+}
+
+RteTraceScope::RteTraceScope(const char* category, const string& name) :
+  m_enabled(RteTrace::IsEnabled()),
+  m_category(category),
+  m_start(0),
+  m_allocated(0)
+{
+  if (m_enabled) {
+    m_name = name;
+    m_allocated = RteTrace::GetAllocatedBytes();
+    m_start = RteTrace::Now();
+  }
+}
+
+RteTraceScope::~RteTraceScope()
+{
+  if (!m_enabled) {
+    return;
+  }
+  int64_t duration = RteTrace::Now() - m_start;
+  uint64_t allocated = RteTrace::GetAllocatedBytes() - m_allocated;
+  if (allocated) {
+    m_args.emplace_back("allocatedBytes", (int64_t)allocated);
+  }
+  RteTrace::AddEvent(m_category, m_name, m_start, duration, m_args);
+}
+
+void RteTraceScope::AddArg(const char* name, int64_t value)
+{
+  if (m_enabled) {
+    m_args.emplace_back(name, value);
+  }
+}
+
+// End of RteTrace.cpp
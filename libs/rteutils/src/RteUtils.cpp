@@ -15,8 +15,13 @@
 #include "RteUtils.h"
 #include "RteConstants.h"
 
+#include <atomic>
+#include <cstdint>
 #include <cstring>
+#include <exception>
+#include <mutex>
 #include <sstream>
+#include <thread>
 
 using namespace std;
 
@@ -410,6 +415,21 @@ string RteUtils::ToXmlString(const map<string, string>& attributes)
   return s;
 }
 
+string RteUtils::GetHash(const string& data)
+{
+  uint64_t hash = 0xcbf29ce484222325ULL;
+  for (const unsigned char c : data) {
+    hash ^= c;
+    hash *= 0x100000001b3ULL;
+  }
+  static const char* digits = "0123456789abcdef";
+  string s(16, '0');
+  for (int i = 15; i >= 0; i--, hash >>= 4) {
+    s[i] = digits[hash & 0xF];
+  }
+  return s;
+}
+
 string RteUtils::RemoveTrailingBackslash(const string& s) {
   if (s.empty() || (s[s.size() - 1] != '\\' && s[s.size() - 1] != '/')) {
     return s;
@@ -543,4 +563,38 @@ string RteUtils::ConstructID(const std::vector<std::pair<const char*, const std:
   return id;
 }
 
+void RteUtils::RunConcurrently(size_t count, const function<void(size_t)>& task, unsigned int maxThreads) {
+  if (maxThreads == 0) {
+    maxThreads = max(thread::hardware_concurrency(), 1U);
+  }
+  atomic<size_t> next(0);
+  mutex exceptionMutex;
+  exception_ptr exception;
+  const auto worker = [&]() {
+    for (size_t i = next++; i < count; i = next++) {
+      try {
+        task(i);
+      }
+      catch (...) {
+        lock_guard<mutex> lock(exceptionMutex);
+        if (!exception) {
+          exception = current_exception();
+        }
+      }
+    }
+  };
+  const size_t numThreads = min<size_t>(maxThreads, count);
+  vector<thread> threads;
+  for (size_t i = 1; i < numThreads; i++) {
+    threads.emplace_back(worker);
+  }
+  worker();
+  for (auto& t : threads) {
+    t.join();
+  }
+  if (exception) {
+    rethrow_exception(exception);
+  }
+}
+
 // End of RteUtils.cpp
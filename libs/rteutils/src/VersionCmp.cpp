@@ -154,6 +154,11 @@ int VersionCmp::Compare(const string& v1, const string& v2, bool cs) {
   if (v1 == v2) {
     return 0;
   }
+  // plain numeric versions are compared without splitting them into segments
+  uint64_t key1, key2;
+  if (SemVer::ParseKey(v1, key1) && SemVer::ParseKey(v2, key2)) {
+    return SemVer::CompareKeys(key1, key2);
+  }
   // Split v1 and v2 according to http://semver.org/ and compare individually
   Version ver1(v1);
   Version ver2(v2);
@@ -328,4 +333,181 @@ int VersionCmp::ComparatorBase::Compare(const std::string& v1, const std::string
   return VersionCmp::Compare(v1, v2, cs);
 }
 
+static constexpr unsigned KEY_BITS = 21; // bits per segment in a key
+static constexpr uint64_t KEY_MASK = (1ULL << KEY_BITS) - 1;
+static constexpr size_t KEY_DIGITS = 6;   // max digits per segment, 999999 fits into KEY_BITS
+
+SemVer::SemVer() :
+  m_key(0),
+  m_bKey(true),
+  m_bRelease(false)
+{
+}
+
+SemVer::SemVer(const string& version) :
+  m_key(0),
+  m_bKey(true),
+  m_bRelease(false)
+{
+  string core;
+  Split(version.substr(0, MAX_BUF - 2), core, m_release, m_bRelease);
+  string segments[3];
+  SplitSegments(core, segments);
+  for (auto& segment : segments) {
+    uint64_t number = IsNumeric(segment) ? (uint64_t)atoi(segment.c_str()) : KEY_MASK + 1;
+    if (number > KEY_MASK) {
+      m_bKey = false;
+      m_key = 0;
+      m_core = core;
+      break;
+    }
+    m_key = (m_key << KEY_BITS) | number;
+  }
+}
+
+// same steps as Version::init() and Version::parse()
+void SemVer::Split(const string& version, string& core, string& release, bool& bRelease)
+{
+  core = version;
+  // 1. drop build metadata
+  string::size_type pos = core.find('+');
+  if (pos != string::npos) {
+    core.erase(pos);
+  }
+  // 2. extract release
+  bRelease = false;
+  pos = core.find('-');
+  if (pos != string::npos) {
+    release = core.substr(pos + 1);
+    core.erase(pos);
+    bRelease = true;
+    return;
+  }
+  // check for special ST case without dash like 1.2.3b < 1.2.3
+  for (size_t i = core.size(); i > 0; i--) {
+    char ch = core[i - 1];
+    if (ch == '.')
+      break;
+    if (!isdigit((unsigned char)ch))
+      continue;
+    if (i < core.size()) {
+      release = core.substr(i);
+      core.erase(i);
+      bRelease = true;
+    }
+    break;
+  }
+}
+
+// 3. split segments, missing ones are "0" and further ones are ignored
+void SemVer::SplitSegments(const string& core, string segments[3])
+{
+  bool bMore = true;
+  string::size_type pos = 0;
+  for (int i = 0; i < 3; i++) {
+    if (bMore && pos < core.size()) {
+      string::size_type dot = core.find('.', pos);
+      bMore = dot != string::npos;
+      segments[i] = core.substr(pos, bMore ? dot - pos : string::npos);
+      pos = bMore ? dot + 1 : core.size();
+    } else {
+      segments[i] = ZERO_STRING;
+    }
+  }
+}
+
+bool SemVer::IsNumeric(const string& segment)
+{
+  return !segment.empty() && segment.size() <= 9 && segment.find_first_not_of("0123456789") == string::npos;
+}
+
+int SemVer::CompareCores(const string& core1, const string& core2, bool cs)
+{
+  string segments1[3], segments2[3];
+  SplitSegments(core1, segments1);
+  SplitSegments(core2, segments2);
+  int result = 3;
+  for (int i = 0; i < 3; i++, result--) {
+    const string& s1 = segments1[i];
+    const string& s2 = segments2[i];
+    int res;
+    if (IsNumeric(s1) && IsNumeric(s2)) {
+      res = atoi(s1.c_str()) - atoi(s2.c_str());
+    } else {
+      res = AlnumCmp::Compare(s1.c_str(), s2.c_str(), cs);
+    }
+    if (res != 0)
+      return res > 0 ? result : -result;
+  }
+  return 0;
+}
+
+// numeric segments compare like the original text, leading zeros do not matter
+string SemVer::GetCore() const
+{
+  if (!m_bKey) {
+    return m_core;
+  }
+  return to_string((m_key >> (2 * KEY_BITS)) & KEY_MASK) + '.' + to_string((m_key >> KEY_BITS) & KEY_MASK) + '.' +
+    to_string(m_key & KEY_MASK);
+}
+
+int SemVer::Compare(const SemVer& that, bool cs) const
+{
+  int res = m_bKey && that.m_bKey ? CompareKeys(m_key, that.m_key) : CompareCores(GetCore(), that.GetCore(), cs);
+  if (res != 0) {
+    return res;
+  }
+  // a version without pre-release part is greater, pre-release parts are compared case-insensitive
+  if (!m_bRelease || !that.m_bRelease) {
+    return m_bRelease == that.m_bRelease ? 0 : (m_bRelease ? -1 : 1);
+  }
+  res = VersionCmp::Compare(m_release, that.m_release, false);
+  return res > 0 ? 1 : (res < 0 ? -1 : 0);
+}
+
+bool SemVer::ParseKey(const string& version, uint64_t& key)
+{
+  uint64_t segments[3] = { 0, 0, 0 };
+  int segment = 0;
+  size_t digits = 0;
+  for (char ch : version) {
+    if (ch == '+') {
+      break; // build metadata
+    }
+    if (ch >= '0' && ch <= '9') {
+      if (++digits > KEY_DIGITS) {
+        return false;
+      }
+      segments[segment] = segments[segment] * 10 + (ch - '0');
+    } else if (ch == '.' && digits > 0 && segment < 2) {
+      segment++;
+      digits = 0;
+    } else {
+      return false;
+    }
+  }
+  if (digits == 0) {
+    return false;
+  }
+  key = (segments[0] << (2 * KEY_BITS)) | (segments[1] << KEY_BITS) | segments[2];
+  return true;
+}
+
+int SemVer::CompareKeys(uint64_t key1, uint64_t key2)
+{
+  if (key1 == key2) {
+    return 0;
+  }
+  int result = 3;
+  for (int shift = 2 * KEY_BITS; shift >= 0; shift -= KEY_BITS, result--) {
+    uint64_t s1 = (key1 >> shift) & KEY_MASK;
+    uint64_t s2 = (key2 >> shift) & KEY_MASK;
+    if (s1 != s2) {
+      return s1 > s2 ? result : -result;
+    }
+  }
+  return 0;
+}
+
 // End of VersionCmp.cpp
@@ -3,10 +3,13 @@
  *
  * SPDX-License-Identifier: Apache-2.0
  */
+#include "RteTrace.h"
 #include "RteUtils.h"
 
 #include "gtest/gtest.h"
 
+#include <stdexcept>
+
 using namespace std;
 
 
@@ -391,4 +394,61 @@ TEST(RteUtils, ReplaceAll)
   RteUtils::ReplaceAll(replaced, "&", "&&");
   EXPECT_EQ(replaced, expected);
 }
+
+TEST(RteUtils, GetHash)
+{
+  EXPECT_EQ("cbf29ce484222325", RteUtils::GetHash(""));
+  EXPECT_EQ("af63dc4c8601ec8c", RteUtils::GetHash("a"));
+  EXPECT_EQ("85944171f73967e8", RteUtils::GetHash("foobar"));
+  EXPECT_NE(RteUtils::GetHash("foo"), RteUtils::GetHash("bar"));
+}
+
+TEST(RteUtils, RunConcurrently)
+{
+  for (unsigned int maxThreads : { 0U, 1U, 4U }) {
+    vector<int> executed(1000, 0);
+    RteUtils::RunConcurrently(executed.size(), [&](size_t i) { executed[i]++; }, maxThreads);
+    EXPECT_EQ(vector<int>(executed.size(), 1), executed);
+  }
+
+  bool called = false;
+  RteUtils::RunConcurrently(0, [&](size_t) { called = true; });
+  EXPECT_FALSE(called);
+
+  // a failing task does not stop the other tasks, its exception is rethrown
+  vector<int> executed(100, 0);
+  EXPECT_THROW(RteUtils::RunConcurrently(executed.size(), [&](size_t i) {
+    executed[i]++;
+    if (i == 42) {
+      throw runtime_error("task failed");
+    }
+  }), runtime_error);
+  EXPECT_EQ(vector<int>(executed.size(), 1), executed);
+}
+
+TEST(RteUtils, Trace)
+{
+  RteTrace::Enable(false);
+  {
+    RteTraceScope scope("test", "disabled");
+    EXPECT_FALSE(scope.IsEnabled());
+    // allocations are not counted while tracing is disabled
+    const uint64_t allocated = RteTrace::GetAllocatedBytes();
+    RteTrace::CountAllocation(100);
+    EXPECT_EQ(allocated, RteTrace::GetAllocatedBytes());
+  }
+  RteTrace::Enable(true);
+  {
+    RteTraceScope scope("test", R"(C:\Packs\"my".pdsc)");
+    EXPECT_TRUE(scope.IsEnabled());
+    scope.AddArg("items", 42);
+    RteTrace::CountAllocation(100);
+  }
+  RteTrace::Enable(false);
+  const string trace = RteTrace::GetChromeTrace();
+  EXPECT_EQ(trace.find("disabled"), string::npos);
+  EXPECT_NE(trace.find(R"({"name":"C:\\Packs\\\"my\".pdsc","cat":"test","ph":"X",)"), string::npos);
+  EXPECT_NE(trace.find(R"("args":{"items":42,"allocatedBytes":100}})"), string::npos);
+}
+
 // end of RteUtilsTest.cpp
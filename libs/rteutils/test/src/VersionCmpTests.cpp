@@ -7,6 +7,9 @@
 
 #include "gtest/gtest.h"
 
+#include <algorithm>
+#include <random>
+
 using namespace std;
 
 TEST(VersionCmpTest, VersionMatchMode) {
@@ -152,4 +155,60 @@ TEST(VersionCmpTest, ComparatorBase) {
   EXPECT_EQ(-2, comparator1.Compare("Test@1.1.0", "Test@1.2.0"));
   EXPECT_EQ(1, comparator1.Compare("Foo@1.1.0", "Bar@1.2.0"));
 }
+
+TEST(VersionCmpTest, SemVerCompare) {
+  const vector<string> versions = { "", "0", "1", "1.2", "1.2.3", "1.2.3.4", "01.2.3", "1..3", "1.2.",
+    "6.5.0", "6.5.0-", "6.5.0-a", "6.5.0-A", "6.5.0-B", "6.5.0-a+b", "6.5.0+b", "6.5.0-rc.1", "6.5.0-rc.10",
+    "6.5.0-rc-2", "6.5.0-RC.1", "6.5.0-rc.1.2", "6.5.0-rc.1b", "6.5.0-1.x", "1.2.3b", "1.2.3B", "1.2b", "Test", "v1.2.3",
+    "1000000.0.0", "2097151.0.0", "2097152.0.0", "123456789.0.0", "1.2.34567890123", "1.x.3", "1.X.3-rc" };
+  for (auto& v1 : versions) {
+    SemVer s1(v1);
+    for (auto& v2 : versions) {
+      SemVer s2(v2);
+      EXPECT_EQ(VersionCmp::Compare(v1, v2), s1.Compare(s2)) << v1 << " <=> " << v2;
+      EXPECT_EQ(VersionCmp::Compare(v1, v2, false), s1.Compare(s2, false)) << v1 << " <=> " << v2;
+    }
+  }
+  EXPECT_TRUE(SemVer("1.2.3").HasKey());
+  EXPECT_EQ(SemVer("1.2.3-rc").GetKey(), SemVer("1.2.3").GetKey()); // pre-release is compared separately
+  EXPECT_EQ(-1, SemVer("1.2.3-rc").Compare(SemVer("1.2.3")));
+  EXPECT_FALSE(SemVer("1.x.3").HasKey());
+  EXPECT_EQ(0, SemVer().Compare(SemVer("0.0.0")));
+
+  uint64_t key1 = 0, key2 = 0;
+  EXPECT_TRUE(SemVer::ParseKey("1.2.3+meta", key1));
+  EXPECT_TRUE(SemVer::ParseKey("1.10", key2));
+  EXPECT_EQ(-2, SemVer::CompareKeys(key1, key2));
+  EXPECT_FALSE(SemVer::ParseKey("1.2.3-rc", key1));
+  EXPECT_FALSE(SemVer::ParseKey("1.2.3.4", key1));
+  EXPECT_FALSE(SemVer::ParseKey("1.2.", key1));
+  EXPECT_FALSE(SemVer::ParseKey("", key1));
+}
+
+TEST(VersionCmpTest, SemVerSort) {
+  // pack versions, every fifth one with a pre-release part
+  mt19937 rnd(1);
+  vector<string> versions;
+  for (int i = 0; i < 2000; i++) {
+    string v = to_string(rnd() % 5) + "." + to_string(rnd() % 10) + "." + to_string(rnd() % 20);
+    if (i % 5 == 0) {
+      v += (rnd() % 2 ? "-rc" : "-dev") + to_string(rnd() % 10);
+    }
+    versions.push_back(v);
+  }
+  vector<string> sortedStrings = versions;
+  stable_sort(sortedStrings.begin(), sortedStrings.end(), VersionCmp::Less());
+
+  vector<pair<SemVer, const string*> > parsed;
+  for (auto& v : versions) {
+    parsed.emplace_back(SemVer(v), &v);
+  }
+  stable_sort(parsed.begin(), parsed.end(), [](const auto& a, const auto& b) {
+    return a.first.Compare(b.first) < 0;
+  });
+  ASSERT_EQ(sortedStrings.size(), parsed.size());
+  for (size_t i = 0; i < parsed.size(); i++) {
+    EXPECT_EQ(sortedStrings[i], *parsed[i].second);
+  }
+}
 // end of VersionCmpTest.cpp
@@ -19,6 +19,15 @@ public:
      * @return true if validation pass, otherwise false
     */
     static bool Validate(const std::string& xmlfile, const std::string& schemafile);
+
+    /**
+     * @brief Validates the xml content with respect to schema given
+     * @param xmlfile name the content is reported with, the file does not need to exist
+     * @param xmlstring input xml content to be validated, the file is read if empty
+     * @param schemafile input schema file for given xml content
+     * @return true if validation pass, otherwise false
+    */
+    static bool Validate(const std::string& xmlfile, const std::string& xmlstring, const std::string& schemafile);
 };
 
 #endif //XMLCHECKER_H
@@ -12,3 +12,9 @@ bool XmlChecker::Validate(const std::string& xmlfile, const std::string& schemaf
   XmlValidator* validator = new XmlValidator();
   return validator->Validate(xmlfile, schemafile);
 }
+
+bool XmlChecker::Validate(const std::string& xmlfile, const std::string& xmlstring, const std::string& schemafile)
+{
+  XmlValidator* validator = new XmlValidator();
+  return validator->Validate(xmlfile, xmlstring, schemafile);
+}
@@ -10,6 +10,7 @@
 
 #include "xercesc/parsers/XercesDOMParser.hpp"
 #include "xercesc/framework/LocalFileInputSource.hpp"
+#include "xercesc/framework/MemBufInputSource.hpp"
 #include "xercesc/sax/ErrorHandler.hpp"
 #include "xercesc/sax/SAXParseException.hpp"
 
@@ -47,12 +48,29 @@ XmlValidator::~XmlValidator()
  * @return passed / failed
  */
 bool XmlValidator::Validate(const string& xmlFile, const string& schemaFile)
+{
+  return Validate(xmlFile, string(), schemaFile);
+}
+
+/**
+ * @brief Validate xml content against the specified schema file
+ * @param xmlFile name the content is reported with, read if xmlString is empty
+ * @param xmlString the xml content to validate
+ * @param schemaFile the schema file to validate against
+ * @return passed / failed
+ */
+bool XmlValidator::Validate(const string& xmlFile, const string& xmlString, const string& schemaFile)
 {
   LogMsg("M084");
 
   try {
     m_domParser->setExternalNoNamespaceSchemaLocation(schemaFile.c_str());
-    m_domParser->parse(xmlFile.c_str());
+    if (xmlString.empty()) {
+      m_domParser->parse(xmlFile.c_str());
+    } else {
+      MemBufInputSource source(reinterpret_cast<const XMLByte*>(xmlString.data()), xmlString.size(), xmlFile.c_str());
+      m_domParser->parse(source);
+    }
 
     auto errCnt = m_domParser->getErrorCount();
 
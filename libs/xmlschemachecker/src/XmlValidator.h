@@ -17,6 +17,7 @@ public:
     ~XmlValidator();
 
     bool Validate(const std::string& xmlFile, const std::string& schemaFile);
+    bool Validate(const std::string& xmlFile, const std::string& xmlString, const std::string& schemaFile);
 
 private:
     xercesc::XercesDOMParser* m_domParser;
@@ -66,7 +66,7 @@ public:
   virtual std::string GetIndentString(int level) const;
 
 protected:
-  virtual void FormatXmlElement(std::ostringstream& outStream, XMLTreeElement* element, int level = 0) {}; // default does nothing
+  virtual void FormatXmlElement(std::ostream& outStream, XMLTreeElement* element, int level = 0) {}; // default does nothing
   static void CollectSortedChildren(XMLTreeElement* element, std::vector< std::pair<std::string, std::vector<XMLTreeElement*> > >& sortedChildren);
 
 protected:
@@ -21,10 +21,10 @@ public:
   JsonFormatter();
 
 protected:
-  void FormatXmlElement(std::ostringstream& outStream, XMLTreeElement* element, int level=0  ) override;
-  void FormatXmlElementBody(std::ostringstream& outStream, XMLTreeElement* element, int level, bool outputTag);
+  void FormatXmlElement(std::ostream& outStream, XMLTreeElement* element, int level=0  ) override;
+  void FormatXmlElementBody(std::ostream& outStream, XMLTreeElement* element, int level, bool outputTag);
 
-  void FormatXmlElements(std::ostringstream& outStream, const std::string& tag, const std::vector<XMLTreeElement*>& elements, int level);
+  void FormatXmlElements(std::ostream& outStream, const std::string& tag, const std::vector<XMLTreeElement*>& elements, int level);
 };
 
 #endif /* JSONFORMATTER_H */
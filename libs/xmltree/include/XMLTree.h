@@ -270,6 +270,15 @@ public:
   */
   bool AddFileName(const std::string& fileName, bool bParse = false);
 
+  /**
+   * @brief add a XML document given as string to the list of files in the instance,
+   *        ParseAll() parses the string and associates the document with the file name
+   * @param fileName file name to associate the document with, the file does not need to exist
+   * @param xmlString XML document
+   * @return true if file name and document are not empty
+  */
+  bool AddXmlString(const std::string& fileName, const std::string& xmlString);
+
   /**
    * @brief setter for list of XML files to be parsed
    * @param fileNames list of XML files
@@ -391,6 +400,7 @@ protected:
   std::string m_schemaFile; // schema file with path
 
   std::list<std::string> m_fileNames; // XML files to parse
+  std::map<std::string, std::string> m_xmlStrings; // documents of files given as string
   // errors for all docs
   std::list<std::string> m_errorStrings;
   int m_nErrors;
@@ -30,6 +30,8 @@ public:
   */
   XmlFormatter(XMLTree* xmlTree, const std::string& schemaFile, const std::string& schemaVersion, bool bInsertEmptyLines = true);
 
+  using AbstractFormatter::Format;
+
   /**
    * @brief generate XML formatted text
    * @param parentElement pointer to an instance of type XMLTreeElement
@@ -41,6 +43,27 @@ public:
     const std::string& schemaFile = XmlItem::EMPTY_STRING,
     const std::string& schemaVersion = XmlItem::EMPTY_STRING) override;
 
+  /**
+   * @brief write XML formatted text to a stream without building it in memory
+   * @param xmlStream output stream, e.g. a file stream
+   * @param xmlTree pointer to a XMLTree object
+   * @param schemaFile name of XML schema file
+   * @param schemaVersion version of XML schema file
+   * @return true if XML tree has a root element
+  */
+  bool Format(std::ostream& xmlStream, XMLTree* xmlTree, const std::string& schemaFile, const std::string& schemaVersion);
+
+  /**
+   * @brief write XML formatted text to a stream without building it in memory
+   * @param xmlStream output stream, e.g. a file stream
+   * @param rootElement pointer to an instance of type XMLTreeElement
+   * @param schemaFile name of XML schema file
+   * @param schemaVersion version of XML schema file
+   * @return true if rootElement is not nullptr
+  */
+  bool FormatElement(std::ostream& xmlStream, XMLTreeElement* rootElement,
+    const std::string& schemaFile = XmlItem::EMPTY_STRING,
+    const std::string& schemaVersion = XmlItem::EMPTY_STRING);
 
   /**
   * @brief convert special characters to conformed ones
@@ -56,10 +79,17 @@ public:
   */
   static std::string ConvertSpecialChars(const std::string& input);
 
+  /**
+   * @brief write string to a stream converting special characters to XML conformed ones
+   * @param xmlStream output stream
+   * @param input string to be converted
+  */
+  static void WriteSpecialChars(std::ostream& xmlStream, const std::string& input);
+
   static const std::string XMLHEADER;
 
 protected:
-  void FormatXmlElement(std::ostringstream& xmlStream, XMLTreeElement* element, int level=0) override;
+  void FormatXmlElement(std::ostream& xmlStream, XMLTreeElement* element, int level=0) override;
 
   bool m_bInsertEmptyLines;
 };
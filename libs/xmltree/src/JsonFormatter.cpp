@@ -16,7 +16,7 @@ using namespace std;
 JsonFormatter::JsonFormatter() {
 }
 
-void JsonFormatter::FormatXmlElement(ostringstream& outStream, XMLTreeElement* element, int level)
+void JsonFormatter::FormatXmlElement(ostream& outStream, XMLTreeElement* element, int level)
 {
   if (!element) {
     return;
@@ -28,7 +28,7 @@ void JsonFormatter::FormatXmlElement(ostringstream& outStream, XMLTreeElement* e
   outStream << EOL_STRING  << '}' << EOL_STRING;
 }
 
- void JsonFormatter::FormatXmlElementBody(ostringstream & outStream, XMLTreeElement* element, int level, bool outputTag)
+ void JsonFormatter::FormatXmlElementBody(ostream & outStream, XMLTreeElement* element, int level, bool outputTag)
  {
 
   string indent = GetIndentString(level);
@@ -86,7 +86,7 @@ void JsonFormatter::FormatXmlElement(ostringstream& outStream, XMLTreeElement* e
 }
 
 
-void JsonFormatter::FormatXmlElements(ostringstream& outStream, const string& tag, const std::vector<XMLTreeElement*>& elements, int level)
+void JsonFormatter::FormatXmlElements(ostream& outStream, const string& tag, const std::vector<XMLTreeElement*>& elements, int level)
 {
   if (elements.empty()) {
     return;
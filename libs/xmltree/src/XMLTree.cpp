@@ -88,6 +88,7 @@ void XMLTree::Clear() // does not destroy XML parser!
   m_nWarnings = 0;
   m_errorStrings.clear();
   m_fileNames.clear();
+  m_xmlStrings.clear();
   XMLTreeElement::Clear();
 }
 
@@ -137,6 +138,16 @@ bool XMLTree::AddFileName(const string& fileName, bool bParse)
   return true;
 }
 
+bool XMLTree::AddXmlString(const string& fileName, const string& xmlString)
+{
+  if (fileName.empty() || xmlString.empty())
+    return false;
+  if (!AddFileName(fileName))
+    return false;
+  m_xmlStrings[fileName] = xmlString;
+  return true;
+}
+
 bool XMLTree::SetFileNames(const list<string>& fileNames, bool bParse)
 {
   m_fileNames = fileNames;
@@ -159,7 +170,8 @@ bool XMLTree::ParseAll()
   m_p->Clear();
   // parse all documents
   for (list<string>::iterator it = m_fileNames.begin(); it != m_fileNames.end(); it++) {
-    bool ok = DoParse(*it, EMPTY_STRING);
+    auto itString = m_xmlStrings.find(*it);
+    bool ok = DoParse(*it, itString != m_xmlStrings.end() ? itString->second : EMPTY_STRING);
     if (!ok)
       success = false;
     if (m_callback) {
@@ -9,6 +9,7 @@
 
 #include <list>
 #include <map>
+#include <sstream>
 
 using namespace std;
 
@@ -32,9 +33,24 @@ XmlFormatter::XmlFormatter(XMLTree* xmlTree, const string& schemaFile, const str
 
 string XmlFormatter::FormatElement(XMLTreeElement* rootElement, const string& schemaFile, const string& schemaVersion)
 {
-  if (!rootElement) {
+  ostringstream xmlStream;
+  if (!FormatElement(xmlStream, rootElement, schemaFile, schemaVersion)) {
     return XMLTree::EMPTY_STRING;
   }
+  return xmlStream.str();
+}
+
+bool XmlFormatter::Format(ostream& xmlStream, XMLTree* xmlTree, const string& schemaFile, const string& schemaVersion)
+{
+  XMLTreeElement* rootElement = xmlTree && xmlTree->GetRoot() ? xmlTree->GetRoot()->GetFirstChild() : nullptr;
+  return FormatElement(xmlStream, rootElement, schemaFile, schemaVersion);
+}
+
+bool XmlFormatter::FormatElement(ostream& xmlStream, XMLTreeElement* rootElement, const string& schemaFile, const string& schemaVersion)
+{
+  if (!rootElement) {
+    return false;
+  }
   // Add xml header attributes
   if (!schemaFile.empty()) {
     rootElement->AddAttribute(SCHEMAATTR, SCHEMAINSTANCE);
@@ -42,27 +58,26 @@ string XmlFormatter::FormatElement(XMLTreeElement* rootElement, const string& sc
     rootElement->AddAttribute(VERSIONATTR, schemaVersion);
   }
   // Format elements recursively
-  ostringstream xmlStream;
   xmlStream << XMLHEADER << EOL_STRING;
   FormatXmlElement(xmlStream, rootElement);
-  return xmlStream.str();
+  return true;
 }
 
 
-void XmlFormatter::FormatXmlElement(ostringstream& xmlStream, XMLTreeElement* element, int level)
+void XmlFormatter::FormatXmlElement(ostream& xmlStream, XMLTreeElement* element, int level)
 {
   if(!element) {
     return;
   }
-  string indent = GetIndentString(level);
+  const string indent = GetIndentString(level);
 
   const string& tag = element->GetTag();
   const string& text = element->GetText();
-  xmlStream << indent + '<' << tag;
-  map<string, string> attributes = element->GetAttributes();
-  for (auto attribute : attributes) {
-    xmlStream << ' ';
-    xmlStream << attribute.first << "=\"" << EscapeSpecialChars(attribute.second) << "\"";
+  xmlStream << indent << '<' << tag;
+  for (auto& [name, value] : element->GetAttributes()) {
+    xmlStream << ' ' << name << "=\"";
+    WriteSpecialChars(xmlStream, value);
+    xmlStream << '"';
   }
   if (element->HasChildren()) {
     auto& children = element->GetChildren();
@@ -76,27 +91,56 @@ void XmlFormatter::FormatXmlElement(ostringstream& xmlStream, XMLTreeElement* el
     }
     xmlStream << indent << "</" << tag << ">" << EOL_STRING;
   } else if (!text.empty()) {
-    xmlStream << '>' << EscapeSpecialChars(text) << "</" << tag << ">" << EOL_STRING;
+    xmlStream << '>';
+    WriteSpecialChars(xmlStream, text);
+    xmlStream << "</" << tag << ">" << EOL_STRING;
   } else {
     xmlStream << "/>" << EOL_STRING;
   }
 }
 
+static const char* GetSpecialCharEntity(char c)
+{
+  switch (c) {
+  case '&':  return "&amp;";
+  case '<':  return "&lt;";
+  case '>':  return "&gt;";
+  case '\'': return "&apos;";
+  case '"':  return "&quot;";
+  default:   return nullptr;
+  }
+}
+
+static const char* SPECIAL_CHARS = "&<>'\"";
+
 string XmlFormatter::ConvertSpecialChars(const string& input)
 {
-  if(input.empty()) {
+  size_t pos = input.find_first_of(SPECIAL_CHARS);
+  if (pos == string::npos) {
     return input;
   }
-
-  const map<string, string> SpecialChars = {{"&amp;","&"},{"&lt;","<"},{"&gt;",">"}, {"&apos;","\'"}, {"&quot;","\""}};
-  size_t s;
-  string str(input);
-  for (auto sc : SpecialChars) {
-    s = 0;
-    while ((s = str.find(sc.second, s)) != string::npos) {
-      str.replace(s, sc.second.length(), sc.first);
-      s += sc.first.length();
+  string str = input.substr(0, pos);
+  str.reserve(input.size() + 16);
+  for (; pos < input.size(); pos++) {
+    const char* entity = GetSpecialCharEntity(input[pos]);
+    if (entity) {
+      str += entity;
+    } else {
+      str += input[pos];
     }
   }
   return str;
 }
+
+void XmlFormatter::WriteSpecialChars(ostream& xmlStream, const string& input)
+{
+  // write runs of regular characters at once
+  size_t start = 0;
+  size_t pos;
+  while ((pos = input.find_first_of(SPECIAL_CHARS, start)) != string::npos) {
+    xmlStream.write(input.data() + start, pos - start);
+    xmlStream << GetSpecialCharEntity(input[pos]);
+    start = pos + 1;
+  }
+  xmlStream.write(input.data() + start, input.size() - start);
+}
@@ -121,3 +121,30 @@ TEST(XMLFormatterTest, HeaderAndContentTest)
   string xmlContent = xmlFormatter.GetContent();
   EXPECT_EQ(xmlResExpected, xmlContent);
 }
+
+TEST(XMLFormatterTest, StreamAndSpecialCharsTest)
+{
+  auto tree = make_unique<XMLTreeDummy>();
+  XMLTreeElement* cprj = tree->CreateElement("cprj");
+  XMLTreeElement* info = cprj->CreateElement("info");
+  info->SetText("a < b && c > 'd' \"e\"");
+  info->AddAttribute("attr", "<&>");
+
+  const string expected = XmlFormatter::XMLHEADER + "\n" +
+    "<cprj>\n" +
+    "  <info attr=\"&lt;&amp;&gt;\">a &lt; b &amp;&amp; c &gt; &apos;d&apos; &quot;e&quot;</info>\n" +
+    "</cprj>\n";
+
+  ostringstream xmlStream;
+  XmlFormatter xmlFormatter;
+  EXPECT_TRUE(xmlFormatter.Format(xmlStream, tree.get(), XmlItem::EMPTY_STRING, XmlItem::EMPTY_STRING));
+  EXPECT_EQ(expected, xmlStream.str());
+  EXPECT_EQ(expected, xmlFormatter.Format(tree.get(), XmlItem::EMPTY_STRING, XmlItem::EMPTY_STRING));
+
+  EXPECT_EQ("plain text", XmlFormatter::ConvertSpecialChars("plain text"));
+  EXPECT_EQ("&amp;amp;&lt;&gt;&apos;&quot;", XmlFormatter::ConvertSpecialChars("&amp;<>'\""));
+
+  ostringstream emptyStream;
+  EXPECT_FALSE(xmlFormatter.Format(emptyStream, nullptr, XmlItem::EMPTY_STRING, XmlItem::EMPTY_STRING));
+  EXPECT_TRUE(emptyStream.str().empty());
+}
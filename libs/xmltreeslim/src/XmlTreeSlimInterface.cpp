@@ -10,6 +10,7 @@
 #include "XmlTreeSlimInterface.h"
 
 #include "ErrLog.h"
+#include "RteTrace.h"
 
 #include <sstream>
 
@@ -65,6 +66,7 @@ XMLTreeSlimInterface::XMLTreeSlimInterface(XMLTree* tree, bool bRedirectErrLog,
   m_pXmlReader(nullptr),
   m_bIgnoreAttributePrefixes(bIgnoreAttributePrefixes),
   recursion(0),
+  m_nElements(0),
   m_errConsumer(0)
 {
   InitMessageTable();
@@ -103,11 +105,13 @@ void XMLTreeSlimInterface::Clear() // does not destroy XML parser!
 
 bool XMLTreeSlimInterface::Parse(const std::string& fileName, const std::string& xmlString)
 {
+  RteTraceScope trace("xml", fileName);
   XmlTypes::XmlNode_t node;
   bool ret = false;
   m_errorStrings.clear();
   m_nErrors = 0;
   m_nWarnings = 0;
+  m_nElements = 0;
 
   ErrLog::Get()->SetFileName(fileName);
   IErrConsumer* prevConsumer = ErrLog::Get()->GetErrConsumer();
@@ -140,6 +144,7 @@ bool XMLTreeSlimInterface::Parse(const std::string& fileName, const std::string&
   ErrLog::Get()->SetFileName("");
 
   m_xmlFile = "";
+  trace.AddArg("items", m_nElements);
   return ret;
 }
 
@@ -182,6 +187,7 @@ bool XMLTreeSlimInterface::DoParseElement(XmlTypes::XmlNode_t& elementNode)
   XmlTypes::XmlNode_t node;
 
   recursion++;
+  m_nElements++;
 
   IXmlItemBuilder* builder = m_tree->GetXmlItemBuilder();
 
@@ -67,6 +67,7 @@ private:
   XML_Reader* m_pXmlReader;
   bool m_bIgnoreAttributePrefixes;
   int recursion;
+  size_t m_nElements;
 
   IErrConsumer* m_errConsumer;
 
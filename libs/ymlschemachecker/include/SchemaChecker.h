@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2020-2021 Arm Limited. All rights reserved.
+ * Copyright (c) 2020-2023 Arm Limited. All rights reserved.
  *
  * SPDX-License-Identifier: Apache-2.0
  */
@@ -9,6 +9,8 @@
 
 #include "SchemaError.h"
 
+#include "yaml-cpp/yaml.h"
+
 #include <string>
 
 class SchemaChecker {
@@ -24,6 +26,19 @@ public:
   static bool Validate(const std::string& datafile,
                        const std::string& schemafile,
                        SchemaErrors& errList);
+
+  /**
+   * @brief Validates already loaded yaml data with respect to schema given
+   * @param data yaml data loaded from data file
+   * @param datafile path of the data file, used for error messages
+   * @param schemafile input schema file defines the structure of yaml
+   * @param errList list of errors found in data
+   * @return true if validation pass, otherwise false
+  */
+  static bool Validate(const YAML::Node& data,
+                       const std::string& datafile,
+                       const std::string& schemafile,
+                       SchemaErrors& errList);
 };
 
 #endif // SCHEMACHECKER_H
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2020-2021 Arm Limited. All rights reserved.
+ * Copyright (c) 2020-2023 Arm Limited. All rights reserved.
  *
  * SPDX-License-Identifier: Apache-2.0
  */
@@ -13,3 +13,11 @@ bool SchemaChecker::Validate(const std::string& datafile,
   SchemaValidator validator(datafile, schemafile);
   return validator.Validate(errList);
 }
+
+bool SchemaChecker::Validate(const YAML::Node& data,
+  const std::string& datafile, const std::string& schemafile,
+  SchemaErrors& errList)
+{
+  SchemaValidator validator(datafile, schemafile);
+  return validator.Validate(data, errList);
+}
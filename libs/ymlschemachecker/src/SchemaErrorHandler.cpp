@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2020-2021 Arm Limited. All rights reserved.
+ * Copyright (c) 2020-2023 Arm Limited. All rights reserved.
  *
  * SPDX-License-Identifier: Apache-2.0
  */
@@ -12,9 +12,9 @@
 
 using namespace std;
 
-CustomErrorHandler::CustomErrorHandler(const std::string& filePath) {
+CustomErrorHandler::CustomErrorHandler(const std::string& filePath, const YAML::Node& yamlData) {
   m_yamlFile = filePath;
-  m_yamlData = YAML::LoadFile(m_yamlFile);
+  m_yamlData = yamlData;
   m_errList.clear();
 }
 
@@ -32,13 +32,25 @@ void CustomErrorHandler::error(const nlohmann::json::json_pointer& ptr,
     schemaNodesStr = schemaNodesStr.substr(1, schemaNodesStr.size());
     RteUtils::SplitString(segments, schemaNodesStr, '/');
   }
+  // the data may be shared with the caller: look up nodes through const
+  // references, a non-const lookup would insert keys or turn sequences into maps
   std::vector<YAML::Node> nodes;
   nodes.push_back(m_yamlData);
   for (auto& segment : segments) {
-    nodes.push_back(nodes.back()[segment]);
+    const YAML::Node parent = nodes.back();
+    if (!parent.IsMap() && !parent.IsSequence()) {
+      break;
+    }
+    const bool index = parent.IsSequence() && !segment.empty() &&
+      segment.find_first_not_of("0123456789") == string::npos;
+    const YAML::Node node = index ? parent[stoul(segment)] : parent[segment];
+    if (!node.IsDefined()) {
+      break;
+    }
+    nodes.push_back(node);
   }
   auto mark = nodes.back().Mark();
-  if (nodes.size() > 1) {
+  if (nodes.size() > 1 && nodes.size() == segments.size() + 1 && (*prev(prev(nodes.end()))).IsMap()) {
     auto parent = *prev(prev(nodes.end()));
     for (const auto& item : parent) {
       if (!item.first.Mark().is_null() && item.first.as<string>() == segments.back()) {
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2020-2021 Arm Limited. All rights reserved.
+ * Copyright (c) 2020-2023 Arm Limited. All rights reserved.
  *
  * SPDX-License-Identifier: Apache-2.0
  */
@@ -18,7 +18,7 @@ using nlohmann::json;
 class CustomErrorHandler : public nlohmann::json_schema::basic_error_handler
 {
 public:
-  CustomErrorHandler(const std::string& filePath);
+  CustomErrorHandler(const std::string& filePath, const YAML::Node& yamlData);
   ~CustomErrorHandler();
 
   /**
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2020-2021 Arm Limited. All rights reserved.
+ * Copyright (c) 2020-2023 Arm Limited. All rights reserved.
  *
  * SPDX-License-Identifier: Apache-2.0
  */
@@ -13,6 +13,9 @@
 
 using nlohmann::json_schema::json_validator;
 
+std::map<std::string, std::shared_ptr<const json_validator>> SchemaValidator::s_validators;
+std::mutex SchemaValidator::s_validatorsMutex;
+
 SchemaValidator::SchemaValidator(
   const std::string& dataFilePath,
   const std::string& schemaFilePath)
@@ -24,7 +27,7 @@ SchemaValidator::SchemaValidator(
 SchemaValidator::~SchemaValidator()
 {}
 
-json SchemaValidator::ReadData() {
+json SchemaValidator::ReadData(YAML::Node& yamlData) {
   json data;
 
   std::string extn = RteUtils::ExtractFileExtension(m_dataFile, false);
@@ -42,17 +45,24 @@ json SchemaValidator::ReadData() {
       throw SchemaError(m_dataFile, e.what(), 0, 0);
     }
     file.close();
+
+    // json is a subset of yaml, error locations are resolved on the yaml nodes
+    try {
+      yamlData = YAML::LoadFile(m_dataFile);
+    }
+    catch (YAML::Exception&) {
+      // locations are not available
+    }
   }
   else if (extn == "yml" || extn == "yaml") {
-    YAML::Node yamldata;
     try {
-      yamldata = YAML::LoadFile(m_dataFile);
+      yamlData = YAML::LoadFile(m_dataFile);
     }
     catch (YAML::Exception& e) {
       throw SchemaError(m_dataFile, "schema check failed, verify syntax", e.mark.line + 1, e.mark.column + 1);
     }
 
-    data = YamlToJson(yamldata);
+    data = YamlToJson(yamlData);
   }
 
   return data;
@@ -137,11 +147,16 @@ nlohmann::json SchemaValidator::ParseScalar(const YAML::Node& node) {
   bool boolVal;
   std::string strVal;
 
-  if (YAML::convert<int>::decode(node, intVal)) {
-    return intVal;
-  }
-  if (YAML::convert<double>::decode(node, doubleVal)) {
-    return doubleVal;
+  // numbers, including '.inf' and '.nan', start with a sign, a dot or a digit:
+  // skip the stream based conversions for all other scalars
+  const std::string& scalar = node.Scalar();
+  if (!scalar.empty() && std::string("+-.0123456789").find(scalar[0]) != std::string::npos) {
+    if (YAML::convert<int>::decode(node, intVal)) {
+      return intVal;
+    }
+    if (YAML::convert<double>::decode(node, doubleVal)) {
+      return doubleVal;
+    }
   }
   if (YAML::convert<bool>::decode(node, boolVal)) {
     return boolVal;
@@ -154,43 +169,72 @@ nlohmann::json SchemaValidator::ParseScalar(const YAML::Node& node) {
 }
 
 bool SchemaValidator::Validate(SchemaErrors& errList) {
-  json data, schema;
+  json data;
+  YAML::Node yamlData;
+  try {
+    data = ReadData(yamlData);
+  }
+  catch (const SchemaError& err) {
+    errList.push_back(err);
+    return false;
+  }
+  return Validate(data, yamlData, errList);
+}
 
-  // 1) Read the data and schema for the document you want to validate
+bool SchemaValidator::Validate(const YAML::Node& data, SchemaErrors& errList) {
+  return Validate(YamlToJson(data), data, errList);
+}
+
+bool SchemaValidator::Validate(const json& data, const YAML::Node& yamlData, SchemaErrors& errList) {
+  // 1) get the validator compiled from the schema
+  std::shared_ptr<const json_validator> validator;
   try {
-    data = ReadData();
-    schema = ReadSchema();
+    validator = GetValidator();
   }
   catch (const SchemaError& err) {
     errList.push_back(err);
     return false;
   }
-  // 2) create the validator
+
+  // 2) do the actual validation of the data
+  CustomErrorHandler handler(m_dataFile, yamlData);
+  validator->validate(data, handler);
+
+  errList = handler.GetAllErrors();
+  return (errList.size() == 0) ? true : false;
+}
+
+std::shared_ptr<const json_validator> SchemaValidator::GetValidator() {
+  std::lock_guard<std::mutex> lock(s_validatorsMutex);
+  auto it = s_validators.find(m_schemaFile);
+  if (it != s_validators.end()) {
+    return it->second;
+  }
+
+  // read the schema and create the validator, throws SchemaError
+  json schema = ReadSchema();
+  const std::string schemaFile = m_schemaFile;
   nlohmann::json_schema::schema_loader loader =
-    std::bind(&SchemaValidator::Loader, this, std::placeholders::_1, std::placeholders::_2);
-  json_validator validator(loader, nlohmann::json_schema::default_string_format_check);
+    [schemaFile](const json_uri& uri, json& subSchema) { Loader(schemaFile, uri, subSchema); };
+  auto validator = std::make_shared<json_validator>(loader, nlohmann::json_schema::default_string_format_check);
 
   try {
     // insert this schema as the root to the validator
     // this resolves remote-schemas, sub-schemas and references via the given loader-function
-    validator.set_root_schema(schema);
+    validator->set_root_schema(schema);
   }
   catch (const std::exception& e) {
-    errList.push_back(SchemaError(m_schemaFile, e.what(), 0, 0));
-    return false;
+    throw SchemaError(m_schemaFile, e.what(), 0, 0);
   }
 
-  // 3) do the actual validation of the data
-  CustomErrorHandler handler(m_dataFile);
-  validator.validate(data, handler);
-
-  errList = handler.GetAllErrors();
-  return (errList.size() == 0) ? true : false;
+  // schemas failing to compile are not cached, they are reported for each data file
+  s_validators[m_schemaFile] = validator;
+  return validator;
 }
 
-void SchemaValidator::Loader(const json_uri& uri, json& schema)
+void SchemaValidator::Loader(const std::string& schemaFile, const json_uri& uri, json& schema)
 {
-  std::string filename = RteUtils::ExtractFilePath(m_schemaFile, true) + uri.path();
+  std::string filename = RteUtils::ExtractFilePath(schemaFile, true) + uri.path();
   std::ifstream lf(filename);
   if (!lf.good()) {
     throw SchemaError(filename, "could not open " + uri.url(), 0, 0);
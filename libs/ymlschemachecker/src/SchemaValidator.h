@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2020-2021 Arm Limited. All rights reserved.
+ * Copyright (c) 2020-2023 Arm Limited. All rights reserved.
  *
  * SPDX-License-Identifier: Apache-2.0
  */
@@ -12,6 +12,9 @@
 #include "yaml-cpp/yaml.h"
 #include <nlohmann/json-schema.hpp>
 
+#include <map>
+#include <memory>
+#include <mutex>
 #include <string>
 
 using nlohmann::json;
@@ -30,17 +33,38 @@ public:
   */
   bool Validate(SchemaErrors& errList);
 
+  /**
+   * @brief Validate already loaded yaml data with json schema provided
+   * @param data yaml data loaded from data file
+   * @param errList list of errors found
+   * @return true if the validation pass, otherwise false
+  */
+  bool Validate(const YAML::Node& data, SchemaErrors& errList);
+
 private:
-  json ReadData();
+  typedef nlohmann::json_schema::json_validator JsonValidator;
+
+  json ReadData(YAML::Node& yamlData);
   json ReadSchema();
 
-  void Loader(const json_uri& uri, json& schema);
+  /**
+   * @brief get validator compiled from schema file, compiled validators are kept for the process lifetime
+   * @return pointer to compiled validator, throws SchemaError if the schema cannot be compiled
+  */
+  std::shared_ptr<const JsonValidator> GetValidator();
+
+  bool Validate(const json& data, const YAML::Node& yamlData, SchemaErrors& errList);
+
+  static void Loader(const std::string& schemaFile, const json_uri& uri, json& schema);
 
   nlohmann::json YamlToJson(const YAML::Node& root);
   nlohmann::json ParseScalar(const YAML::Node& node);
 
   std::string m_dataFile;
   std::string m_schemaFile;
+
+  static std::map<std::string, std::shared_ptr<const JsonValidator>> s_validators;
+  static std::mutex s_validatorsMutex;
 };
 
 #endif // SCHEMAVALIDATOR_H
@@ -171,3 +171,28 @@ TEST_F(SchemaChkTests, Schema_Invalid) {
     EXPECT_TRUE(errList.end() != errItr);
   }
 }
+
+TEST_F(SchemaChkTests, validate_loaded_yml_data) {
+  string datafile = testinput_folder + "/sample-data/clayer.yaml";
+  string schemafile = testinput_folder + "/clayer.schema.json";
+
+  SchemaErrors fileErrList;
+  EXPECT_FALSE(SchemaChecker::Validate(datafile, schemafile, fileErrList));
+
+  // validate already loaded data, the compiled schema is reused
+  const YAML::Node data = YAML::LoadFile(datafile);
+  const string dump = YAML::Dump(data);
+  SchemaErrors errList;
+  EXPECT_FALSE(SchemaChecker::Validate(data, datafile, schemafile, errList));
+  ASSERT_EQ(errList.size(), fileErrList.size());
+  auto fileErr = fileErrList.begin();
+  for (const auto& err : errList) {
+    EXPECT_EQ(err.m_file, datafile);
+    EXPECT_EQ(err.m_line, fileErr->m_line);
+    EXPECT_EQ(err.m_col, fileErr->m_col);
+    fileErr++;
+  }
+
+  // data is not modified by error location lookup
+  EXPECT_EQ(dump, YAML::Dump(data));
+}
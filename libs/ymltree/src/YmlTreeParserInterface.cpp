@@ -10,6 +10,10 @@
 #include "RteFsUtils.h"
 
 #include "SchemaChecker.h"
+#include "yaml-cpp/eventhandler.h"
+
+#include <fstream>
+#include <set>
 #include <sstream>
 
 using namespace std;
@@ -62,6 +66,111 @@ bool YmlTreeParserInterface::ValidateSchema(const std::string& fileName)
 }
 
 
+// collects parser events into a flat list of nodes, no YAML::Node graph is built
+class YmlEventCollector : public EventHandler
+{
+public:
+  YmlEventCollector(vector<YmlTreeParserInterface::YmlEvent>& events) : m_events(events) {}
+
+  void OnDocumentStart(const Mark&) override {}
+  void OnDocumentEnd() override {}
+
+  void OnNull(const Mark& mark, anchor_t anchor) override {
+    AddNode(YmlTreeParserInterface::YmlEvent::NULL_VALUE, mark, anchor, RteUtils::EMPTY_STRING);
+  }
+
+  void OnAlias(const Mark& mark, anchor_t anchor) override {
+    auto it = m_anchors.find(anchor);
+    if (it == m_anchors.end() || m_events[it->second].next == 0) {
+      throw ParserException(mark, ErrorMsg::UNKNOWN_ANCHOR); // undefined or recursive alias
+    }
+    size_t target = it->second;
+    AddNode(YmlTreeParserInterface::YmlEvent::ALIAS, mark, NullAnchor, m_events[target].value, target);
+  }
+
+  void OnScalar(const Mark& mark, const string&, anchor_t anchor, const string& value) override {
+    AddNode(YmlTreeParserInterface::YmlEvent::SCALAR, mark, anchor, value);
+  }
+
+  void OnSequenceStart(const Mark& mark, const string&, anchor_t anchor, EmitterStyle::value) override {
+    OpenCollection(YmlTreeParserInterface::YmlEvent::SEQUENCE, mark, anchor);
+  }
+
+  void OnSequenceEnd() override {
+    CloseCollection();
+  }
+
+  void OnMapStart(const Mark& mark, const string&, anchor_t anchor, EmitterStyle::value) override {
+    OpenCollection(YmlTreeParserInterface::YmlEvent::MAP, mark, anchor);
+  }
+
+  void OnMapEnd() override {
+    CloseCollection();
+  }
+
+private:
+  struct Collection {
+    size_t index;
+    Mark mark;
+    set<string> keys;
+  };
+
+  void AddNode(YmlTreeParserInterface::YmlEvent::Type type, const Mark& mark, anchor_t anchor, const string& value, size_t target = 0) {
+    size_t index = m_events.size();
+    if (!m_collections.empty()) {
+      Collection& parent = m_collections.back();
+      YmlTreeParserInterface::YmlEvent& parentEvent = m_events[parent.index];
+      if (parentEvent.type == YmlTreeParserInterface::YmlEvent::MAP && parentEvent.size % 2 == 0) {
+        CheckKey(parent, type, mark, value, target);
+      }
+      parentEvent.size++;
+    }
+    m_events.push_back({ type, mark.line, mark.column, 0, index + 1, target, value });
+    if (anchor != NullAnchor) {
+      m_anchors[anchor] = index;
+    }
+  }
+
+  // map keys must be unique scalars as required by YAML::Load() and YAML::Node::as<string>()
+  void CheckKey(Collection& collection, YmlTreeParserInterface::YmlEvent::Type type, const Mark& mark, const string& value, size_t target) {
+    if (type == YmlTreeParserInterface::YmlEvent::ALIAS) {
+      type = m_events[target].type;
+    }
+    if (type == YmlTreeParserInterface::YmlEvent::SEQUENCE || type == YmlTreeParserInterface::YmlEvent::MAP) {
+      throw TypedBadConversion<string>(mark);
+    }
+    if (type == YmlTreeParserInterface::YmlEvent::SCALAR && !value.empty() && !collection.keys.insert(value).second) {
+      throw NonUniqueMapKey(collection.mark, value);
+    }
+  }
+
+  void OpenCollection(YmlTreeParserInterface::YmlEvent::Type type, const Mark& mark, anchor_t anchor) {
+    AddNode(type, mark, anchor, RteUtils::EMPTY_STRING);
+    m_events.back().next = 0; // not closed yet
+    m_collections.push_back({ m_events.size() - 1, mark, {} });
+  }
+
+  void CloseCollection() {
+    YmlTreeParserInterface::YmlEvent& e = m_events[m_collections.back().index];
+    if (e.type == YmlTreeParserInterface::YmlEvent::MAP) {
+      e.size /= 2; // number of pairs
+    }
+    e.next = m_events.size();
+    m_collections.pop_back();
+  }
+
+  vector<YmlTreeParserInterface::YmlEvent>& m_events;
+  vector<Collection> m_collections;
+  map<anchor_t, size_t> m_anchors;
+};
+
+void YmlTreeParserInterface::ReadEvents(istream& input)
+{
+  YmlEventCollector collector(m_events);
+  YAML::Parser parser(input);
+  parser.HandleNextDocument(collector);
+}
+
 bool YmlTreeParserInterface::Parse(const std::string& fileName, const std::string& inputString)
 {
   bool success = true;
@@ -71,16 +180,21 @@ bool YmlTreeParserInterface::Parse(const std::string& fileName, const std::strin
 
   m_xmlFile = RteFsUtils::MakePathCanonical(fileName);
   try {
-    YAML::Node root;
     if (!inputString.empty()) {
-      root = YAML::Load(inputString);
+      istringstream input(inputString);
+      ReadEvents(input);
     } else {
       if (!ValidateSchema(m_xmlFile)) {
         return false;
       }
-      root = YAML::LoadFile(m_xmlFile);
+      ifstream input(m_xmlFile);
+      if (!input) {
+        throw BadFile(m_xmlFile);
+      }
+      ReadEvents(input);
     }
-    success = ParseNode(root, RteUtils::EMPTY_STRING);
+    // an empty document is a null node
+    success = !m_events.empty() && ParseNode(0, RteUtils::EMPTY_STRING);
 
   } catch (YAML::Exception& e) {
     stringstream ss;
@@ -89,38 +203,49 @@ bool YmlTreeParserInterface::Parse(const std::string& fileName, const std::strin
     m_nErrors++;
     success = false;
   }
+  vector<YmlEvent>().swap(m_events);
   m_xmlFile = "";
   return success;
 }
 
-bool YmlTreeParserInterface::ParseNode(const YAML::Node& node, const string& tag)
+size_t YmlTreeParserInterface::ResolveAlias(size_t index) const
+{
+  const YmlEvent& e = m_events[index];
+  return e.type == YmlEvent::ALIAS ? e.target : index;
+}
+
+bool YmlTreeParserInterface::ParseNode(size_t index, const string& tag)
 {
+  index = ResolveAlias(index);
+  const YmlEvent& e = m_events[index];
   bool success = true;
   IXmlItemBuilder* builder = m_tree->GetXmlItemBuilder();
   builder->PreCreateItem();
-  if (!tag.empty() || (!builder->HasRoot() && node.size() > 1)) {
+  if (!tag.empty() || (!builder->HasRoot() && e.size > 1)) {
     success = builder->CreateItem(tag);
   }
   if (success) {
-    builder->SetLineNumber(node.Mark().line + 1); // make one-based
-    success = DoParseNode(node, tag);
+    builder->SetLineNumber(e.line + 1); // make one-based
+    success = DoParseNode(index, tag);
     builder->AddItem();
   }
   builder->PostCreateItem(success);
   return success;
 }
 
-bool YmlTreeParserInterface::ParseMapNode(const YAML::Node& node)
+bool YmlTreeParserInterface::ParseMapNode(size_t index)
 {
   IXmlItemBuilder* builder = m_tree->GetXmlItemBuilder();
-  for (auto it : node) {
-    auto& key = it.first;
-    auto& val = it.second;
-    const string tag = key.as<string>();
-    if (val.IsScalar() && builder->HasRoot()) {
-      builder->AddAttribute(tag, val.as<string>());
+  for (size_t i = index + 1; i < m_events[index].next;) {
+    const YmlEvent& key = m_events[ResolveAlias(i)];
+    size_t valueIndex = m_events[i].next;
+    i = m_events[valueIndex].next;
+    const string tag = key.type == YmlEvent::NULL_VALUE ? "null" : key.value;
+    const YmlEvent& val = m_events[ResolveAlias(valueIndex)];
+    if (val.type == YmlEvent::SCALAR && builder->HasRoot()) {
+      builder->AddAttribute(tag, val.value);
     } else {
-      if(!ParseNode(val, tag)) {
+      if(!ParseNode(valueIndex, tag)) {
         return false;
       }
     }
@@ -128,39 +253,37 @@ bool YmlTreeParserInterface::ParseMapNode(const YAML::Node& node)
   return true;
 }
 
-bool YmlTreeParserInterface::ParseSequenceNode(const YAML::Node& node)
+bool YmlTreeParserInterface::ParseSequenceNode(size_t index)
 {
-  for (auto it : node) {
-    if (!ParseNode(it, RteUtils::DASH_STRING)) {
+  for (size_t i = index + 1; i < m_events[index].next; i = m_events[i].next) {
+    if (!ParseNode(i, RteUtils::DASH_STRING)) {
       return false;
     }
   }
   return true;
 }
 
-bool YmlTreeParserInterface::ParseScalarNode(const YAML::Node& node)
+bool YmlTreeParserInterface::ParseScalarNode(size_t index)
 {
-  m_tree->GetXmlItemBuilder()->SetText(node.as<string>());
+  m_tree->GetXmlItemBuilder()->SetText(m_events[index].value);
   return true;
 }
 
 
-bool YmlTreeParserInterface::DoParseNode(const YAML::Node& node, const string& tag)
+bool YmlTreeParserInterface::DoParseNode(size_t index, const string& tag)
 {
-  NodeType::value type = node.Type();
-  switch (type) {
-  case NodeType::Scalar:
-    return ParseScalarNode(node);
+  switch (m_events[index].type) {
+  case YmlEvent::SCALAR:
+    return ParseScalarNode(index);
 
-  case NodeType::Sequence:
-    return ParseSequenceNode(node);
+  case YmlEvent::SEQUENCE:
+    return ParseSequenceNode(index);
 
-  case NodeType::Map:
-    return ParseMapNode(node);
+  case YmlEvent::MAP:
+    return ParseMapNode(index);
 
-  case NodeType::Null:
+  case YmlEvent::NULL_VALUE:
     return false;
-  case NodeType::Undefined:
   default:
     break;
   };
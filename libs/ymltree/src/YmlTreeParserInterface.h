@@ -12,12 +12,28 @@
 
 #include "yaml-cpp/yaml.h"
 
+#include <vector>
+
 /**
  * @brief internal interface to YML reader
 */
 class YmlTreeParserInterface : public XMLTreeParserInterface
 {
 public:
+  /**
+   * @brief YAML node as reported by the parser, nodes are stored in document order
+  */
+  struct YmlEvent {
+    enum Type { SCALAR, NULL_VALUE, SEQUENCE, MAP, ALIAS };
+    Type type;
+    int line;
+    int column;
+    size_t size;   // number of sequence entries or map pairs
+    size_t next;   // index of the node following this one and its children
+    size_t target; // index of the anchored node an alias refers to
+    std::string value;
+  };
+
   /**
    * @brief constructor
    * @param tree pointer to an instance of YmlTree
@@ -51,13 +67,17 @@ public:
 
 protected:
   bool ValidateSchema(const std::string& fileName);
+  void ReadEvents(std::istream& input);
+  size_t ResolveAlias(size_t index) const;
 
-  virtual bool ParseNode(const YAML::Node& node, const std::string& tag);
-  virtual bool DoParseNode(const YAML::Node& node, const std::string& tag);
-  virtual bool ParseMapNode(const YAML::Node& node);
-  virtual bool ParseSequenceNode(const YAML::Node& node);
-  virtual bool ParseScalarNode(const YAML::Node& node);
+  virtual bool ParseNode(size_t index, const std::string& tag);
+  virtual bool DoParseNode(size_t index, const std::string& tag);
+  virtual bool ParseMapNode(size_t index);
+  virtual bool ParseSequenceNode(size_t index);
+  virtual bool ParseScalarNode(size_t index);
   virtual bool CreateItem(const std::string& tag, int line);
+
+  std::vector<YmlEvent> m_events;
 };
 
 #endif //YML_TREE_PARSER_INTERFACE_H
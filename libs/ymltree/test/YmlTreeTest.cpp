@@ -174,6 +174,42 @@ TEST_F(YmlTreeTest, Nested) {
   EXPECT_EQ(ymlContent, yaml_input);
 }
 
+TEST_F(YmlTreeTest, Alias) {
+  const string yaml_input =
+ "alias:\n\
+  defaults: &defaults\n\
+    one: 1\n\
+    two: 2\n\
+  items:\n\
+    - *defaults\n\
+    - &three 3\n\
+    - *three";
+  const string expected_output = XML_HEADER +
+    "<alias>\n\
+  <defaults one=\"1\" two=\"2\"/>\n\
+  <items>\n\
+    <- one=\"1\" two=\"2\"/>\n\
+    <->3</->\n\
+    <->3</->\n\
+  </items>\n\
+</alias>\n";
+
+  YmlTree tree;
+  EXPECT_TRUE(tree.ParseXmlString(yaml_input));
+  XMLTreeElement* root = tree.GetRoot() ? tree.GetRoot()->GetFirstChild() : nullptr;
+  ASSERT_TRUE(root);
+
+  XmlFormatter xmlFormatter(false);
+  EXPECT_EQ(xmlFormatter.FormatElement(root), expected_output);
+
+  XMLTreeElement* items = root->GetFirstChild("items");
+  ASSERT_TRUE(items);
+  EXPECT_EQ(items->GetLineNumber(), 6);
+  EXPECT_EQ(items->GetChildren().size(), 3);
+
+  EXPECT_FALSE(tree.ParseXmlString("key: *undefined"));
+  EXPECT_FALSE(tree.ParseXmlString("key: 1\nkey: 2"));
+}
 
 TEST_F(YmlTreeTest, ReadFileDefault) {
 
@@ -0,0 +1,124 @@
+/*
+ * Copyright (c) 2023 Arm Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef ZIPREADER_H
+#define ZIPREADER_H
+
+#include <cstdint>
+#include <fstream>
+#include <list>
+#include <map>
+#include <mutex>
+#include <set>
+#include <string>
+
+/**
+ * @brief ZIP archive reader with random access to single entries: only the central directory
+ *        is read when the archive is opened, entry data is read and decompressed on request.
+ *        Stored and deflated entries are supported, ZIP64 and encrypted archives are not.
+ *        Lookups may be called concurrently, ReadEntry() calls are serialized.
+*/
+class ZipReader {
+public:
+  /**
+   * @brief class constructor
+  */
+  ZipReader(void);
+
+  /**
+   * @brief class destructor
+  */
+  ~ZipReader(void);
+
+  /**
+   * @brief open archive and read its central directory
+   * @param archiveFile path to archive file
+   * @return true if archive is opened, otherwise false, see GetError()
+  */
+  bool Open(const std::string& archiveFile);
+
+  /**
+   * @brief close archive and clear all entries
+  */
+  void Close(void);
+
+  /**
+   * @brief get path of opened archive
+   * @return path of archive file, empty if no archive is opened
+  */
+  const std::string& GetArchiveFile(void) const { return m_archiveFile; }
+
+  /**
+   * @brief get error of the last Open() or ReadEntry() call
+   * @return error message, empty if no error occurred
+  */
+  const std::string& GetError(void) const { return m_error; }
+
+  /**
+   * @brief check if the archive contains a file or directory, directories are implied by file names
+   * @param name path inside the archive, '/' separated, trailing '/' optional for directories
+   * @return true if file or directory exists
+  */
+  bool Exists(const std::string& name) const;
+
+  /**
+   * @brief check if the archive contains a directory
+   * @param name path inside the archive, '/' separated, trailing '/' optional, empty for root
+   * @return true if directory exists
+  */
+  bool IsDirectory(const std::string& name) const;
+
+  /**
+   * @brief get names of files and directories directly contained in a directory
+   * @param directory path inside the archive, '/' separated, trailing '/' optional, empty for root
+   * @param names set the names without path are inserted to
+   * @return true if directory exists
+  */
+  bool GetChildren(const std::string& directory, std::set<std::string>& names) const;
+
+  /**
+   * @brief get names of all files, directories are not included
+   * @param names list the sorted names are appended to
+  */
+  void GetFileNames(std::list<std::string>& names) const;
+
+  /**
+   * @brief get size of a file entry
+   * @param name path inside the archive, '/' separated
+   * @return uncompressed size, 0 if not found
+  */
+  uint64_t GetSize(const std::string& name) const;
+
+  /**
+   * @brief read and decompress a file entry, the CRC is verified
+   * @param name path inside the archive, '/' separated
+   * @param data string receiving the content
+   * @return true if entry is read, otherwise false, see GetError()
+  */
+  bool ReadEntry(const std::string& name, std::string& data);
+
+protected:
+  struct Entry {
+    uint64_t offset;      // offset of local header
+    uint64_t compressedSize;
+    uint64_t size;
+    uint32_t crc;
+    uint16_t method;
+    uint16_t flags;
+  };
+
+  static std::string DirectoryName(const std::string& name);
+  bool ReadCentralDirectory(void);
+
+  std::string m_archiveFile;
+  std::string m_error;
+  std::ifstream m_file;
+  std::mutex m_fileMutex;
+  std::map<std::string, Entry> m_entries;     // files
+  std::set<std::string> m_directories;        // directories with trailing '/', root is ""
+};
+
+#endif // ZIPREADER_H
@@ -0,0 +1,105 @@
+/*
+ * Copyright (c) 2023 Arm Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef ZIPWRITER_H
+#define ZIPWRITER_H
+
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <string>
+
+/**
+ * @brief ZIP archive writer producing reproducible archives: entries are sorted by name,
+ *        parent directories are added and all time stamps are fixed, so equal inputs give
+ *        byte-identical archives. Entries are compressed in parallel and written in order.
+ *        Archives are limited to MAX_ENTRIES entries and MAX_SIZE bytes (no ZIP64 extensions).
+*/
+class ZipWriter {
+public:
+  /**
+   * @brief class constructor
+  */
+  ZipWriter(void);
+
+  /**
+   * @brief class destructor
+  */
+  ~ZipWriter(void);
+
+  /**
+   * @brief add a file, its content is read when the archive is written
+   * @param name path of the entry inside the archive, '/' separated
+   * @param path path of the file to read
+  */
+  void AddFile(const std::string& name, const std::string& path);
+
+  /**
+   * @brief add an entry with given content
+   * @param name path of the entry inside the archive, '/' separated
+   * @param data content of the entry
+  */
+  void AddData(const std::string& name, const std::string& data);
+
+  /**
+   * @brief remove all entries
+  */
+  void Clear(void);
+
+  /**
+   * @brief get number of added entries, parent directories excluded
+   * @return number of entries
+  */
+  size_t GetEntryCount(void) const { return m_entries.size(); }
+
+  /**
+   * @brief compress entries and write archive
+   * @param archiveFile path to archive file
+   * @param threads number of compressing threads, 0 to use all hardware threads
+   * @return true if archive is written, otherwise false, see GetError()
+  */
+  bool Write(const std::string& archiveFile, unsigned int threads = 0);
+
+  /**
+   * @brief get error of the last Write() call
+   * @return error message, empty if no error occurred
+  */
+  const std::string& GetError(void) const { return m_error; }
+
+  /**
+   * @brief calculate CRC-32 as used by ZIP archives
+   * @param data pointer to data
+   * @param size size of data
+   * @param crc CRC of preceding data to continue, 0 to start
+   * @return CRC-32 value
+  */
+  static uint32_t Crc32(const void* data, size_t size, uint32_t crc = 0);
+
+  /**
+   * @brief maximum number of entries including parent directories, 0xFFFF indicates ZIP64
+  */
+  static constexpr size_t MAX_ENTRIES = 0xFFFE;
+
+  /**
+   * @brief maximum entry size and offset, 0xFFFFFFFF indicates ZIP64
+  */
+  static constexpr uint64_t MAX_SIZE = 0xFFFFFFFE;
+
+protected:
+  struct Entry {
+    std::string path;     // file to read, empty if content is given
+    std::string data;     // given content
+  };
+
+  struct Compressed;
+
+  bool Compress(const std::string& name, const Entry* entry, Compressed& result) const;
+
+  std::map<std::string, Entry> m_entries;
+  std::string m_error;
+};
+
+#endif // ZIPWRITER_H
@@ -0,0 +1,396 @@
+/*
+ * Copyright (c) 2023 Arm Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "Deflate.h"
+
+#include <algorithm>
+
+using namespace std;
+
+static constexpr uint32_t WINDOW_SIZE = 32768;
+static constexpr uint32_t WINDOW_MASK = WINDOW_SIZE - 1;
+static constexpr uint32_t HASH_BITS = 15;
+static constexpr uint32_t HASH_MASK = (1 << HASH_BITS) - 1;
+static constexpr uint32_t MIN_MATCH = 3;
+static constexpr uint32_t MAX_MATCH = 258;
+static constexpr uint32_t MAX_CHAIN = 128;     // max. number of chain entries compared per position
+static constexpr uint32_t NICE_LENGTH = 128;   // stop searching once a match is that long
+static constexpr uint32_t LAZY_LENGTH = 32;    // try a match at the next position if the current one is shorter
+static constexpr size_t BLOCK_SYMBOLS = 16384;
+
+static constexpr uint32_t END_OF_BLOCK = 256;
+static constexpr uint32_t LITLEN_CODES = 286;
+static constexpr uint32_t DIST_CODES = 30;
+static constexpr uint32_t CODELEN_CODES = 19;
+
+static const uint16_t LENGTH_BASE[] = { 3, 4, 5, 6, 7, 8, 9, 10, 11, 13, 15, 17, 19, 23, 27, 31,
+  35, 43, 51, 59, 67, 83, 99, 115, 131, 163, 195, 227, 258 };
+static const uint8_t LENGTH_EXTRA[] = { 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 2, 2, 2, 2,
+  3, 3, 3, 3, 4, 4, 4, 4, 5, 5, 5, 5, 0 };
+static const uint16_t DIST_BASE[] = { 1, 2, 3, 4, 5, 7, 9, 13, 17, 25, 33, 49, 65, 97, 129, 193,
+  257, 385, 513, 769, 1025, 1537, 2049, 3073, 4097, 6145, 8193, 12289, 16385, 24577 };
+static const uint8_t DIST_EXTRA[] = { 0, 0, 0, 0, 1, 1, 2, 2, 3, 3, 4, 4, 5, 5, 6, 6,
+  7, 7, 8, 8, 9, 9, 10, 10, 11, 11, 12, 12, 13, 13 };
+static const uint8_t CODELEN_ORDER[] = { 16, 17, 18, 0, 8, 7, 9, 6, 10, 5, 11, 4, 12, 3, 13, 2, 14, 1, 15 };
+
+static uint32_t LengthCode(uint32_t len) {
+  return static_cast<uint32_t>(upper_bound(begin(LENGTH_BASE), end(LENGTH_BASE), len) - begin(LENGTH_BASE)) - 1;
+}
+
+static uint32_t DistCode(uint32_t dist) {
+  return static_cast<uint32_t>(upper_bound(begin(DIST_BASE), end(DIST_BASE), dist) - begin(DIST_BASE)) - 1;
+}
+
+Deflate::Deflate(const unsigned char* data, size_t size, string& out) :
+  m_data(data),
+  m_size(size),
+  m_out(out),
+  m_bitBuf(0),
+  m_bitCount(0)
+{
+}
+
+void Deflate::Compress(const unsigned char* data, size_t size, string& out) {
+  Deflate deflate(data, size, out);
+  deflate.Run();
+}
+
+void Deflate::Run() {
+  m_head.assign(HASH_MASK + 1, -1);
+  m_prev.assign(WINDOW_SIZE, -1);
+  m_symbols.reserve(BLOCK_SYMBOLS);
+
+  size_t pos = 0;
+  uint32_t dist = 0;
+  uint32_t len = m_size ? FindMatch(0, dist) : 0;
+  while (pos < m_size) {
+    if (len < MIN_MATCH) {
+      AddSymbol(m_data[pos++], 0);
+      len = pos < m_size ? FindMatch(pos, dist) : 0;
+      continue;
+    }
+    size_t hashed = pos + 1;
+    if (len < LAZY_LENGTH && pos + 1 < m_size) {
+      // lazy evaluation: prefer a longer match starting at the next position
+      uint32_t nextDist = 0;
+      const uint32_t nextLen = FindMatch(pos + 1, nextDist);
+      if (nextLen > len) {
+        AddSymbol(m_data[pos++], 0);
+        len = nextLen;
+        dist = nextDist;
+        continue;
+      }
+      hashed++;
+    }
+    AddSymbol(len, dist);
+    for (; hashed < pos + len; hashed++) {
+      InsertHash(hashed);
+    }
+    pos += len;
+    len = pos < m_size ? FindMatch(pos, dist) : 0;
+  }
+  FlushBlock(true);
+  if (m_bitCount) {
+    m_out.push_back(static_cast<char>(m_bitBuf));
+  }
+}
+
+void Deflate::InsertHash(size_t pos) {
+  if (pos + MIN_MATCH <= m_size) {
+    const uint32_t hash = ((m_data[pos] << 10) ^ (m_data[pos + 1] << 5) ^ m_data[pos + 2]) & HASH_MASK;
+    m_prev[pos & WINDOW_MASK] = m_head[hash];
+    m_head[hash] = static_cast<int32_t>(pos);
+  }
+}
+
+uint32_t Deflate::FindMatch(size_t pos, uint32_t& dist) {
+  if (pos + MIN_MATCH > m_size) {
+    return 0;
+  }
+  const uint32_t hash = ((m_data[pos] << 10) ^ (m_data[pos + 1] << 5) ^ m_data[pos + 2]) & HASH_MASK;
+  int32_t candidate = m_head[hash];
+  m_prev[pos & WINDOW_MASK] = candidate;
+  m_head[hash] = static_cast<int32_t>(pos);
+
+  const uint32_t maxLen = static_cast<uint32_t>(min<size_t>(MAX_MATCH, m_size - pos));
+  const unsigned char* current = m_data + pos;
+  uint32_t best = 0;
+  // candidates at distance WINDOW_SIZE share the chain slot of pos, they are out of reach anyway
+  for (uint32_t chain = MAX_CHAIN; candidate >= 0 && candidate + WINDOW_SIZE > pos && chain > 0; chain--) {
+    const unsigned char* match = m_data + candidate;
+    if (match[best] == current[best] && match[0] == current[0] && match[1] == current[1]) {
+      uint32_t len = 2;
+      while (len < maxLen && match[len] == current[len]) {
+        len++;
+      }
+      if (len > best) {
+        best = len;
+        dist = static_cast<uint32_t>(pos - candidate);
+        if (len >= NICE_LENGTH || len == maxLen) {
+          break;
+        }
+      }
+    }
+    const int32_t next = m_prev[candidate & WINDOW_MASK];
+    if (next >= candidate) {
+      break;
+    }
+    candidate = next;
+  }
+  return best >= MIN_MATCH ? best : 0;
+}
+
+void Deflate::AddSymbol(uint32_t litLen, uint32_t dist) {
+  m_symbols.push_back({ static_cast<uint16_t>(litLen), static_cast<uint16_t>(dist) });
+  if (m_symbols.size() >= BLOCK_SYMBOLS) {
+    FlushBlock(false);
+  }
+}
+
+void Deflate::PutBits(uint32_t value, uint32_t count) {
+  m_bitBuf |= static_cast<uint64_t>(value) << m_bitCount;
+  m_bitCount += count;
+  while (m_bitCount >= 8) {
+    m_out.push_back(static_cast<char>(m_bitBuf));
+    m_bitBuf >>= 8;
+    m_bitCount -= 8;
+  }
+}
+
+void Deflate::BuildLengths(const vector<uint32_t>& freq, uint32_t maxBits, vector<uint8_t>& lengths) {
+  // symbols sorted by ascending frequency, a complete code needs at least two of them
+  vector<pair<uint32_t, uint32_t>> leaves;
+  for (uint32_t sym = 0; sym < freq.size(); sym++) {
+    if (freq[sym]) {
+      leaves.push_back({ freq[sym], sym });
+    }
+  }
+  for (uint32_t sym = 0; leaves.size() < 2; sym++) {
+    if (!freq[sym]) {
+      leaves.push_back({ 1, sym });
+    }
+  }
+  sort(leaves.begin(), leaves.end());
+
+  // Huffman tree from two queues: sorted leaves and internal nodes in creation order
+  const size_t count = leaves.size();
+  vector<uint64_t> weight(2 * count - 1);
+  vector<size_t> parent(2 * count - 1);
+  for (size_t i = 0; i < count; i++) {
+    weight[i] = leaves[i].first;
+  }
+  size_t leaf = 0, node = count;
+  for (size_t next = count; next < 2 * count - 1; next++) {
+    for (int child = 0; child < 2; child++) {
+      const size_t pick = (leaf < count && (node >= next || weight[leaf] <= weight[node])) ? leaf++ : node++;
+      weight[next] += weight[pick];
+      parent[pick] = next;
+    }
+  }
+  vector<uint32_t> depth(2 * count - 1, 0);
+  vector<uint32_t> numCodes(max<size_t>(count, maxBits) + 1, 0);
+  for (size_t i = 2 * count - 1; i-- > 0;) {
+    depth[i] = i == 2 * count - 2 ? 0 : depth[parent[i]] + 1;
+    if (i < count) {
+      numCodes[depth[i]]++;
+    }
+  }
+
+  // limit code lengths, move overflowing codes to maxBits and restore the Kraft sum
+  for (size_t bits = maxBits + 1; bits < numCodes.size(); bits++) {
+    numCodes[maxBits] += numCodes[bits];
+    numCodes[bits] = 0;
+  }
+  uint32_t total = 0;
+  for (uint32_t bits = 1; bits <= maxBits; bits++) {
+    total += numCodes[bits] << (maxBits - bits);
+  }
+  while (total != (1U << maxBits)) {
+    numCodes[maxBits]--;
+    for (uint32_t bits = maxBits - 1; bits > 0; bits--) {
+      if (numCodes[bits]) {
+        numCodes[bits]--;
+        numCodes[bits + 1] += 2;
+        break;
+      }
+    }
+    total--;
+  }
+
+  // least frequent symbols get the longest codes
+  lengths.assign(freq.size(), 0);
+  size_t index = 0;
+  for (uint32_t bits = maxBits; bits > 0; bits--) {
+    for (uint32_t n = numCodes[bits]; n > 0; n--) {
+      lengths[leaves[index++].second] = static_cast<uint8_t>(bits);
+    }
+  }
+}
+
+void Deflate::BuildCodes(const vector<uint8_t>& lengths, vector<uint16_t>& codes) {
+  // canonical codes, stored bit-reversed as they are written LSB first
+  uint32_t blCount[16] = { 0 };
+  for (const auto len : lengths) {
+    blCount[len]++;
+  }
+  blCount[0] = 0;
+  uint32_t nextCode[16] = { 0 };
+  uint32_t code = 0;
+  for (uint32_t bits = 1; bits < 16; bits++) {
+    code = (code + blCount[bits - 1]) << 1;
+    nextCode[bits] = code;
+  }
+  codes.assign(lengths.size(), 0);
+  for (size_t sym = 0; sym < lengths.size(); sym++) {
+    const uint32_t len = lengths[sym];
+    if (len) {
+      uint32_t value = nextCode[len]++;
+      uint32_t reversed = 0;
+      for (uint32_t i = 0; i < len; i++, value >>= 1) {
+        reversed = (reversed << 1) | (value & 1);
+      }
+      codes[sym] = static_cast<uint16_t>(reversed);
+    }
+  }
+}
+
+void Deflate::FlushBlock(bool final) {
+  static const vector<uint8_t> fixedLitLens = [] {
+    vector<uint8_t> lens(288, 8);
+    fill(lens.begin() + 144, lens.begin() + 256, 9);
+    fill(lens.begin() + 256, lens.begin() + 280, 7);
+    return lens;
+  }();
+  static const vector<uint8_t> fixedDistLens(DIST_CODES, 5);
+
+  vector<uint32_t> litFreq(LITLEN_CODES, 0), distFreq(DIST_CODES, 0);
+  uint64_t extraBits = 0;
+  for (const auto& symbol : m_symbols) {
+    if (symbol.dist) {
+      const uint32_t lenCode = LengthCode(symbol.litLen);
+      const uint32_t distCode = DistCode(symbol.dist);
+      litFreq[257 + lenCode]++;
+      distFreq[distCode]++;
+      extraBits += LENGTH_EXTRA[lenCode] + DIST_EXTRA[distCode];
+    } else {
+      litFreq[symbol.litLen]++;
+    }
+  }
+  litFreq[END_OF_BLOCK]++;
+
+  // dynamic Huffman codes
+  vector<uint8_t> litLens, distLens;
+  BuildLengths(litFreq, 15, litLens);
+  BuildLengths(distFreq, 15, distLens);
+  uint32_t numLit = LITLEN_CODES;
+  while (numLit > 257 && !litLens[numLit - 1]) {
+    numLit--;
+  }
+  uint32_t numDist = DIST_CODES;
+  while (numDist > 1 && !distLens[numDist - 1]) {
+    numDist--;
+  }
+
+  // run length encoding of code lengths
+  vector<uint8_t> lens(litLens.begin(), litLens.begin() + numLit);
+  lens.insert(lens.end(), distLens.begin(), distLens.begin() + numDist);
+  vector<pair<uint8_t, uint8_t>> runs;   // code length symbol, extra bits value
+  for (size_t i = 0; i < lens.size();) {
+    const uint8_t len = lens[i];
+    size_t run = 1;
+    while (i + run < lens.size() && lens[i + run] == len) {
+      run++;
+    }
+    i += run;
+    if (len == 0) {
+      for (; run >= 11; run -= min<size_t>(run, 138)) {
+        runs.push_back({ 18, static_cast<uint8_t>(min<size_t>(run, 138) - 11) });
+      }
+      if (run >= 3) {
+        runs.push_back({ 17, static_cast<uint8_t>(run - 3) });
+        run = 0;
+      }
+    } else {
+      runs.push_back({ len, 0 });
+      run--;
+      for (; run >= 3; run -= min<size_t>(run, 6)) {
+        runs.push_back({ 16, static_cast<uint8_t>(min<size_t>(run, 6) - 3) });
+      }
+    }
+    for (; run > 0; run--) {
+      runs.push_back({ len, 0 });
+    }
+  }
+  vector<uint32_t> codeLenFreq(CODELEN_CODES, 0);
+  for (const auto& run : runs) {
+    codeLenFreq[run.first]++;
+  }
+  vector<uint8_t> codeLenLens;
+  BuildLengths(codeLenFreq, 7, codeLenLens);
+  uint32_t numCodeLen = CODELEN_CODES;
+  while (numCodeLen > 4 && !codeLenLens[CODELEN_ORDER[numCodeLen - 1]]) {
+    numCodeLen--;
+  }
+
+  // choose the smaller encoding
+  uint64_t dynamicBits = 14 + 3 * numCodeLen + extraBits;
+  uint64_t fixedBits = extraBits;
+  for (uint32_t sym = 0; sym < CODELEN_CODES; sym++) {
+    dynamicBits += static_cast<uint64_t>(codeLenFreq[sym]) * codeLenLens[sym];
+  }
+  dynamicBits += 2 * codeLenFreq[16] + 3 * codeLenFreq[17] + 7 * codeLenFreq[18];
+  for (uint32_t sym = 0; sym < LITLEN_CODES; sym++) {
+    dynamicBits += static_cast<uint64_t>(litFreq[sym]) * litLens[sym];
+    fixedBits += static_cast<uint64_t>(litFreq[sym]) * fixedLitLens[sym];
+  }
+  for (uint32_t sym = 0; sym < DIST_CODES; sym++) {
+    dynamicBits += static_cast<uint64_t>(distFreq[sym]) * distLens[sym];
+    fixedBits += static_cast<uint64_t>(distFreq[sym]) * fixedDistLens[sym];
+  }
+
+  vector<uint16_t> litCodes, distCodes;
+  PutBits(final ? 1 : 0, 1);
+  if (dynamicBits < fixedBits) {
+    vector<uint16_t> codeLenCodes;
+    BuildCodes(codeLenLens, codeLenCodes);
+    PutBits(2, 2);
+    PutBits(numLit - 257, 5);
+    PutBits(numDist - 1, 5);
+    PutBits(numCodeLen - 4, 4);
+    for (uint32_t i = 0; i < numCodeLen; i++) {
+      PutBits(codeLenLens[CODELEN_ORDER[i]], 3);
+    }
+    for (const auto& run : runs) {
+      PutBits(codeLenCodes[run.first], codeLenLens[run.first]);
+      if (run.first >= 16) {
+        PutBits(run.second, run.first == 16 ? 2 : run.first == 17 ? 3 : 7);
+      }
+    }
+    BuildCodes(litLens, litCodes);
+    BuildCodes(distLens, distCodes);
+  } else {
+    PutBits(1, 2);
+    litLens = fixedLitLens;
+    distLens = fixedDistLens;
+    BuildCodes(litLens, litCodes);
+    BuildCodes(distLens, distCodes);
+  }
+
+  for (const auto& symbol : m_symbols) {
+    if (symbol.dist) {
+      const uint32_t lenCode = LengthCode(symbol.litLen);
+      const uint32_t distCode = DistCode(symbol.dist);
+      PutBits(litCodes[257 + lenCode], litLens[257 + lenCode]);
+      PutBits(symbol.litLen - LENGTH_BASE[lenCode], LENGTH_EXTRA[lenCode]);
+      PutBits(distCodes[distCode], distLens[distCode]);
+      PutBits(symbol.dist - DIST_BASE[distCode], DIST_EXTRA[distCode]);
+    } else {
+      PutBits(litCodes[symbol.litLen], litLens[symbol.litLen]);
+    }
+  }
+  PutBits(litCodes[END_OF_BLOCK], litLens[END_OF_BLOCK]);
+  m_symbols.clear();
+}
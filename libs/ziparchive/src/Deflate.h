@@ -0,0 +1,59 @@
+/*
+ * Copyright (c) 2023 Arm Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef DEFLATE_H
+#define DEFLATE_H
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+/**
+ * @brief raw DEFLATE (RFC 1951) compressor: LZ77 with hash chains and lazy matching,
+ *        each block is encoded with dynamic or fixed Huffman codes, whichever is smaller.
+ *        The output depends on the input only, equal data always gives equal bytes.
+*/
+class Deflate {
+public:
+  /**
+   * @brief compress data
+   * @param data pointer to input data
+   * @param size size of input data
+   * @param out string the compressed stream is appended to
+  */
+  static void Compress(const unsigned char* data, size_t size, std::string& out);
+
+protected:
+  struct Symbol {
+    uint16_t litLen;    // literal byte or match length
+    uint16_t dist;      // match distance, 0 for literals
+  };
+
+  Deflate(const unsigned char* data, size_t size, std::string& out);
+
+  void Run();
+  uint32_t FindMatch(size_t pos, uint32_t& dist);
+  void InsertHash(size_t pos);
+  void AddSymbol(uint32_t litLen, uint32_t dist);
+  void FlushBlock(bool final);
+  void PutBits(uint32_t value, uint32_t count);
+
+  static void BuildLengths(const std::vector<uint32_t>& freq, uint32_t maxBits, std::vector<uint8_t>& lengths);
+  static void BuildCodes(const std::vector<uint8_t>& lengths, std::vector<uint16_t>& codes);
+
+  const unsigned char* m_data;
+  size_t m_size;
+  std::string& m_out;
+  uint64_t m_bitBuf;
+  uint32_t m_bitCount;
+
+  std::vector<int32_t> m_head;
+  std::vector<int32_t> m_prev;
+  std::vector<Symbol> m_symbols;
+};
+
+#endif // DEFLATE_H
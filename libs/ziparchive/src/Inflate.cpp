@@ -0,0 +1,307 @@
+/*
+ * Copyright (c) 2023 Arm Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "Inflate.h"
+
+#include <cstring>
+
+using namespace std;
+
+static constexpr uint32_t END_OF_BLOCK = 256;
+static constexpr uint32_t LITLEN_CODES = 286;
+static constexpr uint32_t DIST_CODES = 30;
+static constexpr uint32_t CODELEN_CODES = 19;
+
+static const uint16_t LENGTH_BASE[] = { 3, 4, 5, 6, 7, 8, 9, 10, 11, 13, 15, 17, 19, 23, 27, 31,
+  35, 43, 51, 59, 67, 83, 99, 115, 131, 163, 195, 227, 258 };
+static const uint8_t LENGTH_EXTRA[] = { 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 2, 2, 2, 2,
+  3, 3, 3, 3, 4, 4, 4, 4, 5, 5, 5, 5, 0 };
+static const uint16_t DIST_BASE[] = { 1, 2, 3, 4, 5, 7, 9, 13, 17, 25, 33, 49, 65, 97, 129, 193,
+  257, 385, 513, 769, 1025, 1537, 2049, 3073, 4097, 6145, 8193, 12289, 16385, 24577 };
+static const uint8_t DIST_EXTRA[] = { 0, 0, 0, 0, 1, 1, 2, 2, 3, 3, 4, 4, 5, 5, 6, 6,
+  7, 7, 8, 8, 9, 9, 10, 10, 11, 11, 12, 12, 13, 13 };
+static const uint8_t CODELEN_ORDER[] = { 16, 17, 18, 0, 8, 7, 9, 6, 10, 5, 11, 4, 12, 3, 13, 2, 14, 1, 15 };
+
+Inflate::Inflate(const unsigned char* data, size_t size, string& out, size_t maxSize) :
+  m_data(data),
+  m_size(size),
+  m_pos(0),
+  m_out(out),
+  m_start(out.size()),
+  m_maxSize(maxSize),
+  m_bitBuf(0),
+  m_bitCount(0)
+{
+}
+
+bool Inflate::Decompress(const unsigned char* data, size_t size, string& out, size_t maxSize) {
+  Inflate inflate(data, size, out, maxSize);
+  return inflate.Run();
+}
+
+bool Inflate::Need(uint32_t count) {
+  while (m_bitCount <= 56 && m_pos < m_size) {
+    m_bitBuf |= static_cast<uint64_t>(m_data[m_pos++]) << m_bitCount;
+    m_bitCount += 8;
+  }
+  return m_bitCount >= count;
+}
+
+bool Inflate::Fits(size_t count) const {
+  return count <= m_maxSize - (m_out.size() - m_start);
+}
+
+uint32_t Inflate::Bits(uint32_t count) {
+  const uint32_t value = static_cast<uint32_t>(m_bitBuf & ((1ULL << count) - 1));
+  m_bitBuf >>= count;
+  m_bitCount -= count;
+  return value;
+}
+
+int Inflate::Decode(const Huffman& h) {
+  Need(MAX_BITS);
+  const uint16_t entry = h.fast[m_bitBuf & ((1 << FAST_BITS) - 1)];
+  if (entry) {
+    const uint32_t len = entry & 0xF;
+    if (len > m_bitCount) {
+      return -1;
+    }
+    Bits(len);
+    return entry >> 4;
+  }
+  // canonical codes: codes of a length are consecutive and follow the shorter ones
+  int code = 0, first = 0, index = 0;
+  for (uint32_t len = 1; len <= MAX_BITS && len <= m_bitCount; len++) {
+    code |= static_cast<int>((m_bitBuf >> (len - 1)) & 1);
+    const int count = h.count[len];
+    if (code - count < first) {
+      Bits(len);
+      return h.symbol[index + (code - first)];
+    }
+    index += count;
+    first = (first + count) << 1;
+    code <<= 1;
+  }
+  return -1;
+}
+
+bool Inflate::Build(Huffman& h, const uint8_t* lengths, uint32_t n) {
+  memset(h.count, 0, sizeof(h.count));
+  memset(h.fast, 0, sizeof(h.fast));
+  for (uint32_t sym = 0; sym < n; sym++) {
+    h.count[lengths[sym]]++;
+  }
+  int left = 1;
+  for (uint32_t len = 1; len <= MAX_BITS; len++) {
+    left = (left << 1) - h.count[len];
+    if (left < 0) {
+      return false;     // over-subscribed, incomplete codes are accepted
+    }
+  }
+  uint16_t offset[MAX_BITS + 2] = { 0 };
+  uint32_t nextCode[MAX_BITS + 2] = { 0 };
+  for (uint32_t len = 1; len <= MAX_BITS; len++) {
+    offset[len + 1] = offset[len] + h.count[len];
+    nextCode[len + 1] = (nextCode[len] + h.count[len]) << 1;
+  }
+  for (uint32_t sym = 0; sym < n; sym++) {
+    const uint32_t len = lengths[sym];
+    if (len == 0) {
+      continue;
+    }
+    h.symbol[offset[len]++] = static_cast<uint16_t>(sym);
+    const uint32_t code = nextCode[len]++;
+    if (len <= FAST_BITS) {
+      // bits are read LSB first, the table is indexed with the reversed code
+      uint32_t rev = 0;
+      for (uint32_t i = 0; i < len; i++) {
+        rev |= ((code >> i) & 1) << (len - 1 - i);
+      }
+      for (uint32_t i = rev; i < (1u << FAST_BITS); i += 1u << len) {
+        h.fast[i] = static_cast<uint16_t>((sym << 4) | len);
+      }
+    }
+  }
+  return true;
+}
+
+bool Inflate::Stored() {
+  Bits(m_bitCount % 8);
+  if (!Need(32)) {
+    return false;
+  }
+  const uint32_t len = Bits(16);
+  if (Bits(16) != (~len & 0xFFFF)) {
+    return false;
+  }
+  if (!Fits(len)) {
+    return false;
+  }
+  // bytes already in the bit buffer, then the rest directly from the input
+  uint32_t remaining = len;
+  while (remaining > 0 && m_bitCount >= 8) {
+    m_out.push_back(static_cast<char>(Bits(8)));
+    remaining--;
+  }
+  if (m_size - m_pos < remaining) {
+    return false;
+  }
+  m_out.append(reinterpret_cast<const char*>(m_data + m_pos), remaining);
+  m_pos += remaining;
+  return true;
+}
+
+bool Inflate::Codes(const Huffman& litLen, const Huffman& dist) {
+  while (true) {
+    int sym = Decode(litLen);
+    if (sym < 0) {
+      return false;
+    }
+    if (sym < static_cast<int>(END_OF_BLOCK)) {
+      if (!Fits(1)) {
+        return false;
+      }
+      m_out.push_back(static_cast<char>(sym));
+      continue;
+    }
+    if (sym == static_cast<int>(END_OF_BLOCK)) {
+      return true;
+    }
+    sym -= END_OF_BLOCK + 1;
+    if (sym >= static_cast<int>(sizeof(LENGTH_BASE) / sizeof(LENGTH_BASE[0])) || !Need(LENGTH_EXTRA[sym])) {
+      return false;
+    }
+    const uint32_t len = LENGTH_BASE[sym] + Bits(LENGTH_EXTRA[sym]);
+    sym = Decode(dist);
+    if (sym < 0 || sym >= static_cast<int>(DIST_CODES) || !Need(DIST_EXTRA[sym])) {
+      return false;
+    }
+    const size_t distance = DIST_BASE[sym] + Bits(DIST_EXTRA[sym]);
+    if (distance > m_out.size() - m_start || !Fits(len)) {
+      return false;
+    }
+    // copy byte by byte, source and destination may overlap
+    const size_t from = m_out.size() - distance;
+    for (uint32_t i = 0; i < len; i++) {
+      m_out.push_back(m_out[from + i]);
+    }
+  }
+}
+
+bool Inflate::Fixed() {
+  static const auto codes = []() {
+    pair<Huffman, Huffman> h;
+    uint8_t lengths[288];
+    memset(lengths, 8, 144);
+    memset(lengths + 144, 9, 112);
+    memset(lengths + 256, 7, 24);
+    memset(lengths + 280, 8, 8);
+    Build(h.first, lengths, 288);
+    memset(lengths, 5, DIST_CODES);
+    Build(h.second, lengths, DIST_CODES);
+    return h;
+  }();
+  return Codes(codes.first, codes.second);
+}
+
+bool Inflate::Dynamic() {
+  if (!Need(14)) {
+    return false;
+  }
+  const uint32_t nLitLen = Bits(5) + 257;
+  const uint32_t nDist = Bits(5) + 1;
+  const uint32_t nCodeLen = Bits(4) + 4;
+  if (nLitLen > LITLEN_CODES || nDist > DIST_CODES) {
+    return false;
+  }
+
+  uint8_t lengths[LITLEN_CODES + DIST_CODES] = { 0 };
+  for (uint32_t i = 0; i < nCodeLen; i++) {
+    if (!Need(3)) {
+      return false;
+    }
+    lengths[CODELEN_ORDER[i]] = static_cast<uint8_t>(Bits(3));
+  }
+  Huffman lenCodes;
+  if (!Build(lenCodes, lengths, CODELEN_CODES)) {
+    return false;
+  }
+
+  // code lengths of literal/length and distance codes, run length encoded
+  uint32_t index = 0;
+  while (index < nLitLen + nDist) {
+    const int sym = Decode(lenCodes);
+    if (sym < 0) {
+      return false;
+    }
+    if (sym < 16) {
+      lengths[index++] = static_cast<uint8_t>(sym);
+      continue;
+    }
+    uint8_t len = 0;
+    uint32_t repeat;
+    if (sym == 16) {
+      if (index == 0 || !Need(2)) {
+        return false;
+      }
+      len = lengths[index - 1];
+      repeat = 3 + Bits(2);
+    } else if (sym == 17) {
+      if (!Need(3)) {
+        return false;
+      }
+      repeat = 3 + Bits(3);
+    } else {
+      if (!Need(7)) {
+        return false;
+      }
+      repeat = 11 + Bits(7);
+    }
+    if (index + repeat > nLitLen + nDist) {
+      return false;
+    }
+    while (repeat--) {
+      lengths[index++] = len;
+    }
+  }
+  if (lengths[END_OF_BLOCK] == 0) {
+    return false;
+  }
+
+  Huffman litLen, dist;
+  if (!Build(litLen, lengths, nLitLen) || !Build(dist, lengths + nLitLen, nDist)) {
+    return false;
+  }
+  return Codes(litLen, dist);
+}
+
+bool Inflate::Run() {
+  bool last = false;
+  while (!last) {
+    if (!Need(3)) {
+      return false;
+    }
+    last = Bits(1) != 0;
+    bool ok = false;
+    switch (Bits(2)) {
+      case 0:
+        ok = Stored();
+        break;
+      case 1:
+        ok = Fixed();
+        break;
+      case 2:
+        ok = Dynamic();
+        break;
+      default:
+        break;
+    }
+    if (!ok) {
+      return false;
+    }
+  }
+  return true;
+}
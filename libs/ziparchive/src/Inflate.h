@@ -0,0 +1,66 @@
+/*
+ * Copyright (c) 2023 Arm Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef INFLATE_H
+#define INFLATE_H
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <string>
+
+/**
+ * @brief raw DEFLATE (RFC 1951) decompressor for stored, fixed and dynamic Huffman blocks.
+ *        Codes up to 9 bits are decoded with a lookup table, longer ones bit by bit.
+*/
+class Inflate {
+public:
+  /**
+   * @brief decompress data
+   * @param data pointer to compressed stream
+   * @param size size of compressed stream
+   * @param out string the decompressed data is appended to
+   * @param maxSize maximum number of bytes the stream may decompress to
+   * @return true if the stream is complete, valid and within maxSize, otherwise false
+  */
+  static bool Decompress(const unsigned char* data, size_t size, std::string& out,
+    size_t maxSize = std::numeric_limits<size_t>::max());
+
+protected:
+  static constexpr uint32_t FAST_BITS = 9;
+  static constexpr uint32_t MAX_BITS = 15;
+
+  struct Huffman {
+    uint16_t count[MAX_BITS + 1];       // number of codes per length
+    uint16_t symbol[288];               // symbols ordered by code
+    uint16_t fast[1 << FAST_BITS];      // symbol << 4 | length for short codes, 0 otherwise
+  };
+
+  Inflate(const unsigned char* data, size_t size, std::string& out, size_t maxSize);
+
+  bool Run();
+  bool Stored();
+  bool Fixed();
+  bool Dynamic();
+  bool Codes(const Huffman& litLen, const Huffman& dist);
+  bool Need(uint32_t count);
+  bool Fits(size_t count) const;
+  uint32_t Bits(uint32_t count);
+  int Decode(const Huffman& h);
+
+  static bool Build(Huffman& h, const uint8_t* lengths, uint32_t n);
+
+  const unsigned char* m_data;
+  size_t m_size;
+  size_t m_pos;
+  std::string& m_out;
+  size_t m_start;
+  size_t m_maxSize;
+  uint64_t m_bitBuf;
+  uint32_t m_bitCount;
+};
+
+#endif // INFLATE_H
@@ -0,0 +1,236 @@
+/*
+ * Copyright (c) 2023 Arm Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "ZipReader.h"
+#include "Inflate.h"
+#include "ZipWriter.h"
+
+#include <algorithm>
+
+using namespace std;
+
+static constexpr uint32_t LOCAL_HEADER_SIGNATURE = 0x04034b50;
+static constexpr uint32_t CENTRAL_HEADER_SIGNATURE = 0x02014b50;
+static constexpr uint32_t END_OF_CENTRAL_DIR_SIGNATURE = 0x06054b50;
+static constexpr size_t LOCAL_HEADER_SIZE = 30;
+static constexpr size_t CENTRAL_HEADER_SIZE = 46;
+static constexpr size_t END_OF_CENTRAL_DIR_SIZE = 22;
+static constexpr size_t MAX_COMMENT_SIZE = 0xFFFF;
+static constexpr uint16_t METHOD_STORE = 0;
+static constexpr uint16_t METHOD_DEFLATE = 8;
+static constexpr uint16_t FLAG_ENCRYPTED = 0x0001;
+
+static uint32_t Get16(const char* buf) {
+  const unsigned char* p = reinterpret_cast<const unsigned char*>(buf);
+  return p[0] | (p[1] << 8);
+}
+
+static uint32_t Get32(const char* buf) {
+  return Get16(buf) | (Get16(buf + 2) << 16);
+}
+
+ZipReader::ZipReader(void) {
+  // Reserved
+}
+
+ZipReader::~ZipReader(void) {
+  Close();
+}
+
+bool ZipReader::Open(const string& archiveFile) {
+  Close();
+  m_file.open(archiveFile, ios::binary);
+  if (!m_file) {
+    m_error = "cannot open archive file: " + archiveFile;
+    return false;
+  }
+  m_archiveFile = archiveFile;
+  if (!ReadCentralDirectory()) {
+    const string error = m_error.empty() ? "invalid ZIP archive: " + archiveFile : m_error;
+    Close();
+    m_error = error;
+    return false;
+  }
+  return true;
+}
+
+void ZipReader::Close(void) {
+  if (m_file.is_open()) {
+    m_file.close();
+  }
+  m_file.clear();
+  m_archiveFile.clear();
+  m_error.clear();
+  m_entries.clear();
+  m_directories.clear();
+}
+
+bool ZipReader::ReadCentralDirectory(void) {
+  // end of central directory record, followed by an optional comment
+  m_file.seekg(0, ios::end);
+  const uint64_t fileSize = static_cast<uint64_t>(m_file.tellg());
+  if (fileSize < END_OF_CENTRAL_DIR_SIZE) {
+    return false;
+  }
+  const size_t tailSize = static_cast<size_t>(min<uint64_t>(fileSize, END_OF_CENTRAL_DIR_SIZE + MAX_COMMENT_SIZE));
+  string tail(tailSize, '\0');
+  m_file.seekg(fileSize - tailSize);
+  if (!m_file.read(&tail[0], tailSize)) {
+    return false;
+  }
+  size_t end = tailSize - END_OF_CENTRAL_DIR_SIZE + 1;
+  bool found = false;
+  while (!found && end > 0) {
+    end--;
+    found = Get32(&tail[end]) == END_OF_CENTRAL_DIR_SIGNATURE &&
+      end + END_OF_CENTRAL_DIR_SIZE + Get16(&tail[end + 20]) <= tailSize;
+  }
+  if (!found) {
+    return false;
+  }
+  const uint32_t count = Get16(&tail[end + 10]);
+  const uint32_t dirSize = Get32(&tail[end + 12]);
+  const uint32_t dirOffset = Get32(&tail[end + 16]);
+  if (count == 0xFFFF || dirSize == 0xFFFFFFFF || dirOffset == 0xFFFFFFFF) {
+    m_error = "ZIP64 archives are not supported: " + m_archiveFile;
+    return false;
+  }
+  if (static_cast<uint64_t>(dirOffset) + dirSize > fileSize) {
+    return false;
+  }
+
+  string dir(dirSize, '\0');
+  m_file.seekg(dirOffset);
+  if (dirSize > 0 && !m_file.read(&dir[0], dirSize)) {
+    return false;
+  }
+  m_directories.insert("");
+  size_t pos = 0;
+  for (uint32_t i = 0; i < count; i++) {
+    if (pos + CENTRAL_HEADER_SIZE > dir.size() || Get32(&dir[pos]) != CENTRAL_HEADER_SIGNATURE) {
+      return false;
+    }
+    const size_t nameSize = Get16(&dir[pos + 28]);
+    const size_t recordSize = CENTRAL_HEADER_SIZE + nameSize + Get16(&dir[pos + 30]) + Get16(&dir[pos + 32]);
+    if (pos + recordSize > dir.size()) {
+      return false;
+    }
+    Entry entry;
+    entry.flags = static_cast<uint16_t>(Get16(&dir[pos + 8]));
+    entry.method = static_cast<uint16_t>(Get16(&dir[pos + 10]));
+    entry.crc = Get32(&dir[pos + 16]);
+    entry.compressedSize = Get32(&dir[pos + 20]);
+    entry.size = Get32(&dir[pos + 24]);
+    entry.offset = Get32(&dir[pos + 42]);
+    string name = dir.substr(pos + CENTRAL_HEADER_SIZE, nameSize);
+    replace(name.begin(), name.end(), '\\', '/');
+    pos += recordSize;
+
+    // parent directories are implied, not all archivers store them
+    for (size_t slash = name.find('/'); slash != string::npos; slash = name.find('/', slash + 1)) {
+      m_directories.insert(name.substr(0, slash + 1));
+    }
+    if (!name.empty() && name.back() != '/') {
+      m_entries[name] = entry;
+    }
+  }
+  return true;
+}
+
+string ZipReader::DirectoryName(const string& name) {
+  if (name.empty() || name.back() == '/') {
+    return name;
+  }
+  return name + '/';
+}
+
+bool ZipReader::Exists(const string& name) const {
+  return m_entries.find(name) != m_entries.end() || IsDirectory(name);
+}
+
+bool ZipReader::IsDirectory(const string& name) const {
+  return m_directories.find(DirectoryName(name)) != m_directories.end();
+}
+
+bool ZipReader::GetChildren(const string& directory, set<string>& names) const {
+  const string prefix = DirectoryName(directory);
+  if (m_directories.find(prefix) == m_directories.end()) {
+    return false;
+  }
+  for (auto it = m_entries.lower_bound(prefix); it != m_entries.end() && it->first.compare(0, prefix.size(), prefix) == 0; it++) {
+    if (it->first.find('/', prefix.size()) == string::npos) {
+      names.insert(it->first.substr(prefix.size()));
+    }
+  }
+  for (auto it = m_directories.upper_bound(prefix); it != m_directories.end() && it->compare(0, prefix.size(), prefix) == 0; it++) {
+    names.insert(it->substr(prefix.size(), it->find('/', prefix.size()) - prefix.size()));
+  }
+  return true;
+}
+
+void ZipReader::GetFileNames(list<string>& names) const {
+  for (const auto& [name, entry] : m_entries) {
+    names.push_back(name);
+  }
+}
+
+uint64_t ZipReader::GetSize(const string& name) const {
+  const auto it = m_entries.find(name);
+  return it != m_entries.end() ? it->second.size : 0;
+}
+
+bool ZipReader::ReadEntry(const string& name, string& data) {
+  lock_guard<mutex> lock(m_fileMutex);
+  m_error.clear();
+  data.clear();
+  const auto it = m_entries.find(name);
+  if (it == m_entries.end()) {
+    m_error = "entry not found: " + name;
+    return false;
+  }
+  const Entry& entry = it->second;
+  if (entry.flags & FLAG_ENCRYPTED) {
+    m_error = "encrypted entries are not supported: " + name;
+    return false;
+  }
+  if (entry.method != METHOD_STORE && entry.method != METHOD_DEFLATE) {
+    m_error = "unsupported compression method " + to_string(entry.method) + ": " + name;
+    return false;
+  }
+
+  // local header, its name and extra field may differ from the central directory
+  char header[LOCAL_HEADER_SIZE];
+  m_file.clear();
+  m_file.seekg(entry.offset);
+  if (!m_file.read(header, LOCAL_HEADER_SIZE) || Get32(header) != LOCAL_HEADER_SIGNATURE) {
+    m_error = "invalid local header: " + name;
+    return false;
+  }
+  m_file.seekg(entry.offset + LOCAL_HEADER_SIZE + Get16(header + 26) + Get16(header + 28));
+  string compressed(static_cast<size_t>(entry.compressedSize), '\0');
+  if (!compressed.empty() && !m_file.read(&compressed[0], compressed.size())) {
+    m_error = "cannot read entry: " + name;
+    return false;
+  }
+
+  if (entry.method == METHOD_STORE) {
+    data = move(compressed);
+  } else {
+    data.reserve(static_cast<size_t>(entry.size));
+    if (!Inflate::Decompress(reinterpret_cast<const unsigned char*>(compressed.data()), compressed.size(), data,
+      static_cast<size_t>(entry.size))) {
+      m_error = "invalid compressed data: " + name;
+      data.clear();
+      return false;
+    }
+  }
+  if (data.size() != entry.size || ZipWriter::Crc32(data.data(), data.size()) != entry.crc) {
+    m_error = "CRC or size mismatch: " + name;
+    data.clear();
+    return false;
+  }
+  return true;
+}
@@ -0,0 +1,305 @@
+/*
+ * Copyright (c) 2023 Arm Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "ZipWriter.h"
+#include "Deflate.h"
+
+#include <algorithm>
+#include <condition_variable>
+#include <cstdio>
+#include <exception>
+#include <fstream>
+#include <mutex>
+#include <set>
+#include <thread>
+#include <vector>
+
+using namespace std;
+
+static constexpr uint32_t LOCAL_HEADER_SIGNATURE = 0x04034b50;
+static constexpr uint32_t CENTRAL_HEADER_SIGNATURE = 0x02014b50;
+static constexpr uint32_t END_OF_CENTRAL_DIR_SIGNATURE = 0x06054b50;
+static constexpr uint16_t VERSION = 20;             // 2.0: deflate, directories
+static constexpr uint16_t FLAG_UTF8 = 0x0800;       // names are UTF-8 encoded
+static constexpr uint16_t METHOD_STORE = 0;
+static constexpr uint16_t METHOD_DEFLATE = 8;
+static constexpr uint16_t DOS_TIME = 0;             // 00:00:00
+static constexpr uint16_t DOS_DATE = (1 << 5) | 1;  // 1980-01-01
+static constexpr uint32_t ATTRIBUTE_DIRECTORY = 0x10;
+static constexpr size_t ENTRIES_PER_THREAD = 4;     // compressed entries kept in memory per thread
+
+struct ZipWriter::Compressed {
+  string data;
+  uint32_t crc = 0;
+  uint64_t size = 0;
+  uint16_t method = METHOD_STORE;
+  bool done = false;
+  bool success = false;
+  exception_ptr exception;
+};
+
+static void Put16(string& buf, uint32_t value) {
+  buf.push_back(static_cast<char>(value));
+  buf.push_back(static_cast<char>(value >> 8));
+}
+
+static void Put32(string& buf, uint32_t value) {
+  Put16(buf, value & 0xFFFF);
+  Put16(buf, value >> 16);
+}
+
+ZipWriter::ZipWriter(void) {
+  // Reserved
+}
+
+ZipWriter::~ZipWriter(void) {
+  // Reserved
+}
+
+void ZipWriter::AddFile(const string& name, const string& path) {
+  m_entries[name] = { path, string() };
+}
+
+void ZipWriter::AddData(const string& name, const string& data) {
+  m_entries[name] = { string(), data };
+}
+
+void ZipWriter::Clear(void) {
+  m_entries.clear();
+  m_error.clear();
+}
+
+uint32_t ZipWriter::Crc32(const void* data, size_t size, uint32_t crc) {
+  static const vector<uint32_t> table = [] {
+    vector<uint32_t> t(256);
+    for (uint32_t n = 0; n < 256; n++) {
+      uint32_t c = n;
+      for (int k = 0; k < 8; k++) {
+        c = (c & 1) ? 0xEDB88320 ^ (c >> 1) : c >> 1;
+      }
+      t[n] = c;
+    }
+    return t;
+  }();
+  const unsigned char* p = static_cast<const unsigned char*>(data);
+  crc = ~crc;
+  for (size_t i = 0; i < size; i++) {
+    crc = table[(crc ^ p[i]) & 0xFF] ^ (crc >> 8);
+  }
+  return ~crc;
+}
+
+bool ZipWriter::Compress(const string& name, const Entry* entry, Compressed& result) const {
+  if (!entry) {
+    return true;    // directory
+  }
+  string content;
+  const string* data = &entry->data;
+  if (!entry->path.empty()) {
+    ifstream file(entry->path, ios::binary | ios::ate);
+    if (!file) {
+      return false;
+    }
+    content.resize(static_cast<size_t>(file.tellg()));
+    file.seekg(0);
+    if (!file.read(&content[0], content.size())) {
+      return false;
+    }
+    data = &content;
+  }
+  result.size = data->size();
+  result.crc = Crc32(data->data(), data->size());
+  if (!data->empty()) {
+    Deflate::Compress(reinterpret_cast<const unsigned char*>(data->data()), data->size(), result.data);
+  }
+  if (result.data.size() < data->size()) {
+    result.method = METHOD_DEFLATE;
+  } else {
+    // store incompressible and empty entries
+    result.method = METHOD_STORE;
+    result.data = data == &content ? move(content) : *data;
+  }
+  return true;
+}
+
+bool ZipWriter::Write(const string& archiveFile, unsigned int threads) {
+  m_error.clear();
+
+  // sorted entries including parent directories
+  set<string> directories;
+  for (const auto& [name, entry] : m_entries) {
+    for (size_t pos = name.find('/'); pos != string::npos && pos + 1 < name.size(); pos = name.find('/', pos + 1)) {
+      directories.insert(name.substr(0, pos + 1));
+    }
+  }
+  vector<pair<const string*, const Entry*>> items;
+  for (const auto& directory : directories) {
+    if (m_entries.find(directory) == m_entries.end()) {
+      items.push_back({ &directory, nullptr });
+    }
+  }
+  for (const auto& [name, entry] : m_entries) {
+    items.push_back({ &name, &entry });
+  }
+  sort(items.begin(), items.end(), [](const auto& a, const auto& b) { return *a.first < *b.first; });
+  if (items.size() > MAX_ENTRIES) {
+    m_error = "too many entries for ZIP archive: " + to_string(items.size());
+    return false;
+  }
+
+  ofstream archive(archiveFile, ios::binary | ios::trunc);
+  if (!archive) {
+    m_error = "cannot create archive file: " + archiveFile;
+    return false;
+  }
+
+  if (threads == 0) {
+    threads = thread::hardware_concurrency();
+  }
+  threads = static_cast<unsigned int>(max<size_t>(1, min<size_t>(threads, items.size())));
+  const size_t window = threads * ENTRIES_PER_THREAD;
+
+  // entries are compressed in parallel and written in order, at most 'window' are kept in memory
+  vector<Compressed> results(items.size());
+  mutex resultMutex;
+  condition_variable doneCondition, spaceCondition;
+  size_t next = 0, written = 0;
+  bool abort = false;
+  const auto worker = [&]() {
+    unique_lock<mutex> lock(resultMutex);
+    while (true) {
+      spaceCondition.wait(lock, [&]() { return abort || next >= items.size() || next < written + window; });
+      if (abort || next >= items.size()) {
+        return;
+      }
+      const size_t index = next++;
+      lock.unlock();
+      Compressed& result = results[index];
+      try {
+        result.success = Compress(*items[index].first, items[index].second, result);
+      }
+      catch (...) {
+        result.exception = current_exception();
+      }
+      lock.lock();
+      result.done = true;
+      doneCondition.notify_all();
+    }
+  };
+  vector<thread> workers;
+  for (unsigned int i = 0; i < threads; i++) {
+    workers.emplace_back(worker);
+  }
+
+  string centralDir;
+  uint64_t offset = 0;
+  exception_ptr exception;
+  for (size_t index = 0; index < items.size() && m_error.empty() && !exception; index++) {
+    Compressed& result = results[index];
+    {
+      unique_lock<mutex> lock(resultMutex);
+      doneCondition.wait(lock, [&]() { return result.done; });
+    }
+    const string& name = *items[index].first;
+    const bool directory = !items[index].second;
+    if (result.exception) {
+      exception = result.exception;
+      break;
+    }
+    if (!result.success) {
+      m_error = "cannot read file: " + items[index].second->path;
+      break;
+    }
+    if (offset > MAX_SIZE || result.size > MAX_SIZE || result.data.size() > MAX_SIZE) {
+      m_error = "archive exceeds 4 GB ZIP limit";
+      break;
+    }
+    string header;
+    Put32(header, LOCAL_HEADER_SIGNATURE);
+    Put16(header, VERSION);
+    Put16(header, FLAG_UTF8);
+    Put16(header, result.method);
+    Put16(header, DOS_TIME);
+    Put16(header, DOS_DATE);
+    Put32(header, result.crc);
+    Put32(header, static_cast<uint32_t>(result.data.size()));
+    Put32(header, static_cast<uint32_t>(result.size));
+    Put16(header, static_cast<uint32_t>(name.size()));
+    Put16(header, 0);
+    header += name;
+    archive.write(header.data(), header.size());
+    archive.write(result.data.data(), result.data.size());
+
+    Put32(centralDir, CENTRAL_HEADER_SIGNATURE);
+    Put16(centralDir, VERSION);
+    Put16(centralDir, VERSION);
+    Put16(centralDir, FLAG_UTF8);
+    Put16(centralDir, result.method);
+    Put16(centralDir, DOS_TIME);
+    Put16(centralDir, DOS_DATE);
+    Put32(centralDir, result.crc);
+    Put32(centralDir, static_cast<uint32_t>(result.data.size()));
+    Put32(centralDir, static_cast<uint32_t>(result.size));
+    Put16(centralDir, static_cast<uint32_t>(name.size()));
+    Put16(centralDir, 0);   // extra field length
+    Put16(centralDir, 0);   // comment length
+    Put16(centralDir, 0);   // disk number
+    Put16(centralDir, 0);   // internal attributes
+    Put32(centralDir, directory ? ATTRIBUTE_DIRECTORY : 0);
+    Put32(centralDir, static_cast<uint32_t>(offset));
+    centralDir += name;
+
+    offset += header.size() + result.data.size();
+    result = Compressed();
+    {
+      lock_guard<mutex> lock(resultMutex);
+      written++;
+    }
+    spaceCondition.notify_all();
+  }
+
+  {
+    lock_guard<mutex> lock(resultMutex);
+    abort = true;
+  }
+  spaceCondition.notify_all();
+  for (auto& t : workers) {
+    t.join();
+  }
+  if (exception) {
+    archive.close();
+    remove(archiveFile.c_str());
+    rethrow_exception(exception);
+  }
+
+  if (m_error.empty()) {
+    if (offset + centralDir.size() > MAX_SIZE) {
+      m_error = "archive exceeds 4 GB ZIP limit";
+    } else {
+      string end;
+      Put32(end, END_OF_CENTRAL_DIR_SIGNATURE);
+      Put16(end, 0);   // disk number
+      Put16(end, 0);   // disk with central directory
+      Put16(end, static_cast<uint32_t>(items.size()));
+      Put16(end, static_cast<uint32_t>(items.size()));
+      Put32(end, static_cast<uint32_t>(centralDir.size()));
+      Put32(end, static_cast<uint32_t>(offset));
+      Put16(end, 0);   // comment length
+      archive.write(centralDir.data(), centralDir.size());
+      archive.write(end.data(), end.size());
+      archive.flush();
+      if (!archive) {
+        m_error = "cannot write archive file: " + archiveFile;
+      }
+    }
+  }
+  archive.close();
+  if (!m_error.empty()) {
+    remove(archiveFile.c_str());
+    return false;
+  }
+  return true;
+}
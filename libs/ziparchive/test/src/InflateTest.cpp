@@ -0,0 +1,281 @@
+/*
+ * Copyright (c) 2023 Arm Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "Deflate.h"
+#include "Inflate.h"
+#include "ZipReader.h"
+#include "ZipWriter.h"
+#include "RteFsUtils.h"
+
+#include "gtest/gtest.h"
+
+#include <random>
+
+using namespace std;
+
+const string inflateTestDir = "InflateTest";
+
+class InflateTest : public ::testing::Test {
+protected:
+  void SetUp() override
+  {
+    RteFsUtils::CreateDirectories(inflateTestDir);
+  }
+  void TearDown() override
+  {
+    RteFsUtils::DeleteTree(inflateTestDir);
+  }
+
+  // write entries with ZipWriter, read them back with ZipReader and return the archive size
+  static size_t RoundTrip(const map<string, string>& entries) {
+    ZipWriter zip;
+    for (const auto& [name, data] : entries) {
+      zip.AddData(name, data);
+    }
+    const string archive = inflateTestDir + "/archive.zip";
+    EXPECT_TRUE(zip.Write(archive)) << zip.GetError();
+    ZipReader reader;
+    EXPECT_TRUE(reader.Open(archive)) << reader.GetError();
+    for (const auto& [name, expected] : entries) {
+      string data;
+      EXPECT_TRUE(reader.ReadEntry(name, data)) << reader.GetError();
+      EXPECT_TRUE(expected == data) << name << ": content differs";
+    }
+    string content;
+    RteFsUtils::ReadFile(archive, content);
+    return content.size();
+  }
+
+  static string RandomBytes(mt19937& rng, size_t size) {
+    string data(size, '\0');
+    for (auto& c : data) {
+      c = static_cast<char>(rng());
+    }
+    return data;
+  }
+
+  // text of random words, compressible but with many distinct matches
+  static string RandomText(mt19937& rng, size_t size) {
+    static const char* words[] = { "uint32_t", "return", "if", "else", "void", "static", "const", "(", ")",
+      "{", "}", ";", "\n", "  ", "register", "value", "mask", "0x", "<<", ">>" };
+    string text;
+    while (text.size() < size) {
+      text += words[rng() % (sizeof(words) / sizeof(words[0]))];
+      text += static_cast<char>('a' + rng() % 26);
+      text += ' ';
+    }
+    text.resize(size);
+    return text;
+  }
+};
+
+// writes a raw deflate stream, Huffman codes start with their most significant bit
+class BitWriter {
+public:
+  void Put(uint32_t value, uint32_t count) {
+    for (uint32_t i = 0; i < count; i++) {
+      PutBit((value >> i) & 1);
+    }
+  }
+  void PutCode(uint32_t code, uint32_t length) {
+    for (uint32_t i = length; i > 0; i--) {
+      PutBit((code >> (i - 1)) & 1);
+    }
+  }
+  // fixed Huffman codes
+  void PutLiteral(unsigned char c) { PutCode(0x30 + c, 8); }
+  void PutEndOfBlock() { PutCode(0, 7); }
+  void PutMatch(uint32_t lengthCode, uint32_t distanceCode) {
+    PutCode(lengthCode - 256, 7);   // length codes 257..279
+    PutCode(distanceCode, 5);
+  }
+  const string& Get() const { return m_out; }
+private:
+  void PutBit(uint32_t bit) {
+    if (m_count == 0) {
+      m_out.push_back(0);
+    }
+    m_out.back() |= static_cast<char>(bit << m_count);
+    m_count = (m_count + 1) & 7;
+  }
+  string m_out;
+  uint32_t m_count = 0;
+};
+
+TEST_F(InflateTest, RoundTrip_Random) {
+  mt19937 rng(1);
+  for (int i = 0; i < 20; i++) {
+    // random mix of literals and repeated snippets
+    string data;
+    const size_t size = rng() % 70000;
+    while (data.size() < size) {
+      if (data.size() > 10 && rng() % 2) {
+        const size_t from = rng() % data.size();
+        data += data.substr(from, rng() % 300);
+      } else {
+        data += RandomBytes(rng, rng() % 50);
+      }
+    }
+    string compressed, out;
+    Deflate::Compress(reinterpret_cast<const unsigned char*>(data.data()), data.size(), compressed);
+    EXPECT_TRUE(Inflate::Decompress(reinterpret_cast<const unsigned char*>(compressed.data()), compressed.size(), out));
+    EXPECT_TRUE(data == out) << "iteration " << i;
+  }
+
+  mt19937 rngZip(2);
+  map<string, string> entries;
+  for (int i = 0; i < 10; i++) {
+    entries["random" + to_string(i) + ".txt"] = RandomText(rngZip, rngZip() % 20000);
+  }
+  RoundTrip(entries);
+}
+
+TEST_F(InflateTest, RoundTrip_MultiBlock) {
+  // far more symbols than fit into one block
+  mt19937 rng(3);
+  const string text = RandomText(rng, 500000);
+  EXPECT_LT(RoundTrip({ { "text.txt", text } }), text.size() / 2);
+}
+
+TEST_F(InflateTest, RoundTrip_Stored) {
+  // incompressible data is stored
+  mt19937 rng(4);
+  const string data = RandomBytes(rng, 100000);
+  EXPECT_GT(RoundTrip({ { "random.bin", data } }), data.size());
+}
+
+TEST_F(InflateTest, RoundTrip_FarReferences) {
+  // repeated data beyond the 32 KiB window must not be referenced, data just inside is
+  mt19937 rng(5);
+  const string pattern = RandomBytes(rng, 1000);
+  map<string, string> entries;
+  for (size_t gap : { 32768 - 1000 - 1, 32768 - 1000, 32768 - 1000 + 1, 40000 }) {
+    entries["gap" + to_string(gap) + ".bin"] = pattern + RandomBytes(rng, gap) + pattern + pattern;
+  }
+  RoundTrip(entries);
+}
+
+TEST_F(InflateTest, RoundTrip_Empty) {
+  ASSERT_TRUE(RteFsUtils::CreateFile(inflateTestDir + "/empty.txt", ""));
+  ZipWriter zip;
+  zip.AddFile("file/empty.txt", inflateTestDir + "/empty.txt");
+  zip.AddData("data/empty.txt", "");
+  const string archive = inflateTestDir + "/empty.zip";
+  ASSERT_TRUE(zip.Write(archive)) << zip.GetError();
+  ZipReader reader;
+  ASSERT_TRUE(reader.Open(archive)) << reader.GetError();
+  string data = "not empty";
+  EXPECT_TRUE(reader.ReadEntry("file/empty.txt", data)) << reader.GetError();
+  EXPECT_TRUE(data.empty());
+  data = "not empty";
+  EXPECT_TRUE(reader.ReadEntry("data/empty.txt", data)) << reader.GetError();
+  EXPECT_TRUE(data.empty());
+
+  // empty final stored block
+  const unsigned char emptyStream[] = { 0x01, 0x00, 0x00, 0xFF, 0xFF };
+  EXPECT_TRUE(Inflate::Decompress(emptyStream, sizeof(emptyStream), data));
+  EXPECT_TRUE(data.empty());
+}
+
+TEST_F(InflateTest, Truncated) {
+  mt19937 rng(6);
+  const string text = RandomText(rng, 50000);
+  string compressed;
+  Deflate::Compress(reinterpret_cast<const unsigned char*>(text.data()), text.size(), compressed);
+  const auto stream = reinterpret_cast<const unsigned char*>(compressed.data());
+  string out;
+  EXPECT_TRUE(Inflate::Decompress(stream, compressed.size(), out));
+  EXPECT_EQ(text, out);
+  for (size_t size : { compressed.size() - 1, compressed.size() / 2, size_t(1), size_t(0) }) {
+    out.clear();
+    EXPECT_FALSE(Inflate::Decompress(stream, size, out)) << "size " << size;
+  }
+
+  // stored block shorter than its length
+  const unsigned char stored[] = { 0x01, 0x05, 0x00, 0xFA, 0xFF, 'a', 'b' };
+  EXPECT_FALSE(Inflate::Decompress(stored, sizeof(stored), out));
+}
+
+TEST_F(InflateTest, BadDistance) {
+  // fixed Huffman block: 'a', 'b', match of length 3 at distance 2
+  BitWriter valid;
+  valid.Put(1, 1);    // final block
+  valid.Put(1, 2);    // fixed Huffman codes
+  valid.PutLiteral('a');
+  valid.PutLiteral('b');
+  valid.PutMatch(257, 1);
+  valid.PutEndOfBlock();
+  string out;
+  EXPECT_TRUE(Inflate::Decompress(reinterpret_cast<const unsigned char*>(valid.Get().data()), valid.Get().size(), out));
+  EXPECT_EQ("ababa", out);
+
+  // distance 2 with only one byte of output
+  BitWriter invalid;
+  invalid.Put(1, 1);
+  invalid.Put(1, 2);
+  invalid.PutLiteral('a');
+  invalid.PutMatch(257, 1);
+  invalid.PutEndOfBlock();
+  out.clear();
+  EXPECT_FALSE(Inflate::Decompress(reinterpret_cast<const unsigned char*>(invalid.Get().data()), invalid.Get().size(), out));
+
+  // distance codes 30 and 31 are invalid
+  BitWriter invalidCode;
+  invalidCode.Put(1, 1);
+  invalidCode.Put(1, 2);
+  invalidCode.PutLiteral('a');
+  invalidCode.PutMatch(257, 30);
+  invalidCode.PutEndOfBlock();
+  out.clear();
+  EXPECT_FALSE(Inflate::Decompress(reinterpret_cast<const unsigned char*>(invalidCode.Get().data()), invalidCode.Get().size(), out));
+
+  // output appended to existing data must not reference it
+  BitWriter appended;
+  appended.Put(1, 1);
+  appended.Put(1, 2);
+  appended.PutMatch(257, 0);
+  appended.PutEndOfBlock();
+  out = "existing";
+  EXPECT_FALSE(Inflate::Decompress(reinterpret_cast<const unsigned char*>(appended.Get().data()), appended.Get().size(), out));
+}
+
+TEST_F(InflateTest, SizeLimit) {
+  const string zeros(1000000, '\0');
+  string compressed, out;
+  Deflate::Compress(reinterpret_cast<const unsigned char*>(zeros.data()), zeros.size(), compressed);
+  const auto stream = reinterpret_cast<const unsigned char*>(compressed.data());
+  EXPECT_TRUE(Inflate::Decompress(stream, compressed.size(), out, zeros.size()));
+  EXPECT_EQ(zeros.size(), out.size());
+  out.clear();
+  EXPECT_FALSE(Inflate::Decompress(stream, compressed.size(), out, zeros.size() - 1));
+  EXPECT_LE(out.size(), zeros.size() - 1);
+
+  // limit applies to appended output only
+  out = "existing";
+  const unsigned char stored[] = { 0x01, 0x02, 0x00, 0xFD, 0xFF, 'a', 'b' };
+  EXPECT_TRUE(Inflate::Decompress(stored, sizeof(stored), out, 2));
+  EXPECT_EQ("existingab", out);
+  EXPECT_FALSE(Inflate::Decompress(stored, sizeof(stored), out, 1));
+
+  // archive whose central directory declares fewer bytes than the entry inflates to
+  ZipWriter zip;
+  zip.AddData("bomb.bin", zeros);
+  const string archive = inflateTestDir + "/bomb.zip";
+  ASSERT_TRUE(zip.Write(archive)) << zip.GetError();
+  string content;
+  ASSERT_TRUE(RteFsUtils::ReadFile(archive, content));
+  const size_t central = content.rfind("PK\x01\x02");
+  ASSERT_NE(string::npos, central);
+  content.replace(central + 24, 4, string("\x64\x00\x00\x00", 4));
+  ASSERT_TRUE(RteFsUtils::CreateFile(archive, content));
+  ZipReader reader;
+  ASSERT_TRUE(reader.Open(archive)) << reader.GetError();
+  EXPECT_EQ(100u, reader.GetSize("bomb.bin"));
+  string data;
+  EXPECT_FALSE(reader.ReadEntry("bomb.bin", data));
+  EXPECT_EQ("invalid compressed data: bomb.bin", reader.GetError());
+  EXPECT_TRUE(data.empty());
+}
@@ -0,0 +1,126 @@
+/*
+ * Copyright (c) 2023 Arm Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "ZipReader.h"
+#include "ZipWriter.h"
+#include "RteFsUtils.h"
+
+#include "gtest/gtest.h"
+
+using namespace std;
+
+const string readerTestDir = "ZipReaderTest";
+
+// archive of another archiver: no directory entries, deflated with stored and fixed Huffman blocks, comment
+static const char FOREIGN_ARCHIVE[] =
+  "\x50\x4b\x03\x04\x14\x00\x00\x00\x08\x00\x00\x00\x21\x00\x67\xd8\x51\xf6\x21\x00\x00\x00\x1c\x00\x00\x00\x10\x00\x00\x00\x46\x69"
+  "\x6c\x65\x73\x2f\x73\x74\x6f\x72\x65\x64\x2e\x74\x78\x74\x01\x1c\x00\xe3\xff\x6c\x65\x76\x65\x6c\x20\x30\x20\x67\x69\x76\x65\x73"
+  "\x20\x73\x74\x6f\x72\x65\x64\x20\x62\x6c\x6f\x63\x6b\x73\x0a\x50\x4b\x03\x04\x14\x00\x00\x00\x08\x00\x00\x00\x21\x00\xf7\x43\x85"
+  "\x63\x14\x00\x00\x00\x1c\x00\x00\x00\x0f\x00\x00\x00\x46\x69\x6c\x65\x73\x2f\x66\x69\x78\x65\x64\x2e\x74\x78\x74\x4b\x4c\x4a\x4e"
+  "\x44\x42\x0a\x69\x99\x15\xa9\x29\x0a\xc9\xf9\x29\xa9\xc5\x5c\x00\x50\x4b\x01\x02\x14\x03\x14\x00\x00\x00\x08\x00\x00\x00\x21\x00"
+  "\x67\xd8\x51\xf6\x21\x00\x00\x00\x1c\x00\x00\x00\x10\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x80\x01\x00\x00\x00\x00\x46\x69"
+  "\x6c\x65\x73\x2f\x73\x74\x6f\x72\x65\x64\x2e\x74\x78\x74\x50\x4b\x01\x02\x14\x03\x14\x00\x00\x00\x08\x00\x00\x00\x21\x00\xf7\x43"
+  "\x85\x63\x14\x00\x00\x00\x1c\x00\x00\x00\x0f\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x80\x01\x4f\x00\x00\x00\x46\x69\x6c\x65"
+  "\x73\x2f\x66\x69\x78\x65\x64\x2e\x74\x78\x74\x50\x4b\x05\x06\x00\x00\x00\x00\x02\x00\x02\x00\x7b\x00\x00\x00\x90\x00\x00\x00\x0f"
+  "\x00\x61\x72\x63\x68\x69\x76\x65\x20\x63\x6f\x6d\x6d\x65\x6e\x74";
+
+class ZipReaderTest : public ::testing::Test {
+protected:
+  void SetUp() override
+  {
+    RteFsUtils::CreateDirectories(readerTestDir);
+  }
+  void TearDown() override
+  {
+    RteFsUtils::DeleteTree(readerTestDir);
+  }
+};
+
+TEST_F(ZipReaderTest, ReadWrittenArchive) {
+  string text;
+  for (int i = 0; i < 1000; i++) {
+    text += "line " + to_string(i % 10) + ": repeated text compresses well\n";
+  }
+  const string main = "int main(void) {\n  return 0;\n}\n";
+  ZipWriter zip;
+  zip.AddData("src/main.c", main);
+  zip.AddData("src/inc/header.h", "#define VALUE 1\n");
+  zip.AddData("doc/text.txt", text);
+  zip.AddData("empty.txt", "");
+  const string archive = readerTestDir + "/archive.zip";
+  ASSERT_TRUE(zip.Write(archive, 1)) << zip.GetError();
+
+  ZipReader reader;
+  ASSERT_TRUE(reader.Open(archive)) << reader.GetError();
+  EXPECT_EQ(archive, reader.GetArchiveFile());
+  EXPECT_TRUE(reader.Exists("src/main.c"));
+  EXPECT_TRUE(reader.Exists("src"));
+  EXPECT_TRUE(reader.IsDirectory("src/inc/"));
+  EXPECT_TRUE(reader.IsDirectory(""));
+  EXPECT_FALSE(reader.IsDirectory("src/main.c"));
+  EXPECT_FALSE(reader.Exists("src/unknown.c"));
+  EXPECT_EQ(text.size(), reader.GetSize("doc/text.txt"));
+
+  set<string> children;
+  EXPECT_TRUE(reader.GetChildren("", children));
+  EXPECT_EQ(set<string>({ "doc", "empty.txt", "src" }), children);
+  children.clear();
+  EXPECT_TRUE(reader.GetChildren("src", children));
+  EXPECT_EQ(set<string>({ "inc", "main.c" }), children);
+  EXPECT_FALSE(reader.GetChildren("unknown", children));
+
+  list<string> names;
+  reader.GetFileNames(names);
+  EXPECT_EQ(list<string>({ "doc/text.txt", "empty.txt", "src/inc/header.h", "src/main.c" }), names);
+
+  string data;
+  EXPECT_TRUE(reader.ReadEntry("doc/text.txt", data)) << reader.GetError();
+  EXPECT_EQ(text, data);
+  EXPECT_TRUE(reader.ReadEntry("src/main.c", data)) << reader.GetError();
+  EXPECT_EQ(main, data);
+  EXPECT_TRUE(reader.ReadEntry("empty.txt", data)) << reader.GetError();
+  EXPECT_TRUE(data.empty());
+  EXPECT_FALSE(reader.ReadEntry("src", data));
+  EXPECT_EQ("entry not found: src", reader.GetError());
+
+  reader.Close();
+  EXPECT_FALSE(reader.Exists("src/main.c"));
+}
+
+TEST_F(ZipReaderTest, ReadForeignArchive) {
+  const string archive = readerTestDir + "/foreign.zip";
+  ASSERT_TRUE(RteFsUtils::CreateFile(archive, string(FOREIGN_ARCHIVE, sizeof(FOREIGN_ARCHIVE) - 1)));
+
+  ZipReader reader;
+  ASSERT_TRUE(reader.Open(archive)) << reader.GetError();
+  EXPECT_TRUE(reader.IsDirectory("Files"));
+  string data;
+  EXPECT_TRUE(reader.ReadEntry("Files/stored.txt", data)) << reader.GetError();
+  EXPECT_EQ("level 0 gives stored blocks\n", data);
+  EXPECT_TRUE(reader.ReadEntry("Files/fixed.txt", data)) << reader.GetError();
+  EXPECT_EQ("abcabcabcabcabc fixed codes\n", data);
+}
+
+TEST_F(ZipReaderTest, InvalidArchive) {
+  ZipReader reader;
+  const string archive = readerTestDir + "/invalid.zip";
+  EXPECT_FALSE(reader.Open(archive));
+  EXPECT_EQ("cannot open archive file: " + archive, reader.GetError());
+
+  ASSERT_TRUE(RteFsUtils::CreateFile(archive, "no ZIP archive, but long enough to be one"));
+  EXPECT_FALSE(reader.Open(archive));
+  EXPECT_EQ("invalid ZIP archive: " + archive, reader.GetError());
+
+  // corrupt content of stored block
+  string content(FOREIGN_ARCHIVE, sizeof(FOREIGN_ARCHIVE) - 1);
+  content[content.find("level 0")] = 'L';
+  ASSERT_TRUE(RteFsUtils::CreateFile(archive, content));
+  ASSERT_TRUE(reader.Open(archive)) << reader.GetError();
+  string data;
+  EXPECT_FALSE(reader.ReadEntry("Files/stored.txt", data));
+  EXPECT_EQ("CRC or size mismatch: Files/stored.txt", reader.GetError());
+  EXPECT_TRUE(reader.ReadEntry("Files/fixed.txt", data)) << reader.GetError();
+}
@@ -0,0 +1,175 @@
+/*
+ * Copyright (c) 2023 Arm Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "ZipWriter.h"
+#include "ZipReader.h"
+#include "RteFsUtils.h"
+
+#include "gtest/gtest.h"
+
+#include <cstdio>
+#include <random>
+
+using namespace std;
+
+const string testDir = "ZipWriterTest";
+
+class ZipWriterTest : public ::testing::Test {
+protected:
+  void SetUp() override
+  {
+    RteFsUtils::CreateDirectories(testDir + "/src/inc");
+    RteFsUtils::CreateFile(testDir + "/src/main.c", "int main(void) {\n  return 0;\n}\n");
+    RteFsUtils::CreateFile(testDir + "/src/inc/header.h", "#define VALUE 1\n");
+  }
+  void TearDown() override
+  {
+    RteFsUtils::DeleteTree(testDir);
+  }
+
+  static uint32_t Get16(const string& buf, size_t pos) {
+    return static_cast<uint8_t>(buf[pos]) | (static_cast<uint8_t>(buf[pos + 1]) << 8);
+  }
+  static uint32_t Get32(const string& buf, size_t pos) {
+    return Get16(buf, pos) | (Get16(buf, pos + 2) << 16);
+  }
+};
+
+TEST_F(ZipWriterTest, Crc32) {
+  const string data = "123456789";
+  EXPECT_EQ(0xCBF43926, ZipWriter::Crc32(data.data(), data.size()));
+  EXPECT_EQ(0xCBF43926, ZipWriter::Crc32(data.data() + 4, 5, ZipWriter::Crc32(data.data(), 4)));
+  EXPECT_EQ(0, ZipWriter::Crc32(nullptr, 0));
+}
+
+TEST_F(ZipWriterTest, Write) {
+  string text;
+  for (int i = 0; i < 1000; i++) {
+    text += "line " + to_string(i % 10) + ": repeated text compresses well\n";
+  }
+  ZipWriter zip;
+  zip.AddFile("src/main.c", testDir + "/src/main.c");
+  zip.AddFile("src/inc/header.h", testDir + "/src/inc/header.h");
+  zip.AddData("doc/text.txt", text);
+  zip.AddData("empty.txt", "");
+  EXPECT_EQ(4, zip.GetEntryCount());
+
+  const string archive1 = testDir + "/archive1.zip";
+  ASSERT_TRUE(zip.Write(archive1, 1)) << zip.GetError();
+  string buf;
+  ASSERT_TRUE(RteFsUtils::ReadFile(archive1, buf));
+  EXPECT_LT(buf.size(), text.size() / 10);
+
+  // local header of first entry, sorted names
+  EXPECT_EQ(0x04034b50, Get32(buf, 0));
+  EXPECT_EQ("doc/", buf.substr(30, Get16(buf, 26)));
+
+  // end of central directory: 4 entries and 3 parent directories
+  const size_t end = buf.size() - 22;
+  EXPECT_EQ(0x06054b50, Get32(buf, end));
+  EXPECT_EQ(7, Get16(buf, end + 10));
+
+  // reproducible, independent of number of threads and order entries are added in
+  ZipWriter zip2;
+  zip2.AddData("empty.txt", "");
+  zip2.AddData("doc/text.txt", text);
+  zip2.AddFile("src/inc/header.h", testDir + "/src/inc/header.h");
+  zip2.AddFile("src/main.c", testDir + "/src/main.c");
+  const string archive2 = testDir + "/archive2.zip";
+  ASSERT_TRUE(zip2.Write(archive2, 4)) << zip2.GetError();
+  string buf2;
+  ASSERT_TRUE(RteFsUtils::ReadFile(archive2, buf2));
+  EXPECT_EQ(buf, buf2);
+}
+
+TEST_F(ZipWriterTest, Write_MissingFile) {
+  ZipWriter zip;
+  zip.AddFile("src/main.c", testDir + "/src/main.c");
+  zip.AddFile("src/unknown.c", testDir + "/src/unknown.c");
+  const string archive = testDir + "/archive.zip";
+  EXPECT_FALSE(zip.Write(archive));
+  EXPECT_EQ("cannot read file: " + testDir + "/src/unknown.c", zip.GetError());
+  EXPECT_FALSE(RteFsUtils::Exists(archive));
+
+  zip.Clear();
+  EXPECT_EQ(0, zip.GetEntryCount());
+  EXPECT_TRUE(zip.Write(archive));
+  EXPECT_TRUE(zip.GetError().empty());
+}
+
+TEST_F(ZipWriterTest, Write_RoundTrip) {
+  // compressible text, random binary data and empty entries, read back through ZipReader
+  mt19937 rng(42);
+  string binary(100000, '\0');
+  for (auto& c : binary) {
+    c = static_cast<char>(rng());
+  }
+  string text;
+  for (int i = 0; i < 5000; i++) {
+    text += "#define REGISTER_" + to_string(i) + " (0x4000" + to_string(i % 97) + "UL)\n";
+  }
+  const map<string, string> entries = {
+    { "bin/random.bin", binary },
+    { "inc/registers.h", text },
+    { "inc/empty.h", "" },
+    { "readme.txt", "x" },
+  };
+  ZipWriter zip;
+  for (const auto& [name, data] : entries) {
+    zip.AddData(name, data);
+  }
+  zip.AddFile("src/main.c", testDir + "/src/main.c");
+  const string archive = testDir + "/roundtrip.zip";
+  ASSERT_TRUE(zip.Write(archive, 3)) << zip.GetError();
+
+  ZipReader reader;
+  ASSERT_TRUE(reader.Open(archive)) << reader.GetError();
+  for (const auto& [name, expected] : entries) {
+    string data;
+    EXPECT_TRUE(reader.ReadEntry(name, data)) << reader.GetError();
+    EXPECT_EQ(expected, data) << name;
+  }
+  string main;
+  EXPECT_TRUE(reader.ReadEntry("src/main.c", main)) << reader.GetError();
+  EXPECT_EQ("int main(void) {\n  return 0;\n}\n", main);
+}
+
+TEST_F(ZipWriterTest, Write_EntryLimit) {
+  // 0xFFFF entries and 0xFFFFFFFF sizes indicate ZIP64 archives
+  EXPECT_EQ(0xFFFEu, ZipWriter::MAX_ENTRIES);
+  EXPECT_EQ(0xFFFFFFFEu, ZipWriter::MAX_SIZE);
+
+  ZipWriter zip;
+  char name[16];
+  for (size_t i = 0; i < ZipWriter::MAX_ENTRIES; i++) {
+    snprintf(name, sizeof(name), "f%05zu", i);
+    zip.AddData(name, "");
+  }
+  const string archive = testDir + "/limit.zip";
+  ASSERT_TRUE(zip.Write(archive)) << zip.GetError();
+  ZipReader reader;
+  ASSERT_TRUE(reader.Open(archive)) << reader.GetError();
+  list<string> names;
+  reader.GetFileNames(names);
+  EXPECT_EQ(ZipWriter::MAX_ENTRIES, names.size());
+  reader.Close();
+
+  // one more entry, the count would be the ZIP64 marker
+  zip.AddData("more", "");
+  EXPECT_FALSE(zip.Write(testDir + "/more.zip"));
+  EXPECT_EQ("too many entries for ZIP archive: 65535", zip.GetError());
+  EXPECT_FALSE(RteFsUtils::Exists(testDir + "/more.zip"));
+
+  // parent directories count as entries
+  zip.Clear();
+  for (size_t i = 0; i + 1 < ZipWriter::MAX_ENTRIES; i++) {
+    snprintf(name, sizeof(name), "dir/f%05zu", i);
+    zip.AddData(name, "");
+  }
+  EXPECT_TRUE(zip.Write(archive)) << zip.GetError();
+  zip.AddData("more", "");
+  EXPECT_FALSE(zip.Write(testDir + "/more.zip"));
+}
@@ -65,6 +65,14 @@ public:
   */
   std::string ExpandString(const std::string& str) override;
 
+  /**
+   * @brief expand string components of the cbuild model, the target is not used
+   * @param str string to be expanded
+   * @param target pointer to RteTarget
+   * @return expanded string
+  */
+  std::string ExpandString(const std::string& str, RteTarget* target) override;
+
 protected:
   std::list<std::string> m_errorMessages;
 
@@ -551,6 +551,19 @@ public:
   */
   const RteTarget* GetTarget() const;
 
+  /**
+   * @brief get files and directories the model has been evaluated from
+   * @param files set of project, toolchain configuration, pack and generator description and config files
+   * @param dirs set of pack directories and compiler root, installed pack versions and toolchain configuration files are selected from their content
+  */
+  void GetInputFiles(std::set<std::string>& files, std::set<std::string>& dirs) const;
+
+  /**
+   * @brief get RTE files generated by the model
+   * @return set of generated RTE header files
+  */
+  std::set<std::string> GetGeneratedFiles() const;
+
 protected:
   /**
    * @brief Kind of Translation Controls
@@ -591,6 +604,7 @@ protected:
   std::string                                       m_compiler;
   std::string                                       m_compilerVersion;
   std::string                                       m_toolchainConfig;
+  std::string                                       m_compilerRoot;
   std::vector<std::string>                          m_targetCFlags;
   std::vector<std::string>                          m_targetCxxFlags;
   std::vector<std::string>                          m_targetAsFlags;
@@ -630,6 +644,10 @@ protected:
   std::map<std::string, std::set<std::string>>      m_layerFiles;
   std::map<std::string, std::set<std::string>>      m_layerPackages;
 
+  // translation controls evaluation caches, keyed by parent group item
+  std::map<const RteItem*, std::string>             m_parentNames;
+  std::map<std::pair<const void*, const RteItem*>, const std::vector<std::string>*> m_parentTransCtrls;
+
   void Init(const std::string &file, const std::string &rtePath);
   bool EvaluateResult();
   bool EvalConfigFiles();
@@ -651,7 +669,7 @@ protected:
   bool SetItemFlags(const RteItem* item, const std::string& name);
   bool SetItemOptions(const RteItem* item, const std::string& name);
   bool SetItemIncludesDefines(const RteItem* item, const std::string& name);
-  const std::string GetParentName(const RteItem* item);
+  const std::string& GetParentName(const RteItem* item);
   const std::vector<std::string>& GetParentTranslationControls(const RteItem* item, std::map<std::string, std::vector<std::string>>& transCtrlMap, const std::vector<std::string>& targetTransCtrls);
   bool GenerateAuditData();
   bool GenerateFixedCprj(const std::string& update);
@@ -67,3 +67,7 @@ string CbuildCallback::ExpandString(const string& str) {
 
   return res;
 }
+
+string CbuildCallback::ExpandString(const string& str, RteTarget* target) {
+  return ExpandString(str);
+}
@@ -418,6 +418,7 @@ bool CbuildModel::EvaluateToolchainConfig(const string& name, const string& vers
   */
 
   // Search registered toolchains and config files in the compiler root
+  m_compilerRoot = compilerRoot;
   if (GetCompatibleToolchain(name, versionRange, compilerRoot, envVars)) {
     return true;
   }
@@ -861,13 +862,17 @@ vector<string> CbuildModel::MergeArgs(const vector<string>& add, const vector<st
   return list;
 }
 
-const string CbuildModel::GetParentName(const RteItem* item) {
+const string& CbuildModel::GetParentName(const RteItem* item) {
   /*
   GetParentName
-  Get (nested) parent group name
+  Get (nested) parent group name, cached per parent item
   */
 
   RteItem* parent = item->GetParent();
+  auto it = m_parentNames.find(parent);
+  if (it != m_parentNames.end()) {
+    return it->second;
+  }
   string parentName;
   while (parent) {
     const string& tag = parent->GetTag();
@@ -882,29 +887,37 @@ const string CbuildModel::GetParentName(const RteItem* item) {
     parentName = name + (parentName.empty() ? "" : "/" + parentName);
     parent = parent->GetParent();
   }
-  return parentName;
+  return m_parentNames.emplace(item->GetParent(), parentName).first->second;
 }
 
 const vector<string>& CbuildModel::GetParentTranslationControls(const RteItem* item, map<string, vector<string>>& transCtrlMap, const vector<string>& targetTransCtrls) {
   /*
   GetParentTranslationControls
-  Get next non-empty parent group or target translation control
+  Get next non-empty parent group or target translation control.
+  The result is cached per parent item: groups are evaluated before their children,
+  so all items of a group share the same parent translation controls.
   */
 
+  const auto key = make_pair(static_cast<const void*>(&transCtrlMap), static_cast<const RteItem*>(item->GetParent()));
+  auto it = m_parentTransCtrls.find(key);
+  if (it != m_parentTransCtrls.end()) {
+    return *it->second;
+  }
+  const vector<string>* parentTransCtrls = &targetTransCtrls;
   string parentName = GetParentName(item);
   while (!parentName.empty()) {
-    if (transCtrlMap.find(parentName) != transCtrlMap.end()) {
-      const vector<string>& properties = transCtrlMap.at(parentName);
-      if (!properties.empty()) {
-        return properties;
-      }
+    auto properties = transCtrlMap.find(parentName);
+    if (properties != transCtrlMap.end() && !properties->second.empty()) {
+      parentTransCtrls = &properties->second;
+      break;
     }
     size_t delim = parentName.find_last_of('/');
     if (delim == string::npos)
       break;
-    parentName = parentName.substr(0, delim);
+    parentName.erase(delim);
   }
-  return targetTransCtrls;
+  m_parentTransCtrls.emplace(key, parentTransCtrls);
+  return *parentTransCtrls;
 }
 
 bool CbuildModel::SetItemFlags(const RteItem* item, const string& name) {
@@ -1005,7 +1018,7 @@ bool CbuildModel::SetItemIncludesDefines(const RteItem* item, const string& name
       if (CbuildUtils::NormalizePath(exclude, m_prjFolder)) {
         continue;
       }
-      regex regEx{ "^\\$.*\\$$" };
+      static const regex regEx{ "^\\$.*\\$$" };
       if (regex_search(exclude, regEx)) {
         continue;
       }
@@ -1018,7 +1031,7 @@ bool CbuildModel::SetItemIncludesDefines(const RteItem* item, const string& name
       if (CbuildUtils::NormalizePath(include, m_prjFolder)) {
         continue;
       }
-      regex regEx{ "^\\$.*\\$$" };
+      static const regex regEx{ "^\\$.*\\$$" };
       if (regex_search(include, regEx)) {
         continue;
       }
@@ -1050,7 +1063,7 @@ bool CbuildModel::EvalIncludesDefines() {
           normalizedIncludesList.push_back(include);
           continue;
         }
-        regex regEx{ "^\\$.*\\$$" };
+        static const regex regEx{ "^\\$.*\\$$" };
         if (regex_search(include, regEx)) {
           normalizedIncludesList.push_back(include);
           continue;
@@ -1502,3 +1515,68 @@ const RteTarget* CbuildModel::GetTarget() const
   }
   return nullptr;
 }
+
+void CbuildModel::GetInputFiles(set<string>& files, set<string>& dirs) const {
+  /*
+  GetInputFiles:
+  Collect files and directories the model is evaluated from
+  */
+  files.insert(RteFsUtils::AbsolutePath(m_cprjFile).generic_string());
+  if (!m_toolchainConfig.empty()) {
+    files.insert(m_toolchainConfig);
+  }
+  // the toolchain config file is selected from the config files in the compiler root
+  if (!m_compilerRoot.empty()) {
+    string compilerRoot = m_compilerRoot;
+    RteFsUtils::NormalizePath(compilerRoot);
+    dirs.insert(compilerRoot);
+  }
+
+  // pack description files of the target and the local repository index
+  if (m_cprjTarget && m_cprjTarget->GetFilteredModel()) {
+    for (const auto& [id, pack] : m_cprjTarget->GetFilteredModel()->GetPackages()) {
+      files.insert(pack->GetPackageFileName());
+    }
+  }
+  files.insert(m_rtePath + ".Local/local_repository.pidx");
+
+  // installed versions of required packs
+  if (m_cprj && m_cprj->GetItemByTag("packages")) {
+    for (const RteItem* pack : m_cprj->GetItemByTag("packages")->GetChildren()) {
+      if (!pack->HasAttribute("path")) {
+        dirs.insert(m_rtePath + pack->GetAttribute("vendor") + '/' + pack->GetAttribute("name"));
+      }
+    }
+  }
+
+  if (m_cprjProject) {
+    // generator description files, also the ones not generated yet
+    for (const auto& [name, gi] : m_cprjProject->GetGpdscInfos()) {
+      files.insert(gi->GetAbsolutePath());
+    }
+    // project config files
+    for (const auto& [name, fi] : m_cprjProject->GetFileInstances()) {
+      if (fi && fi->IsUsedByTarget(m_targetName)) {
+        files.insert(m_cprjProject->GetProjectPath() + RteUtils::BackSlashesToSlashes(fi->GetInstanceName()));
+      }
+    }
+  }
+}
+
+set<string> CbuildModel::GetGeneratedFiles() const {
+  /*
+  GetGeneratedFiles:
+  Collect RTE header files generated for the target
+  */
+  set<string> files(m_preIncludeFilesGlobal.begin(), m_preIncludeFilesGlobal.end());
+  for (const auto& [component, preIncludes] : m_preIncludeFilesLocal) {
+    files.insert(preIncludes.begin(), preIncludes.end());
+  }
+  if (m_cprjProject && m_cprjTarget) {
+    const string& rteComponentsH = m_cprjProject->GetRteComponentsH(m_cprjTarget->GetName(), m_prjFolder);
+    if (RteFsUtils::Exists(rteComponentsH)) {
+      files.insert(rteComponentsH);
+    }
+  }
+  return files;
+}
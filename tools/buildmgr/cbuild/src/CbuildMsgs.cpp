@@ -96,6 +96,7 @@ void InitMessageTable()
   table["M655"] = MessageEntry(MsgLevel::LEVEL_INFO,     CRLF_B,   "'%VAR%' environment variable was not set!"                                   );
   table["M656"] = MessageEntry(MsgLevel::LEVEL_INFO,     CRLF_B,   "Package '%VENDOR%.%NAME%.%VER%' was found in local repository '%PATH%'!"     );
   table["M657"] = MessageEntry(MsgLevel::LEVEL_INFO,     CRLF_B,   "Generated updated project description file: '%NAME%'"                        );
+  table["M658"] = MessageEntry(MsgLevel::LEVEL_INFO,     CRLF_B,   "File for project build is up to date: '%NAME%'"                              );
 
   // 800... Model Errors
   table["M800"] = MessageEntry(MsgLevel::LEVEL_ERROR,    CRLF_B,   "RTE Model reports: %MSG%"                                                    );
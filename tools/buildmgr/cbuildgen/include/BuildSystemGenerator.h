@@ -111,6 +111,7 @@ public:
 
   std::string m_projectDir;
   std::string m_genfile;
+  std::string m_auditfile;
   std::string m_workingDir;
 
 protected:
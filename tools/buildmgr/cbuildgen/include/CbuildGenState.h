@@ -0,0 +1,82 @@
+/*
+ * Copyright (c) 2023 Arm Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef CBUILDGENSTATE_H
+#define CBUILDGENSTATE_H
+
+#include "CbuildModel.h"
+
+#include <set>
+#include <string>
+#include <vector>
+
+/**
+ * @brief state of the last successful 'cmake' command, stored in <IntDir>/<ProjectName>.cstate:
+ *        cbuildgen version, command line options, hashes of the files and directories
+ *        the RTE model was evaluated from and the list of generated files.
+ *        The state is located before the RTE model is created, so an unchanged project
+ *        skips model evaluation and file generation entirely.
+*/
+class CbuildGenState {
+public:
+  /**
+   * @brief class constructor
+   * @param cprjFile path to cprj project file
+   * @param intdir intermediate directory option, the cprj 'intdir' field is used if empty
+   * @param options command line options and settings affecting the generated files
+  */
+  CbuildGenState(const std::string& cprjFile, const std::string& intdir, const std::vector<std::string>& options);
+
+  /**
+   * @brief class destructor
+  */
+  ~CbuildGenState(void);
+
+  /**
+   * @brief check whether the files generated by the last run are up to date
+   * @return true if options, input files and directories did not change and all generated files exist
+  */
+  bool IsUpToDate(void) const;
+
+  /**
+   * @brief write state file after successful generation
+   * @param model pointer to evaluated RTE Model
+   * @param outputs generated files
+   * @return true if state file is written, otherwise false
+  */
+  bool Save(const CbuildModel* model, const std::set<std::string>& outputs) const;
+
+  /**
+   * @brief remove state file so the next run does not rely on an outdated state
+  */
+  void Invalidate(void) const;
+
+  /**
+   * @brief get path of state file
+   * @return string path to state file
+  */
+  const std::string& GetFileName(void) const { return m_fileName; }
+
+  /**
+   * @brief get path of intermediate directory
+   * @return string path to intermediate directory including trailing slash
+  */
+  const std::string& GetIntDir(void) const { return m_intdir; }
+
+  /**
+   * @brief calculate hash of directory listing
+   * @param dir string path to directory
+   * @return hash of sorted entry names, empty string if directory does not exist
+  */
+  static std::string GetDirHash(const std::string& dir);
+
+protected:
+  std::string m_intdir;
+  std::string m_fileName;
+  std::vector<std::string> m_options;
+};
+
+#endif  // CBUILDGENSTATE_H
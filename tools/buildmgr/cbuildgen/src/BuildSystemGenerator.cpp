@@ -16,6 +16,7 @@
 #include "RteFsUtils.h"
 #include "RteUtils.h"
 
+#include <algorithm>
 #include <ctime>
 #include <fstream>
 #include <iostream>
@@ -205,7 +206,7 @@ bool BuildSystemGenerator::CollectMiscDefinesIncludes(const CbuildModel* model)
     }
   }
 
-  const map<string, bool> assembler = model->GetAsm();
+  const map<string, bool>& assembler = model->GetAsm();
   m_asTargetAsm = (!assembler.empty()) && (assembler.find("") != assembler.end()) ? assembler.at("") : false;
 
   for (const auto& [group, files] : model->GetAsmSourceFiles())
@@ -261,12 +262,13 @@ bool BuildSystemGenerator::CollectMiscDefinesIncludes(const CbuildModel* model)
 
 bool BuildSystemGenerator::CollectTranslationControls(const CbuildModel* model) {
   // Optimize, debug, warnings, languageC and languageCpp options
-  vector<std::map<std::string, std::list<std::string>>> sourceFilesList = {
-    model->GetAsmSourceFiles(), model->GetCSourceFiles(), model->GetCxxSourceFiles()
+  const vector<const map<string, list<string>>*> sourceFilesList = {
+    &model->GetAsmSourceFiles(), &model->GetCSourceFiles(), &model->GetCxxSourceFiles()
   };
 
-  for (const auto& sourceFiles : sourceFilesList)
+  for (const auto& sourceFilesPtr : sourceFilesList)
   {
+    const auto& sourceFiles = *sourceFilesPtr;
     if (sourceFiles.empty()) continue;
 
     const map<string, string>& optimizeOpt = model->GetOptimizeOption();
@@ -372,10 +374,10 @@ bool BuildSystemGenerator::GenAuditFile(void) {
   }
 
   // Create audit file
-  string filename = m_outdir + m_projectName + LOGEXT;
-  ofstream auditFile(filename);
+  m_auditfile = m_outdir + m_projectName + LOGEXT;
+  ofstream auditFile(m_auditfile);
   if (!auditFile) {
-    LogMsg("M210", PATH(filename));
+    LogMsg("M210", PATH(m_auditfile));
     return false;
   }
 
@@ -462,43 +464,31 @@ template string BuildSystemGenerator::GetString<list<string>>(list<string>);
 bool BuildSystemGenerator::CompareFile(const string& filename, stringstream& buffer) const {
   /*
   CompareFile:
-  Compare file contents
+  Compare file contents, lines starting with '#' in both contents are ignored
   */
-  ifstream fileStream;
-  string line1, line2;
-
-  // open the file if it exists
-  fileStream.open(filename);
-  if (!fileStream.is_open()) {
+  string content;
+  if (!RteFsUtils::ReadFile(filename, content) || content.empty()) {
     return false;
   }
-
-  // file is empty
-  if (fileStream.peek() == ifstream::traits_type::eof()) {
-    fileStream.close();
-    return false;
-  }
-
-  // iterate over file and buffer lines
-  while (getline(fileStream, line1), getline(buffer, line2)) {
-    if (line1 != line2) {
-      // ignore commented lines
-      if ((!line1.empty() && line1.at(0) == '#') && (!line2.empty() && line2.at(0) == '#')) continue;
+  const string& generated = buffer.str();
+
+  // iterate over file and buffer lines without copying them
+  size_t pos1 = 0, pos2 = 0;
+  while (pos1 < content.size() && pos2 < generated.size()) {
+    const size_t end1 = min(content.find('\n', pos1), content.size());
+    const size_t end2 = min(generated.find('\n', pos2), generated.size());
+    const size_t len1 = (end1 > pos1 && content[end1 - 1] == '\r') ? end1 - pos1 - 1 : end1 - pos1;
+    const bool comments = content[pos1] == '#' && generated[pos2] == '#';
+    if (!comments && content.compare(pos1, len1, generated, pos2, end2 - pos2) != 0) {
       // a difference was found
-      break;
+      return false;
     }
+    pos1 = end1 + 1;
+    pos2 = end2 + 1;
   }
 
-  // check if both streams where fully scanned
-  bool done = fileStream.eof() && buffer.eof() ? true : false;
-
-  // rewind stream buffer
-  buffer.clear();
-  buffer.seekg(0);
-
-  // return true if contents are identical
-  fileStream.close();
-  return done;
+  // return true if both contents were fully scanned
+  return pos1 >= content.size() && pos2 >= generated.size();
 }
 
 void BuildSystemGenerator::CollectGroupDefinesIncludes(
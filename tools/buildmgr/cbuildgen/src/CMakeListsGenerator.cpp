@@ -146,10 +146,10 @@ bool CMakeListsGenerator::GenBuildCMakeLists(void) {
 
   // group specific defines
   bool group_specific_defines = false;
-  for (auto [group, controls] : m_groupsList) {
+  for (const auto& [group, controls] : m_groupsList) {
     if (!controls.defines.empty()) {
       for (auto& filesList : filesLists) {
-        for (auto [src, file] : *filesList) {
+        for (const auto& [src, file] : *filesList) {
           if ((fs::path(file.group).generic_string() == group) && (file.defines.empty())) {
             list<string> segments;
             RteUtils::SplitString(segments, controls.defines, ' ');
@@ -190,7 +190,7 @@ bool CMakeListsGenerator::GenBuildCMakeLists(void) {
 
   // group specific options (optimize, debug, warnings, languageC, languageCpp)
   bool group_specific_options = false;
-  for (auto [group, controls] : m_groupsList) {
+  for (const auto& [group, controls] : m_groupsList) {
     map<string, string> group_options = {
       {"OPTIMIZE", controls.optimize},
       {"DEBUG", controls.debug},
@@ -205,7 +205,7 @@ bool CMakeListsGenerator::GenBuildCMakeLists(void) {
           ((option == "LANGUAGE_CXX") && (filesList != &m_cxxFilesList))) {
           continue;
         }
-        for (auto [src, file] : *filesList) {
+        for (const auto& [src, file] : *filesList) {
           if (fs::path(file.group).generic_string() != group) continue;
           map<string, string> file_options = {
             {"OPTIMIZE", file.optimize},
@@ -254,10 +254,10 @@ bool CMakeListsGenerator::GenBuildCMakeLists(void) {
 
   // group specific includes
   bool group_specific_includes = false;
-  for (auto [group, controls] : m_groupsList) {
+  for (const auto& [group, controls] : m_groupsList) {
     if (!controls.includes.empty()) {
       for (auto& filesList : filesLists) {
-        for (auto [src, file] : *filesList) {
+        for (const auto& [src, file] : *filesList) {
           if ((fs::path(file.group).generic_string() == group) && (file.includes.empty())) {
             list<string> segments;
             RteUtils::SplitString(segments, CbuildUtils::EscapeQuotes(controls.includes), ' ');
@@ -284,11 +284,11 @@ bool CMakeListsGenerator::GenBuildCMakeLists(void) {
   asFilesLists = {{"ASM", m_asFilesList}, {"AS_LEG", m_asLegacyFilesList}, {"AS_ARM", m_asArmclangFilesList}, {"AS_GNU", m_asGnuFilesList}};
 
   // Source Files
-  for (auto list : asFilesLists) {
+  for (const auto& list : asFilesLists) {
     if (!list.second.empty()) {
       string prefix = list.first;
       cmakelists << "set(" << prefix << "_SRC_FILES";
-      for (auto [src, _] : list.second) {
+      for (const auto& [src, _] : list.second) {
         cmakelists << EOL << "  \"" << src << "\"";
       }
       cmakelists << EOL << ")" << EOL << EOL;
@@ -297,7 +297,7 @@ bool CMakeListsGenerator::GenBuildCMakeLists(void) {
 
   if (!m_ccFilesList.empty()) {
     cmakelists << "set(CC_SRC_FILES";
-    for (auto [src, _] : m_ccFilesList) {
+    for (const auto& [src, _] : m_ccFilesList) {
       cmakelists << EOL << "  \"" << src << "\"";
     }
     cmakelists << EOL << ")" << EOL << EOL;
@@ -305,7 +305,7 @@ bool CMakeListsGenerator::GenBuildCMakeLists(void) {
 
   if (!m_cxxFilesList.empty()) {
     cmakelists << "set(CXX_SRC_FILES";
-    for (auto [src, _] : m_cxxFilesList) {
+    for (const auto& [src, _] : m_cxxFilesList) {
       cmakelists << EOL << "  \"" << src << "\"";
     }
     cmakelists << EOL << ")" << EOL << EOL;
@@ -331,12 +331,12 @@ bool CMakeListsGenerator::GenBuildCMakeLists(void) {
 
   // Pre-Include Local
   bool preinc_local = false;
-  for (auto [group, controls] : m_groupsList) {
+  for (const auto& [group, controls] : m_groupsList) {
     if (!controls.preinc.empty()) {
       preinc_local = true;
       auto lists = {&m_ccFilesList, &m_cxxFilesList};
       for (auto list: lists) {
-        for (auto [src, file] : *list) {
+        for (const auto& [src, file] : *list) {
           if (fs::path(file.group).generic_string() == group) {
             cmakelists << "set(PRE_INC_LOCAL_" << CbuildUtils::ReplaceSpacesByQuestionMarks(src);
             for (auto it : controls.preinc) {
@@ -351,8 +351,8 @@ bool CMakeListsGenerator::GenBuildCMakeLists(void) {
 
   // File specific flags
   bool as_file_specific_flags = false;
-  for (auto list : asFilesLists) {
-    for (auto [src, file] : list.second) {
+  for (const auto& list : asFilesLists) {
+    for (const auto& [src, file] : list.second) {
       if (!file.flags.empty()) {
         cmakelists << "set(AS_FLAGS_" << CbuildUtils::ReplaceSpacesByQuestionMarks(src) << " \"" << CbuildUtils::EscapeQuotes(file.flags) << "\")"<< EOL;
         as_file_specific_flags = true;
@@ -360,14 +360,14 @@ bool CMakeListsGenerator::GenBuildCMakeLists(void) {
     }
   }
   bool cc_file_specific_flags = false;
-  for (auto [src, file] : m_ccFilesList) {
+  for (const auto& [src, file] : m_ccFilesList) {
     if (!file.flags.empty()) {
       cmakelists << "set(CC_FLAGS_" << CbuildUtils::ReplaceSpacesByQuestionMarks(src) << " \"" << CbuildUtils::EscapeQuotes(file.flags) << "\")"<< EOL;
       cc_file_specific_flags = true;
     }
   }
   bool cxx_file_specific_flags = false;
-  for (auto [src, file] : m_cxxFilesList) {
+  for (const auto& [src, file] : m_cxxFilesList) {
     if (!file.flags.empty()) {
       cmakelists << "set(CXX_FLAGS_" << CbuildUtils::ReplaceSpacesByQuestionMarks(src) << " \"" << CbuildUtils::EscapeQuotes(file.flags) << "\")"<< EOL;
       cxx_file_specific_flags = true;
@@ -378,10 +378,10 @@ bool CMakeListsGenerator::GenBuildCMakeLists(void) {
   bool as_group_specific_flags = false;
   bool cc_group_specific_flags = false;
   bool cxx_group_specific_flags = false;
-  for (auto [group, controls] : m_groupsList) {
+  for (const auto& [group, controls] : m_groupsList) {
     if (!controls.asMsc.empty()) {
-       for (auto list : asFilesLists) {
-         for (auto [src, file] : list.second) {
+       for (const auto& list : asFilesLists) {
+         for (const auto& [src, file] : list.second) {
            if ((fs::path(file.group).generic_string() == group) && (file.flags.empty())) {
             cmakelists << "set(AS_FLAGS_" << CbuildUtils::ReplaceSpacesByQuestionMarks(src) << " \"" << CbuildUtils::EscapeQuotes(controls.asMsc) << "\")"<< EOL;
             as_group_specific_flags = true;
@@ -390,7 +390,7 @@ bool CMakeListsGenerator::GenBuildCMakeLists(void) {
       }
     }
     if (!controls.ccMsc.empty()) {
-      for (auto [src, file] : m_ccFilesList) {
+      for (const auto& [src, file] : m_ccFilesList) {
         if ((fs::path(file.group).generic_string() == group) && (file.flags.empty())) {
           cmakelists << "set(CC_FLAGS_" << CbuildUtils::ReplaceSpacesByQuestionMarks(src) << " \"" << CbuildUtils::EscapeQuotes(controls.ccMsc) << "\")"<< EOL;
           cc_group_specific_flags = true;
@@ -398,7 +398,7 @@ bool CMakeListsGenerator::GenBuildCMakeLists(void) {
       }
     }
     if (!controls.cxxMsc.empty()) {
-      for (auto [src, file] : m_cxxFilesList) {
+      for (const auto& [src, file] : m_cxxFilesList) {
         if ((fs::path(file.group).generic_string() == group) && (file.flags.empty())) {
           cmakelists << "set(CXX_FLAGS_" << CbuildUtils::ReplaceSpacesByQuestionMarks(src) << " \"" << CbuildUtils::EscapeQuotes(controls.cxxMsc) << "\")"<< EOL;
           cxx_group_specific_flags = true;
@@ -433,7 +433,7 @@ bool CMakeListsGenerator::GenBuildCMakeLists(void) {
 
   // Setup project
   vector<string> languages;
-  for (auto list : asFilesLists) {
+  for (const auto& list : asFilesLists) {
     if (!list.second.empty()) {
       languages.push_back(list.first);
     }
@@ -458,7 +458,7 @@ bool CMakeListsGenerator::GenBuildCMakeLists(void) {
 
   bool specific_defines = file_specific_defines || group_specific_defines;
   bool target_options = !m_optimize.empty() || !m_debug.empty() || !m_warnings.empty() || !m_languageC.empty() || !m_languageCpp.empty();
-  for (auto list : asFilesLists) {
+  for (const auto& list : asFilesLists) {
     if (!list.second.empty()) {
       string prefix = list.first;
       cmakelists << "set(CMAKE_" << prefix << "_FLAGS \"${" << prefix << "_CPU}";
@@ -530,7 +530,7 @@ bool CMakeListsGenerator::GenBuildCMakeLists(void) {
     cmakelists << "# Local Flags" << EOL << EOL;
 
     if (asflags || as_special_lang) {
-      for (auto list : asFilesLists) {
+      for (const auto& list : asFilesLists) {
         if (!list.second.empty()) {
           string lang = list.first;
           cmakelists << "foreach(SRC ${" << lang << "_SRC_FILES})" << EOL;
@@ -655,7 +655,7 @@ bool CMakeListsGenerator::GenBuildCMakeLists(void) {
   } else {
     cmakelists << "add_executable(${TARGET}";
   }
-  for (auto list : asFilesLists) {
+  for (const auto& list : asFilesLists) {
     if (!list.second.empty()) {
       string prefix = list.first;
       cmakelists << " ${" << prefix << "_SRC_FILES}";
@@ -6,6 +6,7 @@
 
 #include "AuxCmd.h"
 #include "CbuildGen.h"
+#include "CbuildGenState.h"
 #include "CMakeListsGenerator.h"
 #include "ProductInfo.h"
 
@@ -16,6 +17,7 @@
 #include "ErrLog.h"
 #include "ErrOutputterSaveToStdoutOrFile.h"
 
+#include <memory>
 #include <regex>
 
 using namespace std;
@@ -348,6 +350,26 @@ int CbuildGen::RunCbuildGen(int argc, char **argv, char** envp) {
     }
   }
 
+  // Skip model evaluation and generation if nothing changed since the last run
+  unique_ptr<CbuildGenState> state;
+  if (cmakeMode) {
+    vector<string> stateOptions = { "cprj=" + RteFsUtils::AbsolutePath(cprjFilePath).generic_string(),
+      "cwd=" + RteFsUtils::GetCurrentFolder(), "toolchain=" + toolchainPath, "update=" + updateCPRJ,
+      "intdir=" + intDirPath, "outdir=" + outDirPath, "pack-root=" + packRootPath,
+      "compiler-root=" + compilerRootPath, "update-rte=" + string(updateRteFiles ? "true" : "false") };
+    for (const auto& envVar : envVars) {
+      if (envVar.find("_TOOLCHAIN_") != string::npos) {
+        stateOptions.push_back("env=" + envVar);
+      }
+    }
+    state = make_unique<CbuildGenState>(cprjFilePath, intDirPath, stateOptions);
+    if (state->IsUpToDate()) {
+      LogMsg("M658", VAL("NAME", state->GetIntDir() + "CMakeLists" + TXTEXT));
+      return 0;
+    }
+    state->Invalidate();
+  }
+
   if ((cmakeMode || packMode) && (!CreateRte({ cprjFilePath, packRootPath, compilerRootPath, toolchainPath, updateCPRJ, intDirPath, envVars, packMode, updateRteFiles }))) {
     // CreateRte failed
     return 1;
@@ -368,10 +390,18 @@ int CbuildGen::RunCbuildGen(int argc, char **argv, char** envp) {
     if (!instance.Collect(cprjFilePath, model, outDirPath, intDirPath, compilerRootPath)) {
       return 1;
     }
-    if (instance.GenBuildCMakeLists()) {
+    const bool generated = instance.GenBuildCMakeLists();
+    if (generated) {
       LogMsg("M652", VAL("NAME", instance.m_genfile));
     }
-    instance.GenAuditFile();
+    if (instance.GenAuditFile() && generated) {
+      set<string> outputs = model->GetGeneratedFiles();
+      outputs.insert({ instance.m_genfile, instance.m_auditfile });
+      if (!updateCPRJ.empty()) {
+        outputs.insert(RteFsUtils::AbsolutePath(updateCPRJ).generic_string());
+      }
+      state->Save(model, outputs);
+    }
   }
   return 0;
 }
@@ -0,0 +1,145 @@
+/*
+ * Copyright (c) 2023 Arm Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "CbuildGenState.h"
+#include "ProductInfo.h"
+
+#include "CbuildUtils.h"
+#include "RteFsUtils.h"
+#include "RteUtils.h"
+#include "XMLTreeSlim.h"
+
+#include <fstream>
+#include <sstream>
+
+using namespace std;
+
+static constexpr const char* NOHASH = "-";
+
+CbuildGenState::CbuildGenState(const string& cprjFile, const string& intdir, const vector<string>& options) :
+  m_options(options)
+{
+  // resolve intermediate directory as BuildSystemGenerator::Collect() does
+  const string projectDir = RteFsUtils::AbsolutePath(cprjFile).remove_filename().generic_string();
+  m_intdir = CbuildUtils::StrPathConv(intdir);
+  if (!m_intdir.empty()) {
+    RteFsUtils::NormalizePath(m_intdir, RteFsUtils::GetCurrentFolder());
+  } else {
+    // cprj "intdir" field
+    XMLTreeSlim tree(nullptr, true);
+    if (tree.ParseFile(cprjFile)) {
+      const XMLTreeElement* cprj = tree.GetFirstChild("cprj");
+      const XMLTreeElement* target = cprj ? cprj->GetFirstChild("target") : nullptr;
+      m_intdir = target ? CbuildUtils::StrPathConv(target->GetChildAttribute("output", "intdir")) : RteUtils::EMPTY_STRING;
+    }
+    RteFsUtils::NormalizePath(m_intdir, projectDir + (m_intdir.empty() ? "IntDir" : RteUtils::EMPTY_STRING));
+  }
+  m_intdir += SS;
+  m_fileName = m_intdir + fs::path(cprjFile).stem().generic_string() + STATEEXT;
+}
+
+CbuildGenState::~CbuildGenState(void) {
+  // Reserved
+}
+
+bool CbuildGenState::IsUpToDate(void) const {
+  ifstream stateFile(m_fileName);
+  if (!stateFile) {
+    return false;
+  }
+
+  vector<string> options;
+  bool versionMatch = false;
+  bool hasOutputs = false;
+  string line;
+  while (getline(stateFile, line)) {
+    if (line.empty() || line[0] == '#') {
+      continue;
+    }
+    const size_t keyEnd = line.find(' ');
+    if (keyEnd == string::npos) {
+      return false;
+    }
+    const string key = line.substr(0, keyEnd);
+    const string value = line.substr(keyEnd + 1);
+    if (key == "version") {
+      versionMatch = (value == VERSION_STRING);
+      if (!versionMatch) {
+        return false;
+      }
+    } else if (key == "option") {
+      options.push_back(value);
+    } else if (key == "file" || key == "dir") {
+      // "<hash> <path>"
+      const size_t hashEnd = value.find(' ');
+      if (hashEnd == string::npos) {
+        return false;
+      }
+      const string path = value.substr(hashEnd + 1);
+      string hash = key == "file" ? RteFsUtils::GetFileHash(path) : GetDirHash(path);
+      if (value.compare(0, hashEnd, hash.empty() ? NOHASH : hash) != 0) {
+        return false;
+      }
+    } else if (key == "output") {
+      if (!RteFsUtils::Exists(value)) {
+        return false;
+      }
+      hasOutputs = true;
+    } else {
+      return false;
+    }
+  }
+  return versionMatch && hasOutputs && (options == m_options);
+}
+
+bool CbuildGenState::Save(const CbuildModel* model, const set<string>& outputs) const {
+  if (!model) {
+    return false;
+  }
+  set<string> files, dirs;
+  model->GetInputFiles(files, dirs);
+
+  stringstream state;
+  state << "# cbuildgen state, do not edit" << EOL;
+  state << "version " << VERSION_STRING << EOL;
+  for (const auto& option : m_options) {
+    state << "option " << option << EOL;
+  }
+  for (const auto& file : files) {
+    const string& hash = RteFsUtils::GetFileHash(file);
+    state << "file " << (hash.empty() ? NOHASH : hash) << WS << file << EOL;
+  }
+  for (const auto& dir : dirs) {
+    const string& hash = GetDirHash(dir);
+    state << "dir " << (hash.empty() ? NOHASH : hash) << WS << dir << EOL;
+  }
+  for (const auto& output : outputs) {
+    state << "output " << output << EOL;
+  }
+  return RteFsUtils::CopyBufferToFile(m_fileName, state.str(), false);
+}
+
+void CbuildGenState::Invalidate(void) const {
+  if (RteFsUtils::Exists(m_fileName)) {
+    RteFsUtils::RemoveFile(m_fileName);
+  }
+}
+
+string CbuildGenState::GetDirHash(const string& dir) {
+  if (!RteFsUtils::IsDirectory(dir)) {
+    return RteUtils::EMPTY_STRING;
+  }
+  set<string> entries;
+  error_code ec;
+  for (const auto& entry : fs::directory_iterator(dir, ec)) {
+    entries.insert(entry.path().filename().generic_string());
+  }
+  string listing;
+  for (const auto& entry : entries) {
+    listing += entry + EOL;
+  }
+  return RteUtils::GetHash(listing);
+}
@@ -140,6 +140,36 @@ TEST_F(BuildSystemGeneratorTests, StrNorm) {
   EXPECT_EQ(expected, path);
 }
 
+TEST_F(BuildSystemGeneratorTests, CompareFile) {
+  string file = testout_folder + "/CompareFile.txt";
+  stringstream buffer;
+  buffer << "# generated on 2023-01-02" << EOL << "set(A 1)" << EOL << EOL << "set(B 2)" << EOL;
+
+  // missing or empty file
+  RteFsUtils::RemoveFile(file);
+  EXPECT_FALSE(CompareFile(file, buffer));
+  RteFsUtils::CreateFile(file, "");
+  EXPECT_FALSE(CompareFile(file, buffer));
+
+  // comment lines are ignored, line endings are not significant
+  RteFsUtils::CreateFile(file, "# generated on 2023-01-01\nset(A 1)\n\nset(B 2)\n");
+  EXPECT_TRUE(CompareFile(file, buffer));
+  RteFsUtils::CreateFile(file, "# generated on 2023-01-01\r\nset(A 1)\r\n\r\nset(B 2)\r\n");
+  EXPECT_TRUE(CompareFile(file, buffer));
+
+  // differences
+  RteFsUtils::CreateFile(file, "# generated on 2023-01-01\nset(A 1)\n\nset(B 3)\n");
+  EXPECT_FALSE(CompareFile(file, buffer));
+  RteFsUtils::CreateFile(file, "# generated on 2023-01-01\nset(A 1)\n");
+  EXPECT_FALSE(CompareFile(file, buffer));
+  RteFsUtils::CreateFile(file, "set(A 0)\nset(A 1)\n\nset(B 2)\n");
+  EXPECT_FALSE(CompareFile(file, buffer));
+
+  // buffer is not consumed
+  EXPECT_EQ("# generated on 2023-01-02", string(istreambuf_iterator<char>(buffer), {}).substr(0, 25));
+  RteFsUtils::RemoveFile(file);
+}
+
 TEST_F(BuildSystemGeneratorTests, GenAuditFile) {
   error_code ec;
   string file = testout_folder + "/ValidTarget.clog";
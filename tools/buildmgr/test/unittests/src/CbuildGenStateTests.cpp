@@ -0,0 +1,127 @@
+/*
+ * Copyright (c) 2023 Arm Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "CBuildUnitTestEnv.h"
+#include "CbuildGenState.h"
+
+using namespace std;
+
+class CbuildGenStateTests : public CbuildModel, public ::testing::Test {
+protected:
+  void SetUp() override;
+  void TearDown() override;
+
+  string m_stateDir;
+  string m_output;
+};
+
+void CbuildGenStateTests::SetUp() {
+  m_stateDir = testout_folder + "/GenState";
+  RteFsUtils::CreateDirectories(m_stateDir + "/packs");
+  m_cprjFile = m_stateDir + "/Project.cprj";
+  m_compilerRoot = m_stateDir + "/etc";
+  m_toolchainConfig = m_compilerRoot + "/AC6.6.18.0.cmake";
+  m_rtePath = m_stateDir + "/packs/";
+  m_output = m_stateDir + "/IntDir/CMakeLists.txt";
+  RteFsUtils::CreateFile(m_cprjFile,
+    "<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n<cprj><target><output name=\"Project\" type=\"exe\"/></target></cprj>\n");
+  RteFsUtils::CreateFile(m_toolchainConfig, "set(AS armasm)\n");
+  RteFsUtils::CreateFile(m_output, "# CMSIS Build CMakeLists generated on ...\n");
+}
+
+void CbuildGenStateTests::TearDown() {
+  delete m_cprjProject;
+  m_cprjProject = nullptr;
+  RteFsUtils::RemoveDir(m_stateDir);
+}
+
+TEST_F(CbuildGenStateTests, GetIntDir) {
+  // default intermediate directory
+  CbuildGenState state(m_cprjFile, "", {});
+  EXPECT_EQ(m_stateDir + "/IntDir/", state.GetIntDir());
+  EXPECT_EQ(m_stateDir + "/IntDir/Project.cstate", state.GetFileName());
+
+  // cprj "intdir" field
+  RteFsUtils::CreateFile(m_cprjFile,
+    "<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n<cprj><target><output name=\"Project\" type=\"exe\" intdir=\"./Build\\Tmp/\"/></target></cprj>\n");
+  EXPECT_EQ(m_stateDir + "/Build/Tmp/", CbuildGenState(m_cprjFile, "", {}).GetIntDir());
+
+  // command line option overrides cprj field
+  EXPECT_EQ(testout_folder + "/Options/", CbuildGenState(m_cprjFile, testout_folder + "/Options", {}).GetIntDir());
+}
+
+TEST_F(CbuildGenStateTests, IsUpToDate) {
+  const vector<string> options = { "toolchain=AC6", "update-rte=true" };
+  CbuildGenState state(m_cprjFile, "", options);
+
+  // no state file
+  EXPECT_FALSE(state.IsUpToDate());
+
+  ASSERT_TRUE(state.Save(this, { m_output }));
+  EXPECT_TRUE(state.IsUpToDate());
+
+  // different options
+  EXPECT_FALSE(CbuildGenState(m_cprjFile, "", { "toolchain=GCC", "update-rte=true" }).IsUpToDate());
+
+  // modified input file
+  RteFsUtils::CreateFile(m_toolchainConfig, "set(AS armclang)\n");
+  EXPECT_FALSE(state.IsUpToDate());
+  ASSERT_TRUE(state.Save(this, { m_output }));
+  EXPECT_TRUE(state.IsUpToDate());
+
+  // input file created, local repository index was missing when state was saved
+  RteFsUtils::CreateFile(m_rtePath + ".Local/local_repository.pidx", "<index/>\n");
+  EXPECT_FALSE(state.IsUpToDate());
+  ASSERT_TRUE(state.Save(this, { m_output }));
+  EXPECT_TRUE(state.IsUpToDate());
+
+  // newer toolchain config file added to the compiler root
+  RteFsUtils::CreateFile(m_compilerRoot + "/AC6.6.19.0.cmake", "set(AS armclang)\n");
+  EXPECT_FALSE(state.IsUpToDate());
+  ASSERT_TRUE(state.Save(this, { m_output }));
+  EXPECT_TRUE(state.IsUpToDate());
+
+  // missing output file
+  RteFsUtils::RemoveFile(m_output);
+  EXPECT_FALSE(state.IsUpToDate());
+  RteFsUtils::CreateFile(m_output, "");
+  EXPECT_TRUE(state.IsUpToDate());
+
+  state.Invalidate();
+  EXPECT_FALSE(RteFsUtils::Exists(state.GetFileName()));
+  EXPECT_FALSE(state.IsUpToDate());
+}
+
+TEST_F(CbuildGenStateTests, IsUpToDate_GeneratedGpdsc) {
+  m_cprjProject = new RteCprjProject(nullptr);
+  const string gpdscFile = m_stateDir + "/RTE/Device/ARMCM3/Generated.gpdsc";
+  m_cprjProject->AddGpdscInfo(gpdscFile, nullptr);
+
+  // generator output does not exist yet
+  CbuildGenState state(m_cprjFile, "", {});
+  ASSERT_TRUE(state.Save(this, { m_output }));
+  EXPECT_TRUE(state.IsUpToDate());
+
+  // generator creates the gpdsc file
+  RteFsUtils::CreateFile(gpdscFile, "<package/>\n");
+  EXPECT_FALSE(state.IsUpToDate());
+  ASSERT_TRUE(state.Save(this, { m_output }));
+  EXPECT_TRUE(state.IsUpToDate());
+}
+
+TEST_F(CbuildGenStateTests, GetDirHash) {
+  const string packDir = m_rtePath + "ARM/CMSIS";
+  EXPECT_TRUE(CbuildGenState::GetDirHash(packDir).empty());
+
+  RteFsUtils::CreateDirectories(packDir + "/5.9.0");
+  const string hash = CbuildGenState::GetDirHash(packDir);
+  EXPECT_FALSE(hash.empty());
+  EXPECT_EQ(hash, CbuildGenState::GetDirHash(packDir));
+
+  // newly installed pack version
+  RteFsUtils::CreateDirectories(packDir + "/6.0.0");
+  EXPECT_NE(hash, CbuildGenState::GetDirHash(packDir));
+}
@@ -145,3 +145,37 @@ TEST_F(CbuildModelTests, EvalItemTranslationControls) {
   EvalItemTranslationControls(&groupItem, OPTIONS);
   EXPECT_EQ("speed", m_optimize["/engine"]);
 }
+
+TEST_F(CbuildModelTests, EvalItemTranslationControls_Nested_Groups) {
+  m_compiler = "AC6";
+  m_prjFolder = testinput_folder + "/";
+  m_targetCFlags = { "-O3" };
+
+  // Files/A/B/f1.c, Files/A/B/f2.c, Files/C/f3.c
+  RteItem filesItem(nullptr);
+  filesItem.SetTag("files");
+  RteItem* groupA = filesItem.CreateChild("group", "A");
+  RteItem* cflagsA = groupA->CreateChild("cflags");
+  cflagsA->SetAttribute("compiler", "AC6");
+  cflagsA->SetAttribute("add", "-DA");
+  RteItem* groupB = groupA->CreateChild("group", "B");
+  for (const string& name : { "f1.c", "f2.c" }) {
+    RteItem* cflags = groupB->CreateChild("file", name)->CreateChild("cflags");
+    cflags->SetAttribute("compiler", "AC6");
+    cflags->SetAttribute("add", ("-D" + name.substr(0, 2)).c_str());
+    cflags->SetAttribute("remove", "-O3");
+  }
+  RteItem* groupC = filesItem.CreateChild("group", "C");
+  RteItem* cflagsC = groupC->CreateChild("file", "f3.c")->CreateChild("cflags");
+  cflagsC->SetAttribute("compiler", "AC6");
+  cflagsC->SetAttribute("add", "-Df3");
+
+  EXPECT_TRUE(EvalItemTranslationControls(&filesItem, FLAGS));
+  EXPECT_EQ(vector<string>({ "-O3", "-DA" }), m_CFlags["Files/A"]);
+  EXPECT_EQ(0, m_CFlags.count("Files/A/B"));
+  EXPECT_EQ(0, m_CFlags.count("Files/C"));
+  EXPECT_EQ(vector<string>({ "-DA", "-Df1" }), m_CFlags[m_prjFolder + "f1.c"]);
+  EXPECT_EQ(vector<string>({ "-DA", "-Df2" }), m_CFlags[m_prjFolder + "f2.c"]);
+  EXPECT_EQ(vector<string>({ "-O3", "-Df3" }), m_CFlags[m_prjFolder + "f3.c"]);
+  EXPECT_EQ("Files/A/B", GetParentName(groupB->GetFirstChild("file")));
+}
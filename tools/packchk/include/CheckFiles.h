@@ -7,6 +7,7 @@
 #ifndef CHECKFILES_H
 #define CHECKFILES_H
 
+#include "PackFileSystem.h"
 #include "RteModel.h"
 
 struct FileEntry {
@@ -27,6 +28,8 @@ public:
 
   void SetPackageName(const std::string& packageName) { m_packageName = packageName; }
   const std::string& GetPackageName() const { return m_packageName; }
+  void SetFileSystem(const PackFileSystem* fileSystem) { m_fileSystem = fileSystem; }
+  const PackFileSystem& GetFileSystem() const;
   void SetPackagePath(const std::string& packagePath);
   const std::string& GetPackagePath() const;
   bool CheckFile(RteItem* item);
@@ -51,6 +54,7 @@ public:
 private:
   std::string m_packagePath;
   std::string m_packageName;
+  const PackFileSystem* m_fileSystem = nullptr;
 };
 
 class CheckFilesVisitor : public RteVisitor
@@ -10,6 +10,7 @@
 #include "Validate.h"
 #include "RteModelReader.h"
 #include "PackChk.h"
+#include "PackFileSystem.h"
 #include <list>
 #include <string>
 #include <set>
@@ -20,7 +21,7 @@
 class CreateModel
 {
 public:
-  CreateModel(RteGlobalModel& rteModel);
+  CreateModel(RteGlobalModel& rteModel, PackFileSystem& fileSystem);
   ~CreateModel();
 
   bool CheckForOtherPdscFiles(const std::string& pdscFullPath);
@@ -32,6 +33,7 @@ public:
 
 private:
   RteModelReader m_reader;
+  PackFileSystem& m_fileSystem;
   std::string m_schemaFile;
   bool m_validatePdsc = false;
 
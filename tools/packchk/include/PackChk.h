@@ -24,6 +24,15 @@ public:
 
   int Check(int argc, const char* argv[], const char* envp[]);
 
+  /**
+   * @brief check several packages in one model, each one with all others as reference.
+   *        Every PDSC file is read and validated against the schema once.
+   * @param pdscFiles PDSC files to check
+   * @param refFiles PDSC files used as reference only
+   * @return passed / failed
+  */
+  bool CheckPackages(const std::set<std::string>& pdscFiles, const std::set<std::string>& refFiles);
+
   const RteGlobalModel& GetModel() { return m_rteModel; }
 
 protected:
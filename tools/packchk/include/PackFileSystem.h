@@ -0,0 +1,47 @@
+/*
+ * Copyright (c) 2023 Arm Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef PACKFILESYSTEM_H
+#define PACKFILESYSTEM_H
+
+#include "ZipReader.h"
+
+#include <list>
+#include <map>
+#include <memory>
+#include <set>
+#include <string>
+
+/**
+ * @brief file access for packs: paths inside an added pack archive are looked up in
+ *        the archive ("<path>/Vendor.Name.x.y.z.pack/<entry>"), all other paths in the
+ *        file system. Lookups may be called concurrently once all archives are added.
+*/
+class PackFileSystem {
+public:
+  PackFileSystem();
+  ~PackFileSystem();
+
+  static bool IsPackArchive(const std::string& fileName);
+
+  bool AddArchive(const std::string& archiveFile);
+  bool IsArchived(const std::string& path) const;
+  bool Exists(const std::string& path) const;
+  bool IsDirectory(const std::string& path) const;
+  bool GetChildren(const std::string& path, std::set<std::string>& names) const;
+  bool ReadFile(const std::string& path, std::string& content);
+  void GetPackageDescriptionFiles(std::list<std::string>& files, const std::string& path) const;
+  std::string MakePathCanonical(const std::string& path) const;
+  const std::string& GetError() const { return m_error; }
+
+private:
+  ZipReader* FindArchive(const std::string& path, std::string& entryName) const;
+
+  std::map<std::string, std::unique_ptr<ZipReader>> m_archives;
+  std::string m_error;
+};
+
+#endif // PACKFILESYSTEM_H
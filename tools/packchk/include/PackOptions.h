@@ -7,6 +7,8 @@
 #ifndef PACKOPTIONS_H
 #define PACKOPTIONS_H
 
+#include "PackFileSystem.h"
+
 #include <cstdint>
 #include <string>
 #include <set>
@@ -56,7 +58,11 @@ public:
 
   bool IsSkipOnPdscTest(const std::string& filename);
 
+  PackFileSystem& GetFileSystem() { return m_fileSystem; }
+
 private:
+  bool OpenPackArchive(std::string& filename);
+
   bool m_bIgnoreOtherPdscFiles;
   bool m_bDisableValidation;
   PedanticLevel m_pedanticLevel;
@@ -67,6 +73,7 @@ private:
   std::string m_logPath;
   std::string m_xsdPath;   // PACK.xsd file path, use to validate the input PDSC file
   std::set<std::string> m_packsToRef;
+  PackFileSystem m_fileSystem;  // pack archives given as input or reference
 };
 
 #endif // PACKOPTIONS_H
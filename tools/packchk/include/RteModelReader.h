@@ -41,6 +41,7 @@ public:
   ~RteModelReader();
 
   bool AddFile(const std::string& fileName);
+  bool AddFile(const std::string& fileName, const std::string& xmlString);
   bool ReadAll();
 
 private:
@@ -76,6 +76,16 @@ const string& CheckFiles::GetPackagePath() const
   return m_packagePath;
 }
 
+/**
+ * @brief returns file access used for checks, the file system if none is set
+ * @return PackFileSystem
+*/
+const PackFileSystem& CheckFiles::GetFileSystem() const
+{
+  static const PackFileSystem noArchives;
+  return m_fileSystem ? *m_fileSystem : noArchives;
+}
+
 /**
  * @brief returns data for attribute "folder"
  * @param item RteItem
@@ -324,7 +334,7 @@ bool CheckFiles::CheckFileExists(const string& fileName, int lineNo, bool associ
   string checkPath = GetFullFilename(fileName);
 
   bool ok = true;
-  if(!RteFsUtils::Exists(checkPath)) {
+  if(!GetFileSystem().Exists(checkPath)) {
     if(associated) {
       LogMsg("M322", PATH(checkPath), lineNo);
     }
@@ -351,10 +361,9 @@ bool CheckFiles::CheckFileExists(const string& fileName, int lineNo, bool associ
 */
 bool CheckFiles::FindGetExactFileSystemName(const std::string& path, const std::string& fileNameIn, string& fileNameOut)
 {
-  error_code ec;
-  for (auto& item : fs::directory_iterator(path, ec)) {
-    const string fn = item.path().generic_string();
-    const string fsFn = RteUtils::ExtractFileName(fn);
+  set<string> names;
+  GetFileSystem().GetChildren(path, names);
+  for (const string& fsFn : names) {
     if(!AlnumCmp::CompareLen(fileNameIn, fsFn, false)) {
       fileNameOut = fsFn;
       return true;
@@ -378,12 +387,12 @@ bool CheckFiles::CheckFileIsInPack(const string& fileName, int lineNo)
   }
 
   string fullFileName = GetFullFilename(fileName);
-  string absPath = RteFsUtils::MakePathCanonical(fullFileName);
+  string absPath = GetFileSystem().MakePathCanonical(fullFileName);
   if(absPath.empty()) {
     return true;
   }
 
-  const auto& packPath = RteFsUtils::MakePathCanonical(GetPackagePath());
+  const auto& packPath = GetFileSystem().MakePathCanonical(GetPackagePath());
   if(absPath.find(packPath, 0) != 0) {
     LogMsg("M313", PATH(fileName), lineNo);
     return false;
@@ -753,7 +762,7 @@ bool CheckFiles::CheckFileExtension(RteItem* item)
   string checkPath = GetFullFilename(name);
 
   if(category == "include") {
-    if(!RteFsUtils::IsDirectory(checkPath)) {
+    if(!GetFileSystem().IsDirectory(checkPath)) {
       LogMsg("M339", PATH(name), lineNo);
       ok = false;
     }
@@ -763,7 +772,7 @@ bool CheckFiles::CheckFileExtension(RteItem* item)
     }
   }
   else {
-    if(RteFsUtils::IsDirectory(checkPath)) {
+    if(GetFileSystem().IsDirectory(checkPath)) {
       LogMsg("M356", PATH(name), lineNo);
       ok = false;
     }
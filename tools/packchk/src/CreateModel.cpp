@@ -18,9 +18,11 @@ using namespace std;
 /**
  * @brief class constructor
  * @param rteModel
+ * @param fileSystem file access to pack archives
 */
-CreateModel::CreateModel(RteGlobalModel& rteModel) :
-  m_reader(rteModel)
+CreateModel::CreateModel(RteGlobalModel& rteModel, PackFileSystem& fileSystem) :
+  m_reader(rteModel),
+  m_fileSystem(fileSystem)
 {
 }
 
@@ -47,7 +49,7 @@ bool CreateModel::CheckForOtherPdscFiles(const string& pdscFullPath)
 
   // Search for PDSC files
   string path = RteUtils::ExtractFilePath(pdscFullPath, 0);
-  RteFsUtils::GetPackageDescriptionFiles(pdscFiles, path, 1024);
+  m_fileSystem.GetPackageDescriptionFiles(pdscFiles, path);
 
   // Multiple PDSC file found in package?
   if(pdscFiles.size() > 1) {
@@ -100,11 +102,11 @@ bool CreateModel::AddPdsc(const string& pdscFile, bool bSkipCheckForOtherPdsc /*
 
   LogMsg("M051", PATH(pdscFile));
 
-  if(!RteFsUtils::Exists(pdscFile)) {
+  if(!m_fileSystem.Exists(pdscFile)) {
     LogMsg("M204", PATH(pdscFile));
     return false;
   }
-  if(RteFsUtils::IsDirectory(pdscFile)) {
+  if(m_fileSystem.IsDirectory(pdscFile)) {
     LogMsg("M202", PATH(pdscFile));
     return false;
   }
@@ -116,13 +118,22 @@ bool CreateModel::AddPdsc(const string& pdscFile, bool bSkipCheckForOtherPdsc /*
     }
   }
 
+  // PDSC files inside a pack archive are parsed from memory
+  string xmlString;
+  if(m_fileSystem.IsArchived(pdscFile)) {
+    if(!m_fileSystem.ReadFile(pdscFile, xmlString)) {
+      LogMsg("M208", PATH(pdscFile), MSG(m_fileSystem.GetError()));
+      return false;
+    }
+  }
+
   if(m_validatePdsc) {
-    if(!XmlChecker::Validate(pdscFile, m_schemaFile)) {
+    if(!XmlChecker::Validate(pdscFile, xmlString, m_schemaFile)) {
       ; // continue checking
     }
   }
 
-  if(!m_reader.AddFile(pdscFile)) {
+  if(!m_reader.AddFile(pdscFile, xmlString)) {
     LogMsg("M201", PATH(pdscFile));
     return false;
   }
@@ -15,6 +15,8 @@
 #include "ErrOutputterSaveToStdoutOrFile.h"
 #include "ParseOptions.h"
 
+#include <vector>
+
 using namespace std;
 
 /**
@@ -90,7 +92,7 @@ bool PackChk::CreatePacknameFile(const string& filename, RtePackage* pKg)
 bool PackChk::CheckPackage()
 {
   LogMsg("M061");
-  CreateModel createModel(m_rteModel);
+  CreateModel createModel(m_rteModel, m_packOptions.GetFileSystem());
 
   // Validate all PDSC files against Pack.xsd
   if(!m_packOptions.GetDisableValidation()) {
@@ -165,6 +167,90 @@ bool PackChk::CheckPackage()
   return bOk;
 }
 
+/**
+ * @brief check several packages in one model, each one with all others as reference
+ * @param pdscFiles PDSC files to check
+ * @param refFiles PDSC files used as reference only
+ * @return passed / failed
+*/
+bool PackChk::CheckPackages(const set<string>& pdscFiles, const set<string>& refFiles)
+{
+  // the result depends on the error count, do not count messages of earlier runs
+  ErrLog::Get()->ResetMsgCount();
+
+  const string header = m_packOptions.GetHeader();
+  LogMsg("M001", TXT(header));
+
+  if(!m_packOptions.SetXsdFile()) {
+    return false;
+  }
+
+  LogMsg("M061");
+  CreateModel createModel(m_rteModel, m_packOptions.GetFileSystem());
+  if(!createModel.SetPackXsd(m_packOptions.GetXsdPath())) {
+    return false;
+  }
+
+  set<string> pdscFullpaths, allFullpaths;
+  for(const auto& pdscFile : pdscFiles) {
+    const string fullpath = RteFsUtils::AbsolutePath(pdscFile).generic_string();
+    if(!createModel.AddPdsc(fullpath)) {
+      return false;
+    }
+    pdscFullpaths.insert(fullpath);
+  }
+  for(const auto& refFile : refFiles) {
+    allFullpaths.insert(RteFsUtils::AbsolutePath(refFile).generic_string());
+  }
+  createModel.AddRefPdsc(allFullpaths);
+  allFullpaths.insert(pdscFullpaths.begin(), pdscFullpaths.end());
+
+  bool bOk = true;
+
+  LogMsg("M015");
+  LogMsg("M023", VAL("CHECK", "1: Read PDSC files"));
+
+  // Read all PDSC files, each one only once
+  if(!createModel.ReadAllPdsc()) {
+    bOk = false;
+  }
+
+  // Test each package with all other packages as reference
+  vector<CPackOptions> tests(pdscFullpaths.size());
+  auto test = tests.begin();
+  for(const auto& fullpath : pdscFullpaths) {
+    for(const auto& ref : allFullpaths) {
+      if(ref != fullpath) {
+        test->AddRefPdscFile(ref);
+      }
+    }
+    test++;
+  }
+
+  // Checks fill lazy caches of the shared model (e.g. effective device properties)
+  // and create test projects in it, packages are checked one after the other
+  LogMsg("M015");
+  LogMsg("M023", VAL("CHECK", "2: Static Data & Dependencies check"));
+  for(auto& options : tests) {
+    ValidateSyntax validateSyntax(m_rteModel, options);
+    validateSyntax.Check();
+  }
+
+  LogMsg("M015");
+  LogMsg("M023", VAL("CHECK", "3: RTE Model based Data & Dependencies check"));
+  for(auto& options : tests) {
+    ValidateSemantic validateSemantic(m_rteModel, options);
+    if(!validateSemantic.Check()) {
+      bOk = false;
+    }
+  }
+
+  LogMsg("M016");
+  LogMsg("M022", ERR(ErrLog::Get()->GetErrCnt()), WARN(ErrLog::Get()->GetWarnCnt()));
+
+  return bOk && !ErrLog::Get()->GetErrCnt();
+}
+
 /**
  * @brief PackChk wrapper main entry point. Parses arguments and executes the tests
  * @param argc command line argument
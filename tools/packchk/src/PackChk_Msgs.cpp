@@ -91,10 +91,10 @@ const MsgTable PackChk::msgTable = {
   { "M207", { MsgLevel::LEVEL_ERROR,    CRLF_B, "PDSC file name mismatch!\n"\
                                                 "  Expected: '%PDSC1%.pdsc'\n"\
                                                 "  Actual  : '%PDSC2%.pdsc'" } },
-  { "M208", { MsgLevel::LEVEL_ERROR,    CRLF_BE, "" } },
+  { "M208", { MsgLevel::LEVEL_ERROR,    CRLF_B, "Cannot read pack archive '%PATH%': %MSG%" } },
   { "M209", { MsgLevel::LEVEL_TEXT,     CRLF_B, "" } },
   { "M210", { MsgLevel::LEVEL_ERROR,    CRLF_B, "Only one input file to be checked is allowed." } },
-  { "M211", { MsgLevel::LEVEL_ERROR,    CRLF_BE, "" } },
+  { "M211", { MsgLevel::LEVEL_ERROR,    CRLF_B, "No PDSC file found in pack archive '%PATH%'" } },
   { "M212", { MsgLevel::LEVEL_ERROR,    CRLF_BE, "" } },
   { "M213", { MsgLevel::LEVEL_WARNING,  CRLF_BE, "Found blank char '%NUM%' in Packname output filename, deleted" } },
   { "M214", { MsgLevel::LEVEL_ERROR,    CRLF_BE, "Invalid argument: %OPT%" } },
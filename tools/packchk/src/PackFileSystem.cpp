@@ -0,0 +1,220 @@
+/*
+ * Copyright (c) 2023 Arm Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#include "PackFileSystem.h"
+
+#include "CrossPlatform.h"
+#include "RteUtils.h"
+#include "RteFsUtils.h"
+
+using namespace std;
+
+/**
+ * @brief class constructor
+*/
+PackFileSystem::PackFileSystem()
+{
+}
+
+/**
+ * @brief class destructor
+*/
+PackFileSystem::~PackFileSystem()
+{
+}
+
+/**
+ * @brief check if a file is a pack archive by its extension
+ * @param fileName file name
+ * @return true if extension is ".pack" or ".zip"
+*/
+bool PackFileSystem::IsPackArchive(const string& fileName)
+{
+  const string ext = RteUtils::ExtractFileExtension(fileName, true);
+  return !_stricmp(ext.c_str(), ".pack") || !_stricmp(ext.c_str(), ".zip");
+}
+
+/**
+ * @brief open a pack archive, its entries are accessed as "<archiveFile>/<entry>"
+ * @param archiveFile path to pack archive
+ * @return passed / failed, see GetError()
+*/
+bool PackFileSystem::AddArchive(const string& archiveFile)
+{
+  const string archivePath = fs::path(RteFsUtils::AbsolutePath(archiveFile)).lexically_normal().generic_string();
+  if(m_archives.find(archivePath) != m_archives.end()) {
+    return true;
+  }
+
+  auto archive = make_unique<ZipReader>();
+  if(!archive->Open(archivePath)) {
+    m_error = archive->GetError();
+    return false;
+  }
+
+  m_archives[archivePath] = move(archive);
+
+  return true;
+}
+
+/**
+ * @brief find the archive containing a path
+ * @param path absolute path
+ * @param entryName returns path inside the archive, empty for the archive root
+ * @return archive, nullptr if path is not inside an archive
+*/
+ZipReader* PackFileSystem::FindArchive(const string& path, string& entryName) const
+{
+  if(m_archives.empty()) {
+    return nullptr;
+  }
+
+  const string normalPath = fs::path(RteUtils::BackSlashesToSlashes(path)).lexically_normal().generic_string();
+  for(const auto& [archivePath, archive] : m_archives) {
+    if(normalPath.compare(0, archivePath.size(), archivePath) != 0) {
+      continue;
+    }
+    if(normalPath.size() == archivePath.size()) {
+      entryName.clear();
+      return archive.get();
+    }
+    if(normalPath[archivePath.size()] == '/') {
+      entryName = normalPath.substr(archivePath.size() + 1);
+      return archive.get();
+    }
+  }
+
+  return nullptr;
+}
+
+/**
+ * @brief check if a path is inside an archive
+ * @param path absolute path
+ * @return true if path is inside an archive
+*/
+bool PackFileSystem::IsArchived(const string& path) const
+{
+  string entryName;
+  return FindArchive(path, entryName) != nullptr;
+}
+
+/**
+ * @brief check if a file or directory exists
+ * @param path absolute path
+ * @return true if file or directory exists
+*/
+bool PackFileSystem::Exists(const string& path) const
+{
+  string entryName;
+  const ZipReader* archive = FindArchive(path, entryName);
+  if(archive) {
+    return archive->Exists(entryName);
+  }
+
+  return RteFsUtils::Exists(path);
+}
+
+/**
+ * @brief check if a path is a directory, the root of an archive is a directory
+ * @param path absolute path
+ * @return true if path is a directory
+*/
+bool PackFileSystem::IsDirectory(const string& path) const
+{
+  string entryName;
+  const ZipReader* archive = FindArchive(path, entryName);
+  if(archive) {
+    return archive->IsDirectory(entryName);
+  }
+
+  return RteFsUtils::IsDirectory(path);
+}
+
+/**
+ * @brief get names of files and directories in a directory
+ * @param path absolute path of directory
+ * @param names set the names without path are inserted to
+ * @return true if directory exists
+*/
+bool PackFileSystem::GetChildren(const string& path, set<string>& names) const
+{
+  string entryName;
+  const ZipReader* archive = FindArchive(path, entryName);
+  if(archive) {
+    return archive->GetChildren(entryName, names);
+  }
+
+  error_code ec;
+  for(auto& item : fs::directory_iterator(path, ec)) {
+    names.insert(item.path().filename().generic_string());
+  }
+
+  return !ec;
+}
+
+/**
+ * @brief read content of a file
+ * @param path absolute path
+ * @param content returns file content
+ * @return passed / failed, see GetError()
+*/
+bool PackFileSystem::ReadFile(const string& path, string& content)
+{
+  string entryName;
+  ZipReader* archive = FindArchive(path, entryName);
+  if(archive) {
+    if(!archive->ReadEntry(entryName, content)) {
+      m_error = archive->GetError();
+      return false;
+    }
+    return true;
+  }
+
+  if(!RteFsUtils::ReadFile(path, content)) {
+    m_error = "cannot read file: " + path;
+    return false;
+  }
+
+  return true;
+}
+
+/**
+ * @brief search PDSC files in a directory and all its subdirectories
+ * @param files list the found files are appended to
+ * @param path absolute path of directory
+*/
+void PackFileSystem::GetPackageDescriptionFiles(list<string>& files, const string& path) const
+{
+  string entryName;
+  const ZipReader* archive = FindArchive(path, entryName);
+  if(!archive) {
+    RteFsUtils::GetPackageDescriptionFiles(files, path, 1024);
+    return;
+  }
+
+  const string archivePath = archive->GetArchiveFile();
+  const string prefix = entryName.empty() || entryName.back() == '/' ? entryName : entryName + "/";
+  list<string> names;
+  archive->GetFileNames(names);
+  for(const auto& name : names) {
+    if(name.compare(0, prefix.size(), prefix) == 0 && RteUtils::ExtractFileExtension(name, true) == ".pdsc") {
+      files.push_back(archivePath + "/" + name);
+    }
+  }
+}
+
+/**
+ * @brief make path canonical, paths inside an archive are normalized lexically
+ * @param path absolute path
+ * @return canonical path
+*/
+string PackFileSystem::MakePathCanonical(const string& path) const
+{
+  if(IsArchived(path)) {
+    return fs::path(RteUtils::BackSlashesToSlashes(path)).lexically_normal().generic_string();
+  }
+
+  return RteFsUtils::MakePathCanonical(path);
+}
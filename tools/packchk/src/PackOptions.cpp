@@ -177,13 +177,19 @@ bool CPackOptions::SetFileUnderTest(const string& filename)
 
   m_packToCheck = RteFsUtils::AbsolutePath(filename).generic_string();
 
-  if(!RteFsUtils::Exists(m_packToCheck)) {
+  if(!m_fileSystem.Exists(m_packToCheck)) {
     LogMsg("M204", PATH(m_packToCheck));
     m_packToCheck.clear();
 
     return false;
   }
 
+  if(!OpenPackArchive(m_packToCheck)) {
+    m_packToCheck.clear();
+
+    return false;
+  }
+
   return true;
 }
 
@@ -199,11 +205,60 @@ bool CPackOptions::AddRefPackFile(const std::string& includeFile)
   }
 
   string fullpath = RteFsUtils::AbsolutePath(includeFile).generic_string();
+  if(!OpenPackArchive(fullpath)) {
+    return false;
+  }
+
   AddRefPdscFile(fullpath);
 
   return true;
 }
 
+/**
+ * @brief opens a pack archive (*.pack, *.zip), its contents are read directly from the archive
+ * @param filename string path to archive, replaced by path of the PDSC file inside the archive
+ * @return passed / failed, true if filename is not a pack archive
+ */
+bool CPackOptions::OpenPackArchive(string& filename)
+{
+  if(!PackFileSystem::IsPackArchive(filename) || !RteFsUtils::IsRegularFile(filename)) {
+    return true;
+  }
+
+  if(!m_fileSystem.AddArchive(filename)) {
+    LogMsg("M208", PATH(filename), MSG(m_fileSystem.GetError()));
+    return false;
+  }
+
+  set<string> names;
+  m_fileSystem.GetChildren(filename, names);
+
+  string pdscFiles;
+  string pdscFile;
+  int pdscCount = 0;
+  for(const string& name : names) {
+    if(RteUtils::ExtractFileExtension(name, true) == ".pdsc") {
+      pdscFile = filename + "/" + name;
+      pdscFiles += "\n  " + pdscFile;
+      pdscCount++;
+    }
+  }
+
+  if(!pdscCount) {
+    LogMsg("M211", PATH(filename));
+    return false;
+  }
+
+  if(pdscCount > 1) {
+    LogMsg("M206", VAL("FILES", pdscFiles));
+    return false;
+  }
+
+  filename = pdscFile;
+
+  return true;
+}
+
 /**
  * @brief set log file
  * @param logFile string filename
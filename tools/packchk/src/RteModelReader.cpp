@@ -112,6 +112,21 @@ bool RteModelReader::AddFile(const string& fileName)
   return m_xmlTree.AddFileName(fileName);
 }
 
+/**
+ * @brief add a file read from a pack archive, parsed from its content
+ * @param fileName name the file is reported with
+ * @param xmlString file content
+ * @return passed / failed
+*/
+bool RteModelReader::AddFile(const string& fileName, const string& xmlString)
+{
+  if(xmlString.empty()) {
+    return AddFile(fileName);
+  }
+
+  return m_xmlTree.AddXmlString(fileName, xmlString);
+}
+
 /**
  * @brief read all xml files, construct & validate model
  * @return passed / failed
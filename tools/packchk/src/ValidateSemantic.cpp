@@ -382,7 +382,7 @@ bool ValidateSemantic::UpdateRte(RteTarget* target, RteProject* rteProject, RteC
  */
 bool ValidateSemantic::CheckDependencyResult(RteTarget* target, RteComponent* component, string mcuVendor, string mcuDispName, compiler_s compiler)
 {
-  string compId = component->GetComponentID(true);
+  const string& compId = component->GetCachedComponentID(true);
 
   RteDependencyResult dependencyResult;
   RteItem::ConditionResult res = target->GetDepsResult(dependencyResult.Results(), target);
@@ -533,7 +533,7 @@ bool ValidateSemantic::CheckDeviceDependencies(RteDeviceItem *device, RteProject
             int lineSystem = 0, lineStartup = 0;
 
             for(auto& [key, component] : componentMap) {
-              string compId = component->GetComponentID(true);
+              const string& compId = component->GetCachedComponentID(true);
               LogMsg("M091", COMP("Startup"), VAL("COMPID", compId), VENDOR(mcuVendor), MCU(mcuDispName), COMPILER(compiler.tcompiler), OPTION(compiler.toptions), lineNo);
 
               UpdateRte(target, rteProject, component);
@@ -606,7 +606,7 @@ bool ValidateSemantic::CheckDeviceDependencies(RteDeviceItem *device, RteProject
                           }
                         }
 
-                        if(RteFsUtils::Exists(systemHeader)) {
+                        if(GetOptions().GetFileSystem().Exists(systemHeader)) {
                           bFoundSystemH = true;
                         }
                       }
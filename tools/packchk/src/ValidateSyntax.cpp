@@ -145,6 +145,7 @@ bool ValidateSyntax::CheckAllFiles(RtePackage* pKg)
   }
 
   CheckFilesVisitor fileVisitor(workDir, pKg->GetName());
+  fileVisitor.GetCheckFiles().SetFileSystem(&GetOptions().GetFileSystem());
 
   CheckLicense(pKg, fileVisitor);
   pKg->AcceptVisitor(&fileVisitor);
@@ -7,6 +7,7 @@
 
 #include "PackChk.h"
 #include "ErrLog.h"
+#include "ZipWriter.h"
 
 #include <fstream>
 
@@ -859,8 +860,61 @@ TEST_F(PackChkIntegTests, CheckConditionComponentDependency_Pos) {
   }
 }
 
+// Validate several software packs in one run
+TEST_F(PackChkIntegTests, CheckPackages) {
+  const string& pdscFile = PackChkIntegTestEnv::globaltestdata_dir +
+    "/packs/ARM/RteTest/0.1.0/ARM.RteTest.pdsc";
+  const string& invalidPdscFile = PackChkIntegTestEnv::localtestdata_dir +
+    "/InvalidPack/TestVendor.TestInvalidPack.pdsc";
+  ASSERT_TRUE(RteFsUtils::Exists(pdscFile));
+  ASSERT_TRUE(RteFsUtils::Exists(invalidPdscFile));
+
+  PackChk packChk;
+  EXPECT_TRUE(packChk.CheckPackages({ pdscFile }, {}));
+
+  PackChk packChkInvalid;
+  EXPECT_FALSE(packChkInvalid.CheckPackages({ pdscFile, invalidPdscFile }, {}));
+
+  // messages of the invalid pack are reported with its file name
+  bool found = false;
+  for(const string& msg : ErrLog::Get()->GetLogMessages()) {
+    if(msg.find("TestVendor.TestInvalidPack.pdsc") != string::npos) {
+      found = true;
+    }
+  }
+  EXPECT_TRUE(found);
+}
+
+// Validate a software pack read directly from its pack archive
+TEST_F(PackChkIntegTests, CheckPackArchive) {
+  const string& packDir = PackChkIntegTestEnv::globaltestdata_dir +
+    "/packs/ARM/RteTest/0.1.0";
+  const string& packFile = PackChkIntegTestEnv::testoutput_dir +
+    "/ARM.RteTest.0.1.0.pack";
+  ASSERT_TRUE(RteFsUtils::Exists(packDir));
+
+  ZipWriter zipWriter;
+  for(auto& item : fs::recursive_directory_iterator(packDir)) {
+    if(item.is_regular_file()) {
+      zipWriter.AddFile(item.path().lexically_relative(packDir).generic_string(), item.path().generic_string());
+    }
+  }
+  ASSERT_TRUE(zipWriter.Write(packFile));
 
+  const char* argv[2];
 
+  argv[0] = (char*)"";
+  argv[1] = (char*)packFile.c_str();
 
+  PackChk packChk;
+  EXPECT_EQ(0, packChk.Check(2, argv, nullptr));
 
+  // invalid archive
+  const string& invalidPackFile = PackChkIntegTestEnv::testoutput_dir +
+    "/ARM.Invalid.0.1.0.pack";
+  ASSERT_TRUE(RteFsUtils::CreateFile(invalidPackFile, "no archive"));
+  argv[1] = (char*)invalidPackFile.c_str();
 
+  PackChk packChkInvalid;
+  EXPECT_EQ(1, packChkInvalid.Check(2, argv, nullptr));
+}
@@ -8,13 +8,22 @@
 #include "ProductInfo.h"
 
 #include "RteFsUtils.h"
+#include "RteUtils.h"
 #include "XmlFormatter.h"
 #include "CrossPlatform.h"
+#include "PackChk.h"
+#include "ZipWriter.h"
 
 #include <cxxopts.hpp>
+#include <nlohmann/json.hpp>
+#include <algorithm>
+#include <exception>
 #include <iostream>
 #include <fstream>
 #include <functional>
+#include <mutex>
+#include <sstream>
+#include <unordered_map>
 
 using namespace std;
 
@@ -562,12 +571,143 @@ bool PackGen::CreateComponents(void) {
   return true;
 }
 
+/**
+ * @brief canonical paths of sources and include directories listed in CMake File API replies,
+ *        directories are resolved once and shared by all threads parsing replies
+*/
+class CanonicalPathCache {
+public:
+  CanonicalPathCache(const string& baseDir) : m_baseDir(baseDir) {}
+
+  // canonical path of an existing directory, empty if not found
+  string GetDirectory(const string& dir) {
+    const string& absDir = fs::path(dir).is_absolute() ? dir : m_baseDir + "/" + dir;
+    {
+      lock_guard<mutex> lock(m_mutex);
+      const auto it = m_directories.find(absDir);
+      if (it != m_directories.end()) {
+        return it->second;
+      }
+    }
+    error_code ec;
+    const string& canonical = fs::canonical(absDir, ec).generic_string();
+    lock_guard<mutex> lock(m_mutex);
+    m_directories[absDir] = canonical;
+    return canonical;
+  }
+
+  // canonical path of an existing file, empty if not found
+  string GetFile(const string& file, bool& isRegularFile) {
+    const fs::path path = fs::path(file).is_absolute() ? fs::path(file) : fs::path(m_baseDir) / file;
+    const string& filename = path.filename().generic_string();
+    error_code ec;
+    const auto status = fs::symlink_status(path, ec);
+    if (filename.empty() || filename == "." || filename == ".." || fs::is_symlink(status)) {
+      // the file itself must be resolved
+      const fs::path canonical = fs::canonical(path, ec);
+      isRegularFile = fs::is_regular_file(canonical, ec);
+      return canonical.generic_string();
+    }
+    if (!fs::exists(status)) {
+      return string();
+    }
+    const string& dir = GetDirectory(path.parent_path().generic_string());
+    if (dir.empty()) {
+      return string();
+    }
+    isRegularFile = fs::is_regular_file(status);
+    return dir + "/" + filename;
+  }
+
+private:
+  string m_baseDir;
+  mutex m_mutex;
+  unordered_map<string, string> m_directories;
+};
+
+/**
+ * @brief CMake File API target reply file and the target information parsed from it,
+ *        a reply failing to parse keeps the information read before the failure
+*/
+struct TargetReply {
+  string buildName;
+  string file;
+  string name;
+  targetInfo target;
+  string warnings;
+  exception_ptr exception;
+};
+
+static string RemoveRepoRoot(const string& path, const string& repoRoot) {
+  if (path.find(repoRoot) == 0) {
+    return path.substr(repoRoot.length() + 1);
+  }
+  return path;
+}
+
+static void ParseTargetReply(TargetReply& reply, const string& repoRoot, CanonicalPathCache& canonicalPaths) {
+  ostringstream warnings;
+  try {
+    ifstream replyFile(reply.file);
+    const nlohmann::json target = nlohmann::json::parse(replyFile);
+    const string& name = target.at("name").get<string>();
+    const nlohmann::json empty = nlohmann::json::array();
+    reply.name = name;
+
+    for (const auto& item : target.value("sources", empty)) {
+      const string& src = item.at("path").get<string>();
+      bool isRegularFile = false;
+      const string& canonical = canonicalPaths.GetFile(src, isRegularFile);
+      if (canonical.empty()) {
+        warnings << "packgen warning: file '" << src << "' listed by target '" << name << "' was not found" << endl;
+        continue;
+      }
+      if (!isRegularFile) {
+        warnings << "packgen warning: source '" << src << "' listed by target '" << name << "' is not a regular file" << endl;
+        continue;
+      }
+      reply.target.build.src.insert(RemoveRepoRoot(canonical, repoRoot));
+    }
+
+    const nlohmann::json& compileGroups = target.value("compileGroups", empty);
+    if (!compileGroups.empty()) {
+      for (const auto& item : compileGroups[0].value("includes", empty)) {
+        const string& inc = item.at("path").get<string>();
+        const string& canonical = canonicalPaths.GetDirectory(inc);
+        if (canonical.empty()) {
+          warnings << "packgen warning: directory '" << inc << "' listed by target '" << name << "' was not found" << endl;
+          continue;
+        }
+        reply.target.build.inc.insert(RemoveRepoRoot(canonical, repoRoot));
+      }
+
+      for (const auto& item : compileGroups[0].value("defines", empty)) {
+        reply.target.build.def.insert(item.at("define").get<string>());
+      }
+    }
+
+    for (const auto& item : target.value("dependencies", empty)) {
+      const string& dep = item.at("id").get<string>();
+      reply.target.dependency.insert(dep.substr(0, dep.find("::")));
+    }
+  }
+  catch (nlohmann::json::exception& e) {
+    warnings << "packgen warning: parsing file '" << reply.file << "' throws an exception" << endl << e.what() << endl;
+  }
+  catch (...) {
+    // rethrown when the results are collected
+    reply.exception = current_exception();
+  }
+  reply.warnings = warnings.str();
+}
+
 bool PackGen::ParseReply(void) {
   error_code ec;
   const auto& workingDir = fs::current_path(ec);
   fs::current_path(m_repoRoot, ec);
 
-  // Iterate over build options
+  // Collect target reply files of all build options
+  vector<TargetReply> replies;
   for (const auto& build : m_buildOptions) {
 
     const string& buildRoot = m_outputRoot + "/" + build.name;
@@ -578,68 +718,39 @@ bool PackGen::ParseReply(void) {
       return false;
     }
 
+    vector<string> files;
     for (const auto& p : fs::recursive_directory_iterator(replyDir, ec)) {
       const string& file = p.path().stem().generic_string();
       if (file.compare(0, 6, "target") == 0) {
-        // Parse generated target file information
-        try {
-          YAML::Node target = YAML::LoadFile(p.path().generic_string());
-
-          const string& name = target["name"].as<string>();
-
-          YAML::Node sources = target["sources"];
-          for (const auto& item : sources) {
-            string src = item["path"].as<string>();
-            fs::path canonical = fs::canonical(src, ec);
-            if (canonical.empty()) {
-              cerr << "packgen warning: file '" << src << "' listed by target '" << name << "' was not found" << endl;
-              continue;
-            }
-            if (!fs::is_regular_file(canonical)) {
-              cerr << "packgen warning: source '" << src << "' listed by target '" << name << "' is not a regular file" << endl;
-              continue;
-            }
-            src = canonical.generic_string();
-            if (src.find(m_repoRoot) == 0) {
-              src.erase(0, m_repoRoot.length() + 1);
-            }
-            m_target[name][build.name].build.src.insert(src);
-          }
-
-          YAML::Node includes = target["compileGroups"][0]["includes"];
-          for (const auto& item : includes) {
-            string inc = item["path"].as<string>();
-            fs::path canonical = fs::canonical(inc, ec);
-            if (canonical.empty()) {
-              cerr << "packgen warning: directory '" << inc << "' listed by target '" << name << "' was not found" << endl;
-              continue;
-            }
-            inc = canonical.generic_string();
-            if (inc.find(m_repoRoot) == 0) {
-              inc.erase(0, m_repoRoot.length() + 1);
-            }
-            m_target[name][build.name].build.inc.insert(inc);
-          }
-
-          YAML::Node defines = target["compileGroups"][0]["defines"];
-          for (const auto& item : defines) {
-            const string& def = item["define"].as<string>();
-            m_target[name][build.name].build.def.insert(def);
-          }
-
-          YAML::Node dependencies = target["dependencies"];
-          for (const auto& item : dependencies) {
-            string dep = item["id"].as<string>();
-            dep = dep.substr(0, dep.find("::"));
-            m_target[name][build.name].dependency.insert(dep);
-          }
-
-        }
-        catch (YAML::Exception& e) {
-          cerr << "packgen warning: parsing file '" << p.path().generic_string() << "' throws an exception" << endl << e.what() << endl;
-        }
+        files.push_back(p.path().generic_string());
       }
     }
+    sort(files.begin(), files.end());
+    for (const auto& file : files) {
+      replies.push_back({ build.name, file });
+    }
+  }
+
+  // Parse reply files concurrently, sources in the same directory are canonicalized once
+  CanonicalPathCache canonicalPaths(m_repoRoot);
+  RteUtils::RunConcurrently(replies.size(), [&](size_t i) {
+    ParseTargetReply(replies[i], m_repoRoot, canonicalPaths);
+  });
+
+  // Collect results in reply file order, including the information parsed from failing replies
+  for (auto& reply : replies) {
+    cerr << reply.warnings;
+    if (!reply.name.empty()) {
+      targetInfo& target = m_target[reply.name][reply.buildName];
+      target.build.src.insert(reply.target.build.src.begin(), reply.target.build.src.end());
+      target.build.inc.insert(reply.target.build.inc.begin(), reply.target.build.inc.end());
+      target.build.def.insert(reply.target.build.def.begin(), reply.target.build.def.end());
+      target.dependency.insert(reply.target.dependency.begin(), reply.target.dependency.end());
+    }
+    if (reply.exception) {
+      fs::current_path(workingDir, ec);
+      rethrow_exception(reply.exception);
+    }
   }
 
   // Verbose mode: print cmake targets build info
@@ -681,8 +792,11 @@ bool PackGen::CreatePack() {
 
     // Copy license
     error_code ec;
+    list<string> licenseExt;
     fs::create_directories(pack.outputDir, ec);
-    fs::copy_file(m_repoRoot + "/" + pack.license, pack.outputDir + "/" + pack.license, fs::copy_options::overwrite_existing, ec);
+    if (fs::is_regular_file(m_repoRoot + "/" + pack.license, ec)) {
+      CopyItem(pack, m_repoRoot + "/" + pack.license, pack.license, licenseExt);
+    }
 
     // Root
     m_pdscTree = new XMLTreeSlim();
@@ -717,20 +831,17 @@ bool PackGen::CreatePack() {
       CreatePackComponentsAndConditions(rootElement, pack);
     }
 
-    // Format Xml content
-    XmlFormatter xmlFormatter(m_pdscTree, SCHEMA_FILE, SCHEMA_VERSION);
-    const string& xmlContent = xmlFormatter.GetContent();
-
-    // Save file
+    // Save file, Xml content is formatted directly into the file stream
     const string& file = pack.outputDir + "/" + pack.vendor + "." + pack.name + ".pdsc";
     ofstream xmlFile(file);
     if (!xmlFile) {
       return false;
     }
 
-    xmlFile << xmlContent;
+    XmlFormatter().Format(xmlFile, m_pdscTree, SCHEMA_FILE, SCHEMA_VERSION);
     xmlFile << std::endl;
     xmlFile.close();
+    pack.files[fs::path(file).filename().generic_string()] = file;
   }
 
   return true;
@@ -813,8 +924,7 @@ void PackGen::CreatePackApis(XMLTreeElement* rootElement, packInfo& pack) {
         for (const auto& attribute : file.attributes) {
           SetAttribute(fileElement, attribute.first, attribute.second);
         }
-        const string dst = pack.outputDir + "/" + file.name;
-        CopyItem(m_repoRoot + "/" + file.name, dst, m_extensions[apiName]);
+        CopyItem(pack, m_repoRoot + "/" + file.name, file.name, m_extensions[apiName]);
       }
     }
   }
@@ -884,35 +994,31 @@ void PackGen::CreatePackComponentsAndConditions(XMLTreeElement* rootElement, pac
       for (const auto& src : componentInfo.build.src) {
         XMLTreeElement* fileElement = filesElement->CreateElement("file");
         fileElement->AddAttribute("category", GetFileCategory(src, m_extensions[componentName]));
-        string name, origin, destination;
+        string name, origin;
         if (fs::path(src).is_absolute()) {
           name = fs::path(src).relative_path().generic_string();
           origin = src;
-          destination = pack.outputDir + "/" + name;
         } else {
           name = src;
           origin = m_repoRoot + "/" + src;
-          destination = pack.outputDir + "/" + src;
         }
         fileElement->AddAttribute("name", name);
-        CopyItem(origin, destination, m_extensions[componentName]);
+        CopyItem(pack, origin, name, m_extensions[componentName]);
       }
       // Include paths from CMake targets
       for (const auto& inc : componentInfo.build.inc) {
         XMLTreeElement* fileElement = filesElement->CreateElement("file");
         fileElement->AddAttribute("category", "include");
-        string name, origin, destination;
+        string name, origin;
         if (fs::path(inc).is_absolute()) {
           name = fs::path(inc).relative_path().generic_string() + "/";
           origin = inc;
-          destination = pack.outputDir + "/" + name;
         } else {
           name = inc + "/";
           origin = m_repoRoot + "/" + inc;
-          destination = pack.outputDir + "/" + inc;
         }
         fileElement->AddAttribute("name", name);
-        CopyItem(origin, destination, m_extensions[componentName]);
+        CopyItem(pack, origin, name, m_extensions[componentName]);
       }
       // Other files described in manifest
       for (const auto& file : componentInfo.files) {
@@ -921,8 +1027,7 @@ void PackGen::CreatePackComponentsAndConditions(XMLTreeElement* rootElement, pac
         for (const auto& attribute : file.attributes) {
           SetAttribute(fileElement, attribute.first, attribute.second);
         }
-        const string dst = pack.outputDir + "/" + file.name;
-        CopyItem(m_repoRoot + "/" + file.name, dst, m_extensions[componentName]);
+        CopyItem(pack, m_repoRoot + "/" + file.name, file.name, m_extensions[componentName]);
 
         // Add file conditions described in manifest
         if (!file.conditions.empty()) {
@@ -958,69 +1063,48 @@ void PackGen::CreatePackComponentsAndConditions(XMLTreeElement* rootElement, pac
 }
 
 bool PackGen::CheckPack(void) {
-  PackGen::Result result;
   error_code ec;
   const auto& workingDir = fs::current_path(ec);
 
-  // Iterate over packs
+  // PDSC files generated in this run, each one is checked with all others as reference
+  set<string> pdscFiles;
   for (const auto& pack : m_pack) {
+    pdscFiles.insert(pack.outputDir + "/" + pack.vendor + "." + pack.name + ".pdsc");
+  }
 
-    // Change working dir
-    fs::current_path(pack.outputDir, ec);
-
-    // PDSC references generated in this run
-    string pdscList;
-    for (const auto& ref : m_pack) {
-      if ((pack.name != ref.name) || (pack.vendor != ref.vendor)) {
-        pdscList += " -i \"" + ref.outputDir + "/" + ref.vendor + "." + ref.name + ".pdsc\"";
-      }
-    }
-
-    // External PDSC references
-    for (auto& externalPdsc : m_externalPdsc) {
-      RteFsUtils::NormalizePath(externalPdsc, workingDir.generic_string() + "/");
-      if (RteFsUtils::Exists(externalPdsc)) {
-        pdscList += " -i \"" + externalPdsc + "\"";
-      }
-    }
-
-    // packchk
-    result = ExecCommand("packchk \"" + pack.vendor + "." + pack.name + ".pdsc\"" + pdscList);
-    if (result.second) {
-      cerr << "packgen error: packchk failed" << endl << result.first << endl;
-      return false;
-    } else {
-      // packchk report
-      cout << result.first << endl;
+  // External PDSC references
+  set<string> refFiles;
+  for (auto& externalPdsc : m_externalPdsc) {
+    RteFsUtils::NormalizePath(externalPdsc, workingDir.generic_string() + "/");
+    if (RteFsUtils::Exists(externalPdsc)) {
+      refFiles.insert(externalPdsc);
     }
   }
 
-  // Restore working dir
-  fs::current_path(workingDir, ec);
+  // packchk
+  PackChk packChk;
+  if (!packChk.CheckPackages(pdscFiles, refFiles)) {
+    cerr << "packgen error: packchk failed" << endl;
+    return false;
+  }
   return true;
 }
 
 bool PackGen::CompressPack(void) {
-  PackGen::Result result;
-  error_code ec;
-  const auto& workingDir = fs::current_path(ec);
-
   // Iterate over packs
   for (const auto& pack : m_pack) {
 
-    // Change working dir
-    fs::current_path(pack.outputDir, ec);
-
-    // 7zip
-    result = ExecCommand("7z a \"" + pack.vendor + "." + pack.name + "." + pack.version + ".pack\" -tzip");
-    if (result.second) {
-      cerr << "packgen error: 7zip failed\n" << result.first << endl;
+    // Archive files from their source location
+    ZipWriter zip;
+    for (const auto& [name, src] : pack.files) {
+      zip.AddFile(name, src);
+    }
+    const string& packFile = pack.outputDir + "/" + pack.vendor + "." + pack.name + "." + pack.version + ".pack";
+    if (!zip.Write(packFile)) {
+      cerr << "packgen error: pack file creation failed\n" << zip.GetError() << endl;
       return false;
     }
   }
-
-  // Restore working dir
-  fs::current_path(workingDir, ec);
   return true;
 }
 
@@ -1096,23 +1180,28 @@ const PackGen::Result PackGen::ExecCommand(const string& cmd) {
   return make_pair(result, ret_code);
 }
 
-bool PackGen::CopyItem(const string& src, const string& dst, list<string>& ext) {
-  //Copy file or directory recursively filtering extensions
+bool PackGen::CopyItem(packInfo& pack, const string& src, const string& name, list<string>& ext) {
+  //Copy file or directory recursively filtering extensions, copied files are recorded for the pack archive
   error_code ec;
   fs::path srcPath = fs::path(src);
-  fs::path dstPath = fs::path(dst);
+  const string& dstName = fs::path(name).lexically_normal().generic_string();
+  auto copyFile = [&pack, &ec](const fs::path& from, const string& to) {
+    const fs::path dstPath = fs::path(pack.outputDir + "/" + to);
+    fs::create_directories(dstPath.parent_path(), ec);
+    if (fs::copy_file(from, dstPath, fs::copy_options::overwrite_existing, ec)) {
+      pack.files[to] = from.generic_string();
+    }
+  };
   if (fs::is_regular_file(srcPath)) {
     // Copy file
-    fs::create_directories(dstPath.parent_path(), ec);
-    fs::copy_file(srcPath, dstPath, fs::copy_options::overwrite_existing, ec);
+    copyFile(srcPath, dstName);
   } else {
     // Copy directory recursively filtering extensions
     for (const auto& p : fs::recursive_directory_iterator(srcPath, ec)) {
       ext = ext.empty() ? HEADER_EXT_DEFAULT : ext;
       if (find(ext.begin(), ext.end(), p.path().extension()) != ext.end()) {
-        string filename = dstPath.generic_string() + p.path().generic_string().substr(srcPath.generic_string().length(), string::npos);
-        fs::create_directories(fs::path(filename).parent_path(), ec);
-        fs::copy_file(p.path(), fs::path(filename), fs::copy_options::overwrite_existing, ec);
+        const string& relative = p.path().generic_string().substr(srcPath.generic_string().length(), string::npos);
+        copyFile(p.path(), fs::path(dstName + "/" + relative).lexically_normal().generic_string());
       }
     }
   }
@@ -5,7 +5,9 @@
  */
 
 #include "PackGenTestEnv.h"
+#include "CrossPlatformUtils.h"
 #include "RteFsUtils.h"
+#include "RteUtils.h"
 
 using namespace std;
 
@@ -23,6 +25,12 @@ void PackGenTestEnv::SetUp() {
   testoutput_folder = fs::canonical(testoutput_folder).generic_string();
   ASSERT_FALSE(testinput_folder.empty());
   ASSERT_FALSE(testoutput_folder.empty());
+
+  // Copy PACK.xsd next to the executable, where the built-in packchk searches it
+  error_code ec;
+  const string& exeDir = RteUtils::ExtractFilePath(CrossPlatformUtils::GetExecutablePath(ec), true);
+  fs::copy_file(fs::path(string(PACKXSD_FOLDER) + "/PACK.xsd"), fs::path(exeDir + "PACK.xsd"),
+    fs::copy_options::overwrite_existing, ec);
 }
 
 void PackGenTestEnv::TearDown() {
@@ -10,6 +10,7 @@
 
 #include "gtest/gtest.h"
 
+#include <nlohmann/json.hpp>
 #include <iostream>
 #include <fstream>
 #include <regex>
@@ -311,6 +312,41 @@ TEST_F(PackGenUnitTests, RunPackGenMultipleBuilds) {
               testinput_folder + "/CMakeTestMultipleBuilds/ARM.TestPackMultipleBuilds.pdsc");
 }
 
+TEST_F(PackGenUnitTests, ParseReplyTest) {
+  m_manifest = testinput_folder + "/CMakeTestProject/manifest.yml";
+  m_outputRoot = testoutput_folder + "/ParseReply";
+  ASSERT_TRUE(ParseManifest());
+  ASSERT_TRUE(CreateQuery());
+  ASSERT_TRUE(ParseReply());
+  EXPECT_EQ(5U, m_target.size());
+  const targetInfo lib1 = m_target["lib1"]["build1"];
+  EXPECT_EQ(set<string>({ "lib1/src/lib1.cpp" }), lib1.build.src);
+  EXPECT_EQ(1, lib1.build.inc.count("lib1/inc"));
+  EXPECT_EQ(set<string>({ "lib3", "lib4" }), m_target["lib2"]["build1"].dependency);
+
+  // A reply failing to parse keeps the information read before the failure
+  string lib2Reply;
+  for (const auto& p : fs::recursive_directory_iterator(m_outputRoot + "/build1/.cmake/api/v1/reply")) {
+    if (p.path().filename().generic_string().find("target-lib2-") == 0) {
+      lib2Reply = p.path().generic_string();
+    }
+  }
+  ASSERT_FALSE(lib2Reply.empty());
+  ifstream replyFile(lib2Reply);
+  nlohmann::json reply = nlohmann::json::parse(replyFile);
+  replyFile.close();
+  reply["dependencies"][0].erase("id");
+  ofstream(lib2Reply) << reply.dump();
+
+  m_target.clear();
+  EXPECT_TRUE(ParseReply());
+  EXPECT_EQ(5U, m_target.size());
+  EXPECT_EQ(lib1.build.src, m_target["lib1"]["build1"].build.src);
+  EXPECT_EQ(lib1.build.inc, m_target["lib1"]["build1"].build.inc);
+  EXPECT_EQ(set<string>({ "lib2/src/lib2.cpp" }), m_target["lib2"]["build1"].build.src);
+  EXPECT_TRUE(m_target["lib2"]["build1"].dependency.empty());
+}
+
 TEST_F(PackGenUnitTests, ParseManifestTest) {
   // Empty manifest
   m_manifest = "";
@@ -539,3 +575,90 @@ TEST_F(PackGenUnitTests, CreatePackTaxonomyTest) {
   EXPECT_EQ(taxonomyCgroup2, rootElement->GetGrandChildren("taxonomy").back()->GetAttribute("Cgroup"));
   EXPECT_EQ(taxonomyDescription2, rootElement->GetGrandChildren("taxonomy").back()->GetText());
 }
+
+TEST_F(PackGenUnitTests, CompressPackTest) {
+  packInfo pack;
+  pack.name = "TestPack";
+  pack.vendor = "ARM";
+  pack.version = "1.0.0";
+  pack.outputDir = testoutput_folder + "/CompressPack/ARM.TestPack.1.0.0";
+  m_repoRoot = testinput_folder + "/TestProject";
+
+  // Copied files are recorded with their source location
+  list<string> ext;
+  CopyItem(pack, m_repoRoot + "/LICENSE", "LICENSE", ext);
+  CopyItem(pack, m_repoRoot + "/lib1/inc", "lib1/inc/", ext);
+  EXPECT_TRUE(RteFsUtils::Exists(pack.outputDir + "/LICENSE"));
+  EXPECT_EQ(m_repoRoot + "/LICENSE", pack.files["LICENSE"]);
+  for (const auto& [name, src] : pack.files) {
+    EXPECT_TRUE(RteFsUtils::Exists(pack.outputDir + "/" + name)) << name;
+  }
+  m_pack.push_back(pack);
+
+  // Identical inputs give identical pack files
+  const string& packFile = pack.outputDir + "/ARM.TestPack.1.0.0.pack";
+  string content1, content2;
+  EXPECT_TRUE(CompressPack());
+  EXPECT_TRUE(RteFsUtils::ReadFile(packFile, content1));
+  EXPECT_FALSE(content1.empty());
+  EXPECT_TRUE(CompressPack());
+  EXPECT_TRUE(RteFsUtils::ReadFile(packFile, content2));
+  EXPECT_EQ(content1, content2);
+
+  // Missing source file
+  m_pack.back().files["missing.h"] = m_repoRoot + "/missing.h";
+  EXPECT_FALSE(CompressPack());
+}
+
+TEST_F(PackGenUnitTests, CheckPackTest) {
+  // Two generated packs, the second one requires a component of the first one
+  const auto& writePack = [this](const string& name, const string& content) {
+    packInfo pack;
+    pack.name = name;
+    pack.vendor = "TestVendor";
+    pack.version = "1.0.0";
+    pack.outputDir = testoutput_folder + "/CheckPack/TestVendor." + name + ".1.0.0";
+    RteFsUtils::CreateDirectories(pack.outputDir + "/inc");
+    RteFsUtils::CreateFile(pack.outputDir + "/inc/" + name + ".h", "#define " + name + " 1\n");
+    RteFsUtils::CreateFile(pack.outputDir + "/TestVendor." + name + ".pdsc",
+      "<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n"
+      "<package schemaVersion=\"1.7.7\" xmlns:xs=\"http://www.w3.org/2001/XMLSchema-instance\" xs:noNamespaceSchemaLocation=\"PACK.xsd\">\n"
+      "  <vendor>TestVendor</vendor>\n"
+      "  <name>" + name + "</name>\n"
+      "  <description>" + name + " description</description>\n"
+      "  <url>http://arm.com/</url>\n"
+      "  <releases>\n"
+      "    <release version=\"1.0.0\" date=\"2023-01-01\">Initial release</release>\n"
+      "  </releases>\n" + content +
+      "</package>\n");
+    m_pack.push_back(pack);
+  };
+  writePack("PackA",
+    "  <components>\n"
+    "    <component Cclass=\"Class\" Cgroup=\"PackA\" Cversion=\"1.0.0\">\n"
+    "      <description>Component of PackA</description>\n"
+    "      <files>\n"
+    "        <file category=\"header\" name=\"inc/PackA.h\"/>\n"
+    "      </files>\n"
+    "    </component>\n"
+    "  </components>\n");
+  writePack("PackB",
+    "  <conditions>\n"
+    "    <condition id=\"Requires PackA\">\n"
+    "      <require Cclass=\"Class\" Cgroup=\"PackA\"/>\n"
+    "    </condition>\n"
+    "  </conditions>\n"
+    "  <components>\n"
+    "    <component Cclass=\"Class\" Cgroup=\"PackB\" Cversion=\"1.0.0\" condition=\"Requires PackA\">\n"
+    "      <description>Component of PackB</description>\n"
+    "      <files>\n"
+    "        <file category=\"header\" name=\"inc/PackB.h\"/>\n"
+    "      </files>\n"
+    "    </component>\n"
+    "  </components>\n");
+  EXPECT_TRUE(CheckPack());
+
+  // A file missing in the second pack fails the check of all packs
+  RteFsUtils::RemoveFile(m_pack.back().outputDir + "/inc/PackB.h");
+  EXPECT_FALSE(CheckPack());
+}
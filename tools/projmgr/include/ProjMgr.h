@@ -104,6 +104,7 @@ protected:
   std::string m_clayerSearchPath;
   std::string m_export;
   std::string m_selectedToolchain;
+  std::string m_traceFile;
   bool m_checkSchema;
   bool m_missingPacks;
   bool m_updateRteFiles;
@@ -129,6 +130,7 @@ protected:
   bool RunListToolchains(void);
   bool RunListEnvironment(void);
   bool PopulateContexts(void);
+  bool WriteTraceFile(void);
   bool SetLoadPacksPolicy(void);
 };
 
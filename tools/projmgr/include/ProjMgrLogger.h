@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2020-2021 Arm Limited. All rights reserved.
+ * Copyright (c) 2020-2023 Arm Limited. All rights reserved.
  *
  * SPDX-License-Identifier: Apache-2.0
  */
@@ -7,7 +7,10 @@
 #ifndef PROJMGRLOGGER_H
 #define PROJMGRLOGGER_H
 
+#include <ostream>
 #include <string>
+#include <utility>
+#include <vector>
 
 /**
  * @brief projmgr logger class
@@ -52,6 +55,28 @@ public:
   static void Info(const std::string& file, const int line, const int column, const std::string& msg);
   static void Info(const std::string& file, const std::string& msg);
   static void Info(const std::string& msg);
+
+  /**
+   * @brief messages collected instead of being printed: output stream and message text
+  */
+  typedef std::vector<std::pair<std::ostream*, std::string>> MessageBuffer;
+
+  /**
+   * @brief redirect messages issued by the calling thread into a buffer instead of printing them
+   * @param buffer message buffer, nullptr to print messages directly again
+   * @return previous buffer of the calling thread
+  */
+  static MessageBuffer* SetThreadMessageBuffer(MessageBuffer* buffer);
+
+  /**
+   * @brief print buffered messages
+   * @param buffer message buffer
+  */
+  static void PrintMessageBuffer(const MessageBuffer& buffer);
+
+protected:
+  static void Print(std::ostream& stream, const std::string& msg);
+  static thread_local MessageBuffer* m_threadMessageBuffer;
 };
 
 #endif  // PROJMGRLOGGER_H
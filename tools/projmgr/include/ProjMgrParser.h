@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2020-2021 Arm Limited. All rights reserved.
+ * Copyright (c) 2020-2023 Arm Limited. All rights reserved.
  *
  * SPDX-License-Identifier: Apache-2.0
  */
@@ -7,6 +7,10 @@
 #ifndef PROJMGRPARSER_H
 #define PROJMGRPARSER_H
 
+#include "ProjMgrLogger.h"
+
+#include <exception>
+#include <functional>
 #include <map>
 #include <string>
 #include <vector>
@@ -453,6 +457,20 @@ public:
   */
   bool ParseClayer(const std::string& input, bool checkSchema);
 
+  /**
+   * @brief parse cproject files concurrently, files are merged and messages are printed in the given order
+   * @param inputs list of cproject.yml files
+   * @return true if all files are parsed, otherwise false after the first failing file
+  */
+  bool ParseCprojects(const std::vector<std::string>& inputs, bool checkSchema);
+
+  /**
+   * @brief parse clayer files concurrently in advance, results and messages of a file are
+   *        kept back until ParseClayer() is called for it, so messages keep the sequential order
+   * @param inputs list of clayer.yml files, already parsed files are skipped
+  */
+  void PreParseClayers(const std::vector<std::string>& inputs, bool checkSchema);
+
   /**
    * @brief parse generic clayer files
    * @param input clayer.yml file
@@ -507,6 +525,22 @@ protected:
   std::map<std::string, CprojectItem> m_cprojects;
   std::map<std::string, ClayerItem> m_clayers;
   std::map<std::string, ClayerItem> m_genericClayers;
+
+  template<typename T>
+  struct ParseResult {
+    std::string input;
+    std::map<std::string, T> items;
+    ProjMgrLogger::MessageBuffer messages;
+    bool success = false;
+    std::exception_ptr exception;
+  };
+  std::map<std::string, ParseResult<ClayerItem>> m_preParsedClayers;
+
+  template<typename T>
+  std::vector<ParseResult<T>> ParseConcurrently(const std::vector<std::string>& inputs, const std::map<std::string, T>& items,
+    const std::function<bool(const std::string&, std::map<std::string, T>&)>& parse);
+  template<typename T>
+  bool MergeResult(ParseResult<T>& result, std::map<std::string, T>& items);
 };
 
 #endif  // PROJMGRPARSER_H
@@ -107,6 +107,37 @@ struct PackageItem {
   std::string path;
 };
 
+/**
+ * @brief pack versions of a pack, sorted in descending order,
+ *        mapped to the pdsc file of the version
+*/
+typedef std::map<std::string, std::string, VersionCmp::Greater> PackVersionMap;
+
+/**
+ * @brief pack versions mapped by vendor and name, compared case-insensitively
+*/
+typedef std::map<std::string, std::map<std::string, PackVersionMap, AlnumCmp::LenLessNoCase>, AlnumCmp::LenLessNoCase> PackNameIndex;
+
+/**
+ * @brief pack version index of the pack root containing
+ *        installed packs mapped by vendor and name,
+ *        local repository packs mapped by vendor and name
+*/
+struct PackVersionIndex {
+  PackNameIndex installed;
+  PackNameIndex local;
+};
+
+/**
+ * @brief resolved pack requirement containing
+ *        pdsc files satisfying the requirement,
+ *        required packs that are not installed
+*/
+struct ResolvedPackRequirement {
+  StrVec pdscFiles;
+  std::vector<PackInfo> missingPacks;
+};
+
 /**
  * @brief device item containing
  *        device name,
@@ -627,6 +658,9 @@ protected:
   std::vector<std::string> m_selectedContexts;
   std::string m_outputDir;
   std::string m_packRoot;
+  std::string m_packIndexRoot;
+  PackVersionIndex m_packIndex;
+  std::map<std::string, ResolvedPackRequirement> m_resolvedPackRequirements;
   std::string m_compilerRoot;
   std::string m_selectedToolchain;
   LoadPacksPolicy m_loadPacksPolicy;
@@ -638,6 +672,10 @@ protected:
 
   bool LoadPacks(ContextItem& context);
   bool GetRequiredPdscFiles(ContextItem& context, const std::string& packRoot, std::set<std::string>& errMsgs);
+  void UpdatePackIndex(const std::string& packRoot);
+  const ResolvedPackRequirement& ResolvePackRequirement(const PackInfo& pack, const std::string& reqVersionRange, const std::string& packRoot);
+  static const PackVersionMap::value_type* FindPackVersion(const PackNameIndex& index,
+    const PackInfo& pack, const std::string& versionRange);
   bool CheckRteErrors(void);
   bool CheckBoardDeviceInLayer(const ContextItem& context, const ClayerItem& clayer);
   bool CheckCompiler(const std::vector<std::string>& forCompiler, const std::string& selectedCompiler);
@@ -693,7 +731,7 @@ protected:
   bool GetPrecedentValue(std::string& outValue, const std::string& element) const;
   std::string GetDeviceInfoString(const std::string& vendor, const std::string& name, const std::string& processor) const;
   std::string GetBoardInfoString(const std::string& vendor, const std::string& name, const std::string& revision) const;
-  std::vector<PackageItem> GetFilteredPacks(const PackageItem& packItem, const std::string& rtePath) const;
+  std::vector<PackageItem> GetFilteredPacks(const PackageItem& packItem) const;
   ToolchainItem GetToolchain(const std::string& compiler);
   bool IsPreIncludeByTarget(const RteTarget* activeTarget, const std::string& preInclude);
   void PrintConnectionsValidation(ConnectionsValidationResult result, std::string& msg);
@@ -730,6 +768,10 @@ protected:
   void ExpandAccessSequence(const ContextItem& context, const ContextItem& refContext, const std::string& sequence, std::string& item, bool withHeadingDot);
   bool GetGeneratorDir(const RteGenerator* generator, ContextItem& context, const std::string& layer, std::string& genDir);
   bool ParseContextLayers(ContextItem& context);
+  bool GetContextLayerFiles(const ContextItem& context, StrVec& clayerFiles);
+  StrPairVec ResolveContextLayers(const ContextItem& context, const StrMap& variables);
+  void MergeUserVariables(const ContextItem& context, StrMap& variables, bool warn);
+  static bool HasUndefinedVariable(const std::string& clayer);
   bool AddPackRequirements(ContextItem& context, const std::vector<PackItem> packRequirements);
   void CheckTypeFilterSpelling(const TypeFilter& typeFilter);
   void CheckCompilerFilterSpelling(const std::string& compiler);
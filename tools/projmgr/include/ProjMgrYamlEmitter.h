@@ -40,12 +40,22 @@ public:
   */
   static bool GenerateCbuild(ContextItem* context, const RteGenerator* generator = nullptr);
 
+  /**
+   * @brief generate cbuild.yml files of several contexts concurrently, messages are printed and files written in context order
+   * @param contexts vector with pointers to contexts
+   * @return true if executed successfully for all contexts, false at the first failing context
+  */
+  static bool GenerateCbuilds(const std::vector<ContextItem*>& contexts);
+
   /**
    * @brief generate cbuild set file
    * @param contexts vector with pointers to contexts
    * @return true if executed successfully
   */
   static bool GenerateCbuildSet(ProjMgrParser& parser, const std::vector<ContextItem*> contexts, const std::string& selectedCompiler);
+
+protected:
+  static bool WriteCbuild(ContextItem* context, const RteGenerator* generator);
 };
 
 #endif  // PROJMGRYAMLEMITTER_H
@@ -8,6 +8,7 @@
 #define PROJMGRYAMLPARSER_H
 
 #include "ProjMgrParser.h"
+#include "ProjMgrYamlSchemaChecker.h"
 #include "yaml-cpp/yaml.h"
 
 /**
@@ -187,6 +188,7 @@ public:
   */
   bool ParseCbuildSet(const std::string& input, CbuildSetItem& cbuildSet);
 protected:
+  bool LoadFile(const std::string& input, YAML::Node& root, bool checkSchema, ProjMgrYamlSchemaChecker::FileType type);
   void ParseMisc(const YAML::Node& parent, std::vector<MiscItem>& misc);
   void ParseDefine(const YAML::Node& parent, std::vector<std::string>& define);
   void ParsePacks(const YAML::Node& parent, const std::string& file, std::vector<PackItem>& packs);
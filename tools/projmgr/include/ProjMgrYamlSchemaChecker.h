@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2020-2022 Arm Limited. All rights reserved.
+ * Copyright (c) 2020-2023 Arm Limited. All rights reserved.
  *
  * SPDX-License-Identifier: Apache-2.0
  */
@@ -9,6 +9,8 @@
 
 #include "SchemaChecker.h"
 
+#include "yaml-cpp/yaml.h"
+
 /**
   * @brief projmgr schema checker implementation class, directly coupled to underlying YamlSchemaChecker library
 */
@@ -41,6 +43,23 @@ public:
   */
   bool Validate(const std::string& input, ProjMgrYamlSchemaChecker::FileType type);
 
+  /**
+   * @brief Validate already loaded data with schemas
+   * @param root data loaded from input file
+   * @param input path of input file, used for messages
+   * @param type File type
+   * @return true if the validation pass otherwise false
+  */
+  bool Validate(const YAML::Node& root, const std::string& input, ProjMgrYamlSchemaChecker::FileType type);
+
+  /**
+   * @brief Load yaml file, syntax errors are reported as schema check failures
+   * @param input file to be loaded
+   * @param root loaded data
+   * @return true if the file is loaded otherwise false
+  */
+  bool Load(const std::string& input, YAML::Node& root);
+
   /**
    * @brief get list of errors found
    * @return list of errors
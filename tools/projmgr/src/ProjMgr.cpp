@@ -10,6 +10,7 @@
 #include "ProjMgrUtils.h"
 #include "ProductInfo.h"
 #include "RteFsUtils.h"
+#include "RteTrace.h"
 
 #include "CrossPlatformUtils.h"
 
@@ -51,6 +52,7 @@ Options:\n\
   -N, --no-update-rte           Skip creation of RTE directory and files\n\
   -o, --output arg              Output directory\n\
   -t, --toolchain arg           Selection of the toolchain used in the project optionally with version\n\
+      --trace arg               Write timing and allocation events to a Chrome trace event file\n\
   -v, --verbose                 Enable verbose messages\n\
   -V, --version                 Print version\n\n\
 Use 'csolution <command> -h' for more information about a command.\n\
@@ -114,6 +116,7 @@ void ProjMgr::ShowVersion(void) {
 
 int ProjMgr::RunProjMgr(int argc, char **argv, char** envp) {
   ProjMgr manager;
+  RteFsUtils::ClearCanonicalPathCache();
 
   // Command line options
   cxxopts::Options options(ORIGINAL_FILENAME);
@@ -138,12 +141,13 @@ int ProjMgr::RunProjMgr(int argc, char **argv, char** envp) {
   cxxopts::Option exportSuffix("e,export", "Set suffix for exporting <context><suffix>.cprj retaining only specified versions", cxxopts::value<string>());
   cxxopts::Option toolchain("t,toolchain","Selection of the toolchain used in the project optionally with version", cxxopts::value<string>());
   cxxopts::Option ymlOrder("yml-order", "Preserve order as specified in input yml", cxxopts::value<bool>()->default_value("false"));
+  cxxopts::Option trace("trace", "Write timing and allocation events to a Chrome trace event file", cxxopts::value<string>());
 
   // command options dictionary
   map<string, std::pair<bool, vector<cxxopts::Option>>> optionsDict = {
     // command, optional args, options
-    {"update-rte",        { false, {context, debug, load, schemaCheck, toolchain, verbose}}},
-    {"convert",           { false, {context, debug, exportSuffix, load, schemaCheck, noUpdateRte, output, toolchain, verbose}}},
+    {"update-rte",        { false, {context, debug, load, schemaCheck, toolchain, trace, verbose}}},
+    {"convert",           { false, {context, debug, exportSuffix, load, schemaCheck, noUpdateRte, output, toolchain, trace, verbose}}},
     {"run",               { false, {context, debug, generator, load, schemaCheck, verbose, dryRun}}},
     {"list packs",        { true,  {context, debug, filter, load, missing, schemaCheck, toolchain, verbose}}},
     {"list boards",       { true,  {context, debug, filter, load, schemaCheck, toolchain, verbose}}},
@@ -163,7 +167,7 @@ int ProjMgr::RunProjMgr(int argc, char **argv, char** envp) {
       {"positional", "", cxxopts::value<vector<string>>()},
       solution, context, contextReplacement, filter, generator,
       load, clayerSearchPath, missing, schemaCheck, noUpdateRte, output,
-      help, version, verbose, debug, dryRun, exportSuffix, toolchain, ymlOrder
+      help, version, verbose, debug, dryRun, exportSuffix, toolchain, ymlOrder, trace
     });
     options.parse_positional({ "positional" });
 
@@ -242,6 +246,9 @@ int ProjMgr::RunProjMgr(int argc, char **argv, char** envp) {
       manager.m_outputDir = parseResult["output"].as<string>();
       manager.m_outputDir = fs::path(manager.m_outputDir).generic_string();
     }
+    if (parseResult.count("trace")) {
+      manager.m_traceFile = parseResult["trace"].as<string>();
+    }
   } catch (cxxopts::OptionException& e) {
     ProjMgrLogger::Error(e.what());
     return 1;
@@ -327,12 +334,16 @@ int ProjMgr::RunProjMgr(int argc, char **argv, char** envp) {
     }
   } else if (manager.m_command == "update-rte") {
     // Process 'update-rte' command
-    if (!manager.RunConfigure(true)) {
+    RteTrace::Enable(!manager.m_traceFile.empty());
+    bool success = manager.RunConfigure(true);
+    if (!manager.WriteTraceFile() || !success) {
       return 1;
     }
   } else if (manager.m_command == "convert") {
     // Process 'convert' command
-    if (!manager.RunConvert()) {
+    RteTrace::Enable(!manager.m_traceFile.empty());
+    bool success = manager.RunConvert();
+    if (!manager.WriteTraceFile() || !success) {
       return 1;
     }
   } else if (manager.m_command == "run") {
@@ -365,6 +376,7 @@ bool ProjMgr::SetLoadPacksPolicy(void) {
 }
 
 bool ProjMgr::PopulateContexts(void) {
+  RteTraceScope trace("projmgr", "PopulateContexts");
   if (!m_csolutionFile.empty()) {
     // Parse csolution
     if (!m_parser.ParseCsolution(m_csolutionFile, m_checkSchema)) {
@@ -395,6 +407,7 @@ bool ProjMgr::PopulateContexts(void) {
       }
     }
     // Parse cprojects
+    StrVec cprojectFiles;
     for (const auto& cproject : cprojects) {
       error_code ec;
       string const& cprojectFile = fs::canonical(m_rootDir + "/" + cproject, ec).generic_string();
@@ -402,9 +415,10 @@ bool ProjMgr::PopulateContexts(void) {
         ProjMgrLogger::Error(cproject, "cproject file was not found");
         return false;
       }
-      if (!m_parser.ParseCproject(cprojectFile, m_checkSchema)) {
-        return false;
-      }
+      cprojectFiles.push_back(cprojectFile);
+    }
+    if (!m_parser.ParseCprojects(cprojectFiles, m_checkSchema)) {
+      return false;
     }
   } else {
     ProjMgrLogger::Error("input yml files were not specified");
@@ -464,6 +478,7 @@ bool ProjMgr::RunConfigure(bool printConfig) {
     if (!m_worker.IsContextSelected(contextName)) {
       continue;
     }
+    RteTraceScope trace("projmgr", contextName);
     if (!m_worker.ProcessContext(contextItem, true, true, m_updateRteFiles)) {
       ProjMgrLogger::Error("processing context '" + contextName + "' failed");
       error = true;
@@ -531,15 +546,27 @@ bool ProjMgr::RunConvert(void) {
   }
 
   // Generate cbuild files
-  for (auto& contextItem : m_processedContexts) {
-    if (!m_emitter.GenerateCbuild(contextItem)) {
-      return false;
-    }
+  RteTraceScope trace("projmgr", "GenerateCbuilds");
+  if (!m_emitter.GenerateCbuilds(m_processedContexts)) {
+    return false;
   }
 
   return !error;
 }
 
+bool ProjMgr::WriteTraceFile(void) {
+  if (m_traceFile.empty()) {
+    return true;
+  }
+  RteTrace::Enable(false);
+  if (!RteTrace::WriteChromeTrace(m_traceFile)) {
+    ProjMgrLogger::Error(m_traceFile, "trace file cannot be written");
+    return false;
+  }
+  ProjMgrLogger::Info(m_traceFile, "trace file generated successfully");
+  return true;
+}
+
 bool ProjMgr::RunListPacks(void) {
   if (!m_csolutionFile.empty()) {
     // Parse all input files and create contexts
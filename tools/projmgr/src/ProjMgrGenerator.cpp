@@ -410,17 +410,13 @@ const string ProjMgrGenerator::GetLocalTimestamp() {
 }
 
 bool ProjMgrGenerator::WriteXmlFile(const string& file, XMLTree* tree) {
-  // Format Xml content
-  XmlFormatter xmlFormatter(tree, SCHEMA_FILE, SCHEMA_VERSION);
-  const string& xmlContent = xmlFormatter.GetContent();
-
-  // Save file
+  // Save file, Xml content is formatted directly into the file stream
   ofstream xmlFile(file);
   if (!xmlFile) {
     return false;
   }
 
-  xmlFile << xmlContent;
+  XmlFormatter().Format(xmlFile, tree, SCHEMA_FILE, SCHEMA_VERSION);
   xmlFile << std::endl;
   xmlFile.close();
 
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2020-2021 Arm Limited. All rights reserved.
+ * Copyright (c) 2020-2023 Arm Limited. All rights reserved.
  *
  * SPDX-License-Identifier: Apache-2.0
  */
@@ -16,6 +16,8 @@ static constexpr const char* PROJMGR_WARN = "warning";
 static constexpr const char* PROJMGR_DEBUG = "debug";
 static constexpr const char* PROJMGR_INFO = "info";
 
+thread_local ProjMgrLogger::MessageBuffer* ProjMgrLogger::m_threadMessageBuffer = nullptr;
+
 ProjMgrLogger::ProjMgrLogger(void) {
   // Reserved
 }
@@ -25,41 +27,61 @@ ProjMgrLogger::~ProjMgrLogger(void) {
 }
 
 void ProjMgrLogger::Error(const string& file, const int line, const int column, const string& msg) {
-  cerr << file << ":" << line << ":" << column << " - " << PROJMGR_ERROR << PROJMGR_TOOL << msg << endl;
+  Print(cerr, file + ":" + to_string(line) + ":" + to_string(column) + " - " + PROJMGR_ERROR + PROJMGR_TOOL + msg);
 }
 
 void ProjMgrLogger::Error(const string& file, const string& msg) {
-  cerr << file << " - " << PROJMGR_ERROR << PROJMGR_TOOL << msg << endl;
+  Print(cerr, file + " - " + PROJMGR_ERROR + PROJMGR_TOOL + msg);
 }
 
 void ProjMgrLogger::Error(const string& msg) {
-  cerr << PROJMGR_ERROR << PROJMGR_TOOL << msg << endl;
+  Print(cerr, string(PROJMGR_ERROR) + PROJMGR_TOOL + msg);
 }
 
 void ProjMgrLogger::Warn(const string& file, const int line, const int column, const string& msg) {
-  cerr << file << ":" << line << ":" << column << " - " << PROJMGR_WARN << PROJMGR_TOOL << msg << endl;
+  Print(cerr, file + ":" + to_string(line) + ":" + to_string(column) + " - " + PROJMGR_WARN + PROJMGR_TOOL + msg);
 }
 
 void ProjMgrLogger::Warn(const string& file, const string& msg) {
-  cerr << file << " - " << PROJMGR_WARN << PROJMGR_TOOL << msg << endl;
+  Print(cerr, file + " - " + PROJMGR_WARN + PROJMGR_TOOL + msg);
 }
 
 void ProjMgrLogger::Warn(const string& msg) {
-  cerr << PROJMGR_WARN << PROJMGR_TOOL << msg << endl;
+  Print(cerr, string(PROJMGR_WARN) + PROJMGR_TOOL + msg);
 }
 
 void ProjMgrLogger::Debug(const string& msg) {
-  cerr << PROJMGR_DEBUG << PROJMGR_TOOL << msg << endl;
+  Print(cerr, string(PROJMGR_DEBUG) + PROJMGR_TOOL + msg);
 }
 
 void ProjMgrLogger::Info(const string& file, const int line, const int column, const string& msg) {
-  cout << file << ":" << line << ":" << column << PROJMGR_TOOL << PROJMGR_INFO << msg << endl;
+  Print(cout, file + ":" + to_string(line) + ":" + to_string(column) + PROJMGR_TOOL + PROJMGR_INFO + msg);
 }
 
 void ProjMgrLogger::Info(const string& file, const string& msg) {
-  cout << file << " - " << PROJMGR_INFO << PROJMGR_TOOL << msg << endl;
+  Print(cout, file + " - " + PROJMGR_INFO + PROJMGR_TOOL + msg);
 }
 
 void ProjMgrLogger::Info(const string& msg) {
-  cout << PROJMGR_INFO << PROJMGR_TOOL << msg << endl;
+  Print(cout, string(PROJMGR_INFO) + PROJMGR_TOOL + msg);
+}
+
+ProjMgrLogger::MessageBuffer* ProjMgrLogger::SetThreadMessageBuffer(MessageBuffer* buffer) {
+  MessageBuffer* prevBuffer = m_threadMessageBuffer;
+  m_threadMessageBuffer = buffer;
+  return prevBuffer;
+}
+
+void ProjMgrLogger::PrintMessageBuffer(const MessageBuffer& buffer) {
+  for (const auto& [stream, msg] : buffer) {
+    Print(*stream, msg);
+  }
+}
+
+void ProjMgrLogger::Print(ostream& stream, const string& msg) {
+  if (m_threadMessageBuffer) {
+    m_threadMessageBuffer->push_back({ &stream, msg });
+  } else {
+    stream << msg << endl;
+  }
 }
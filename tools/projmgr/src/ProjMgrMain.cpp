@@ -5,6 +5,32 @@
  */
 
 #include "ProjMgr.h"
+#include "RteTrace.h"
+
+#include <cstdlib>
+#include <new>
+
+#ifdef PROJMGR_TRACE_ALLOCATIONS
+/*
+Count allocated bytes for the --trace option, enabled by the CMake option PROJMGR_TRACE_ALLOCATIONS
+*/
+void* operator new(std::size_t size) {
+  RteTrace::CountAllocation(size);
+  void* p = std::malloc(size ? size : 1);
+  if (!p) {
+    throw std::bad_alloc();
+  }
+  return p;
+}
+
+void operator delete(void* p) noexcept {
+  std::free(p);
+}
+
+void operator delete(void* p, std::size_t) noexcept {
+  std::free(p);
+}
+#endif
 
 /*
 Main function
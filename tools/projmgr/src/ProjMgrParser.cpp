@@ -1,12 +1,17 @@
 /*
- * Copyright (c) 2020-2021 Arm Limited. All rights reserved.
+ * Copyright (c) 2020-2023 Arm Limited. All rights reserved.
  *
  * SPDX-License-Identifier: Apache-2.0
  */
 
 #include "ProjMgrParser.h"
+#include "ProjMgrLogger.h"
 #include "ProjMgrYamlParser.h"
+#include "RteUtils.h"
 
+#include <algorithm>
+#include <exception>
+#include <functional>
 #include <iostream>
 #include <string>
 
@@ -40,10 +45,88 @@ bool ProjMgrParser::ParseCproject(const string& input, bool checkSchema, bool si
 }
 
 bool ProjMgrParser::ParseClayer(const string& input, bool checkSchema) {
+  // Take over layer file parsed in advance
+  auto it = m_preParsedClayers.find(input);
+  if (it != m_preParsedClayers.end()) {
+    auto result = move(it->second);
+    m_preParsedClayers.erase(it);
+    return MergeResult(result, m_clayers);
+  }
   // Parse layer file
   return ProjMgrYamlParser().ParseClayer(input, m_clayers, checkSchema);
 }
 
+bool ProjMgrParser::ParseCprojects(const vector<string>& inputs, bool checkSchema) {
+  // Parse project files, stop at the first failing one
+  auto results = ParseConcurrently<CprojectItem>(inputs, m_cprojects,
+    [checkSchema](const string& input, map<string, CprojectItem>& cprojects) {
+      CsolutionItem csolution;
+      return ProjMgrYamlParser().ParseCproject(input, csolution, cprojects, false, checkSchema);
+    });
+  for (auto& result : results) {
+    if (!MergeResult(result, m_cprojects)) {
+      return false;
+    }
+  }
+  return true;
+}
+
+void ProjMgrParser::PreParseClayers(const vector<string>& inputs, bool checkSchema) {
+  // Parse layer files, ParseClayer() takes over the results
+  m_preParsedClayers.clear();
+  auto results = ParseConcurrently<ClayerItem>(inputs, m_clayers,
+    [checkSchema](const string& input, map<string, ClayerItem>& clayers) {
+      return ProjMgrYamlParser().ParseClayer(input, clayers, checkSchema);
+    });
+  for (auto& result : results) {
+    m_preParsedClayers[result.input] = move(result);
+  }
+}
+
+/**
+ * Files are parsed by worker threads into separate maps, messages are collected per file.
+ * Results are returned in input order, so the outcome does not depend on thread scheduling.
+*/
+template<typename T>
+vector<ProjMgrParser::ParseResult<T>> ProjMgrParser::ParseConcurrently(const vector<string>& inputs,
+  const map<string, T>& items, const function<bool(const string&, map<string, T>&)>& parse) {
+  // already parsed files and duplicates are skipped
+  vector<ParseResult<T>> results;
+  for (const auto& input : inputs) {
+    if ((items.find(input) == items.end()) && (find_if(results.begin(), results.end(),
+      [&input](const ParseResult<T>& r) { return r.input == input; }) == results.end())) {
+      results.emplace_back();
+      results.back().input = input;
+    }
+  }
+
+  RteUtils::RunConcurrently(results.size(), [&](size_t i) {
+    auto& result = results[i];
+    const auto prevBuffer = ProjMgrLogger::SetThreadMessageBuffer(&result.messages);
+    try {
+      result.success = parse(result.input, result.items);
+    }
+    catch (...) {
+      result.exception = current_exception();
+    }
+    ProjMgrLogger::SetThreadMessageBuffer(prevBuffer);
+  });
+  return results;
+}
+
+template<typename T>
+bool ProjMgrParser::MergeResult(ParseResult<T>& result, map<string, T>& items) {
+  ProjMgrLogger::PrintMessageBuffer(result.messages);
+  if (result.exception) {
+    rethrow_exception(result.exception);
+  }
+  if (!result.success) {
+    return false;
+  }
+  items.merge(result.items);
+  return true;
+}
+
 bool ProjMgrParser::ParseGenericClayer(const string& input, bool checkSchema) {
   // Parse generic layer file
   return ProjMgrYamlParser().ParseClayer(input, m_genericClayers, checkSchema);
@@ -10,6 +10,7 @@
 
 #include "CrossPlatformUtils.h"
 #include "RteFsUtils.h"
+#include "RteTrace.h"
 
 #include <algorithm>
 #include <iostream>
@@ -140,43 +141,73 @@ void ProjMgrWorker::AddContext(ContextDesc& descriptor, const TypePair& type, Co
   }
 }
 
-bool ProjMgrWorker::ParseContextLayers(ContextItem& context) {
-  // user defined variables
-  auto userVariablesList = {
+void ProjMgrWorker::MergeUserVariables(const ContextItem& context, StrMap& variables, bool warn) {
+  const auto userVariablesList = {
     context.csolution->target.build.variables,
     context.csolution->buildTypes[context.type.build].variables,
     context.csolution->targetTypes[context.type.target].build.variables,
   };
   for (const auto& var : userVariablesList) {
     for (const auto& [key, value] : var) {
-      if ((context.variables.find(key) != context.variables.end()) && (context.variables.at(key) != value)) {
-        ProjMgrLogger::Warn("variable '" + key + "' redefined from '" + context.variables.at(key) + "' to '" + value + "'");
+      if (warn && (variables.find(key) != variables.end()) && (variables.at(key) != value)) {
+        ProjMgrLogger::Warn("variable '" + key + "' redefined from '" + variables.at(key) + "' to '" + value + "'");
       }
-      context.variables[key] = value;
+      variables[key] = value;
     }
   }
-  // parse clayers
+}
+
+StrPairVec ProjMgrWorker::ResolveContextLayers(const ContextItem& context, const StrMap& variables) {
+  // layer references and their canonical file names, empty if the file was not found
+  StrPairVec clayerFiles;
   for (const auto& clayer : context.cproject->clayers) {
-    if (clayer.layer.empty()) {
+    if (clayer.layer.empty() || !CheckContextFilters(clayer.typeFilter, context)) {
       continue;
     }
-    if (CheckContextFilters(clayer.typeFilter, context)) {
-      error_code ec;
-      string const& clayerRef = ExpandString(clayer.layer, context.variables);
-      string const& clayerFile = fs::canonical(fs::path(context.cproject->directory).append(clayerRef), ec).generic_string();
-      if (clayerFile.empty()) {
-        if (regex_match(clayer.layer, regex(".*\\$.*\\$.*"))) {
-          ProjMgrLogger::Warn(clayer.layer, "variable was not defined for context '" + context.name +"'");
-        } else {
-          ProjMgrLogger::Error(clayer.layer, "clayer file was not found");
-          return false;
-        }
+    error_code ec;
+    string const& clayerRef = ExpandString(clayer.layer, variables);
+    clayerFiles.push_back({ clayer.layer, fs::canonical(fs::path(context.cproject->directory).append(clayerRef), ec).generic_string() });
+  }
+  return clayerFiles;
+}
+
+bool ProjMgrWorker::HasUndefinedVariable(const string& clayer) {
+  static const regex variableRegex(".*\\$.*\\$.*");
+  return regex_match(clayer, variableRegex);
+}
+
+bool ProjMgrWorker::GetContextLayerFiles(const ContextItem& context, StrVec& clayerFiles) {
+  // same resolution as ParseContextLayers() but without messages
+  StrMap variables = context.variables;
+  MergeUserVariables(context, variables, false);
+  for (const auto& [clayer, clayerFile] : ResolveContextLayers(context, variables)) {
+    if (!clayerFile.empty()) {
+      clayerFiles.push_back(clayerFile);
+    } else if (!HasUndefinedVariable(clayer)) {
+      // ParseContextLayers() fails for this context
+      return false;
+    }
+  }
+  return true;
+}
+
+bool ProjMgrWorker::ParseContextLayers(ContextItem& context) {
+  // user defined variables
+  MergeUserVariables(context, context.variables, true);
+  // parse clayers
+  for (const auto& [clayer, clayerFile] : ResolveContextLayers(context, context.variables)) {
+    if (clayerFile.empty()) {
+      if (HasUndefinedVariable(clayer)) {
+        ProjMgrLogger::Warn(clayer, "variable was not defined for context '" + context.name +"'");
       } else {
-        if (!m_parser->ParseClayer(clayerFile, m_checkSchema)) {
-          return false;
-        }
-        context.clayers[clayerFile] = &m_parser->GetClayers().at(clayerFile);
+        ProjMgrLogger::Error(clayer, "clayer file was not found");
+        return false;
       }
+    } else {
+      if (!m_parser->ParseClayer(clayerFile, m_checkSchema)) {
+        return false;
+      }
+      context.clayers[clayerFile] = &m_parser->GetClayers().at(clayerFile);
     }
   }
   return true;
@@ -242,39 +273,21 @@ bool ProjMgrWorker::GetRequiredPdscFiles(ContextItem& context, const std::string
 
     if (packItem.path.empty()) {
       bool bPackFilter = (pack.name.empty() || WildCards::IsWildcardPattern(pack.name));
-      auto filteredPackItems = GetFilteredPacks(packItem, packRoot);
-      for (const auto& filteredPackItem : filteredPackItems) {
-        auto filteredPack = filteredPackItem.pack;
-        string packId, pdscFile, localPackId;
-
-        XmlItem attributes({
-          {"name",    filteredPack.name},
-          {"vendor",  filteredPack.vendor},
-          {"version", reqVersionRange},
-          });
-        // get installed and local pdsc that satisfy the version range requirements
-        pdscFile = m_kernel->GetInstalledPdscFile(attributes, packRoot, packId);
-        const string& localPdscFile = m_kernel->GetLocalPdscFile(attributes, packRoot, localPackId);
-        if (!localPdscFile.empty()) {
-          const size_t packIdLen = (filteredPack.vendor + '.' + filteredPack.name + '.').length();
-          if (pdscFile.empty() ? true : VersionCmp::Compare(localPackId.substr(packIdLen), packId.substr(packIdLen)) >= 0) {
-            // local pdsc takes precedence
-            pdscFile = localPdscFile;
-          }
-        }
-        if (pdscFile.empty()) {
-          if (!bPackFilter) {
-            std::string packageName =
-              (filteredPack.vendor.empty() ? "" : filteredPack.vendor + "::") +
-              filteredPack.name +
-              (reqVersion.empty() ? "" : "@" + reqVersion);
-            errMsgs.insert("required pack: " + packageName + " not installed");
-            context.missingPacks.push_back(filteredPack);
-          }
-          continue;
-        }
+      // identical requirements of all contexts are resolved once
+      const auto& resolved = ResolvePackRequirement(pack, reqVersionRange, packRoot);
+      for (const auto& pdscFile : resolved.pdscFiles) {
         context.pdscFiles.insert({ pdscFile, {"", reqVersionRange }});
       }
+      if (!bPackFilter) {
+        for (const auto& missingPack : resolved.missingPacks) {
+          std::string packageName =
+            (missingPack.vendor.empty() ? "" : missingPack.vendor + "::") +
+            missingPack.name +
+            (reqVersion.empty() ? "" : "@" + reqVersion);
+          errMsgs.insert("required pack: " + packageName + " not installed");
+          context.missingPacks.push_back(missingPack);
+        }
+      }
       if (bPackFilter && context.pdscFiles.empty()) {
         std::string filterStr = pack.vendor +
           (pack.name.empty() ? "" : "::" + pack.name) +
@@ -305,6 +318,91 @@ bool ProjMgrWorker::GetRequiredPdscFiles(ContextItem& context, const std::string
   return (0 == errMsgs.size());
 }
 
+void ProjMgrWorker::UpdatePackIndex(const string& packRoot) {
+  if (!m_packIndexRoot.empty() && (m_packIndexRoot == packRoot)) {
+    return;
+  }
+  m_packIndexRoot = packRoot;
+  m_packIndex = PackVersionIndex();
+  m_resolvedPackRequirements.clear();
+
+  // installed packs: <packRoot>/<vendor>/<name>/<version>/<vendor>.<name>.pdsc
+  error_code ec;
+  for (const auto& vendorEntry : fs::directory_iterator(packRoot, ec)) {
+    const string& vendor = vendorEntry.path().filename().generic_string();
+    if (!vendorEntry.is_directory(ec) || vendor.empty() || vendor[0] == '.') {
+      continue;
+    }
+    for (const auto& nameEntry : fs::directory_iterator(vendorEntry.path(), ec)) {
+      if (!nameEntry.is_directory(ec)) {
+        continue;
+      }
+      const string& name = nameEntry.path().filename().generic_string();
+      for (const auto& versionEntry : fs::directory_iterator(nameEntry.path(), ec)) {
+        if (!versionEntry.is_directory(ec)) {
+          continue;
+        }
+        const string& version = versionEntry.path().filename().generic_string();
+        const string& pdscFile = packRoot + '/' + vendor + '/' + name + '/' + version + '/' + vendor + '.' + name + ".pdsc";
+        if (RteFsUtils::Exists(pdscFile)) {
+          m_packIndex.installed[vendor][name][version] = pdscFile;
+        }
+      }
+    }
+  }
+
+  // local repository packs, each local pdsc is loaded once to get its version
+  map<string, string> localPdscFiles;
+  m_kernel->GetLocalPdscFiles(packRoot, localPdscFiles);
+  for (const auto& [packId, pdscFile] : localPdscFiles) {
+    m_packIndex.local[RtePackage::VendorFromId(packId)][RtePackage::NameFromId(packId)][RtePackage::VersionFromId(packId)] = pdscFile;
+  }
+}
+
+const PackVersionMap::value_type* ProjMgrWorker::FindPackVersion(const PackNameIndex& index,
+  const PackInfo& pack, const string& versionRange) {
+  const auto vendorIt = index.find(pack.vendor);
+  if (vendorIt == index.end()) {
+    return nullptr;
+  }
+  const auto nameIt = vendorIt->second.find(pack.name);
+  if (nameIt == vendorIt->second.end()) {
+    return nullptr;
+  }
+  // versions are sorted in descending order, the first one in range is the latest
+  for (const auto& version : nameIt->second) {
+    if (versionRange.empty() || VersionCmp::RangeCompare(version.first, versionRange) == 0) {
+      return &version;
+    }
+  }
+  return nullptr;
+}
+
+const ResolvedPackRequirement& ProjMgrWorker::ResolvePackRequirement(const PackInfo& pack, const string& reqVersionRange, const string& packRoot) {
+  UpdatePackIndex(packRoot);
+  const string& key = RtePackage::ComposePackageID(pack.vendor, pack.name, pack.version);
+  const auto it = m_resolvedPackRequirements.find(key);
+  if (it != m_resolvedPackRequirements.end()) {
+    return it->second;
+  }
+  ResolvedPackRequirement& resolved = m_resolvedPackRequirements[key];
+  for (const auto& filteredPackItem : GetFilteredPacks({ pack })) {
+    const auto& filteredPack = filteredPackItem.pack;
+    // get installed and local pdsc that satisfy the version range requirements
+    const auto installed = FindPackVersion(m_packIndex.installed, filteredPack, reqVersionRange);
+    const auto local = FindPackVersion(m_packIndex.local, filteredPack, reqVersionRange);
+    if (local && (!installed || VersionCmp::Compare(local->first, installed->first) >= 0)) {
+      // local pdsc takes precedence
+      resolved.pdscFiles.push_back(local->second);
+    } else if (installed) {
+      resolved.pdscFiles.push_back(installed->second);
+    } else {
+      resolved.missingPacks.push_back(filteredPack);
+    }
+  }
+  return resolved;
+}
+
 string ProjMgrWorker::GetPackRoot() {
   error_code ec;
   string packRoot;
@@ -334,6 +432,7 @@ bool ProjMgrWorker::InitializeModel() {
 }
 
 bool ProjMgrWorker::LoadAllRelevantPacks() {
+  RteTraceScope trace("projmgr", "LoadAllRelevantPacks");
   // Get required pdsc files
   std::list<std::string> pdscFiles;
   std::set<std::string> errMsgs;
@@ -417,7 +516,7 @@ bool ProjMgrWorker::LoadPacks(ContextItem& context) {
   return CheckRteErrors();
 }
 
-std::vector<PackageItem> ProjMgrWorker::GetFilteredPacks(const PackageItem& packItem, const string& rtePath) const
+std::vector<PackageItem> ProjMgrWorker::GetFilteredPacks(const PackageItem& packItem) const
 {
   std::vector<PackageItem> filteredPacks;
   auto& pack = packItem.pack;
@@ -425,14 +524,12 @@ std::vector<PackageItem> ProjMgrWorker::GetFilteredPacks(const PackageItem& pack
     filteredPacks.push_back({{ pack.name, pack.vendor, pack.version }});
   }
   else {
-    error_code ec;
-    string dirName, path;
-    path = rtePath + '/' + pack.vendor;
-    for (const auto& entry : fs::directory_iterator(path, ec)) {
-      if (entry.is_directory()) {
-        dirName = entry.path().filename().generic_string();
-        if (pack.name.empty() || WildCards::Match(pack.name, dirName)) {
-          filteredPacks.push_back({{ dirName, pack.vendor }});
+    // match installed pack names of the vendor
+    const auto vendorIt = m_packIndex.installed.find(pack.vendor);
+    if (vendorIt != m_packIndex.installed.end()) {
+      for (const auto& [name, _] : vendorIt->second) {
+        if (pack.name.empty() || WildCards::Match(pack.name, name)) {
+          filteredPacks.push_back({{ name, pack.vendor }});
         }
       }
     }
@@ -1183,7 +1280,7 @@ bool ProjMgrWorker::ProcessDevice(ContextItem& context) {
       }
     }
     for (const auto& item : matchedDevices) {
-      if ((!matchedDevice) || (VersionCmp::Compare(matchedDevice->GetPackage()->GetVersionString(), item->GetPackage()->GetVersionString()) < 0)) {
+      if ((!matchedDevice) || (matchedDevice->GetPackage()->GetSemVer().Compare(item->GetPackage()->GetSemVer()) < 0)) {
         matchedDevice = item;
       }
     }
@@ -1383,7 +1480,7 @@ bool ProjMgrWorker::ProcessComponents(ContextItem& context) {
   const RteComponentMap& installedComponents = context.rteActiveTarget->GetFilteredComponents();
   RteComponentMap componentMap;
   for (auto& component : installedComponents) {
-    const string& componentId = component.second->GetComponentID(true);
+    const string& componentId = component.second->GetCachedComponentID(true);
     componentMap[componentId] = component.second;
   }
 
@@ -1400,7 +1497,7 @@ bool ProjMgrWorker::ProcessComponents(ContextItem& context) {
 
     UpdateMisc(item.build.misc, context.toolchain.name);
 
-    const auto& componentId = matchedComponent->GetComponentID(true);
+    const auto& componentId = matchedComponent->GetCachedComponentID(true);
     // Init matched component instance
     RteComponentInstance* matchedComponentInstance = new RteComponentInstance(matchedComponent);
     matchedComponentInstance->InitInstance(matchedComponent);
@@ -1702,8 +1799,7 @@ bool ProjMgrWorker::ProcessComponentFiles(ContextItem& context) {
       const auto& component = ci->GetResolvedComponent(context.rteActiveTarget->GetName());
       if (!fileInfo.m_fi) {
         const auto& absPackPath = component->GetPackage()->GetAbsolutePackagePath();
-        error_code ec;
-        const auto& relFilename = fs::relative(file, absPackPath, ec).generic_string();
+        const auto& relFilename = RteFsUtils::RelativePath(file, absPackPath);
         const auto& componentFile = context.rteActiveTarget->GetFile(relFilename, component);
         if (componentFile) {
           const auto& attr = componentFile->GetAttribute("attr");
@@ -3067,7 +3163,7 @@ bool ProjMgrWorker::ListComponents(vector<string>& components, const string& fil
       return false;
     }
     for (auto& component : installedComponents) {
-      const string& componentId = component.second->GetComponentID(true);
+      const string& componentId = component.second->GetCachedComponentID(true);
       componentIds.insert(componentId);
       componentMap[componentId] = component.second;
     }
@@ -3555,6 +3651,15 @@ bool ProjMgrWorker::ParseContextSelection(const vector<string>& contextSelection
   }
 
   if (!((m_selectedContexts.size() == 1) && (m_selectedContexts.front() == RteUtils::EMPTY_STRING))) {
+    // parse the layer files of the selected contexts concurrently up to the first context
+    // failing to resolve its layers, ParseContextLayers() takes over results and messages
+    StrVec clayerFiles;
+    for (const auto& context : m_selectedContexts) {
+      if (!GetContextLayerFiles(m_contexts[context], clayerFiles)) {
+        break;
+      }
+    }
+    m_parser->PreParseClayers(clayerFiles, m_checkSchema);
     for (const auto& context : m_selectedContexts) {
       if (!ParseContextLayers(m_contexts[context])) {
         return false;
@@ -11,7 +11,10 @@
 #include "ProjMgrUtils.h"
 #include "RteFsUtils.h"
 #include "RteItem.h"
+#include "RteUtils.h"
 
+#include <algorithm>
+#include <exception>
 #include <filesystem>
 #include <fstream>
 
@@ -33,10 +36,13 @@ protected:
   void SetNodeValue(YAML::Node node, const string& value);
   void SetNodeValue(YAML::Node node, const vector<string>& vec);
   const string FormatPath(const string& original, const string& directory);
-  bool CompareFile(const string& filename, const YAML::Node& rootNode);
-  bool CompareNodes(const YAML::Node& lhs, const YAML::Node& rhs);
+  static string EmitContent(YAML::Node& rootNode);
+  static string NormalizeContent(const string& content);
+  static bool WriteContent(const string& content, const std::string& filename);
   bool WriteFile(YAML::Node& rootNode, const std::string& filename);
   const bool m_useAbsolutePaths;
+  string m_packRoot;
+  string m_compilerRoot;
 };
 
 class ProjMgrYamlCbuild : public ProjMgrYamlBase {
@@ -72,6 +78,11 @@ private:
 };
 
 ProjMgrYamlBase::ProjMgrYamlBase(bool useAbsolutePaths) : m_useAbsolutePaths(useAbsolutePaths) {
+  // root prefixes are resolved once per emitted file
+  if (!m_useAbsolutePaths) {
+    m_packRoot = ProjMgrKernel::Get()->GetCmsisPackRoot();
+    ProjMgrUtils::GetCompilerRoot(m_compilerRoot);
+  }
 }
 
 ProjMgrYamlCbuildIdx::ProjMgrYamlCbuildIdx(YAML::Node node, const vector<ContextItem*> processedContexts, ProjMgrParser& parser, const string& directory) :
@@ -526,86 +537,68 @@ void ProjMgrYamlCbuild::SetDefineNode(YAML::Node define, const vector<string>& v
 }
 
 const string ProjMgrYamlBase::FormatPath(const string& original, const string& directory) {
-  string packRoot = ProjMgrKernel::Get()->GetCmsisPackRoot();
   string path = original;
   RteFsUtils::NormalizePath(path);
-  error_code ec;
-  path = fs::weakly_canonical(fs::path(path), ec).generic_string();
+  path = RteFsUtils::WeaklyCanonical(path);
   if (!m_useAbsolutePaths) {
-    size_t index = path.find(packRoot);
+    size_t index = path.find(m_packRoot);
     if (index != string::npos) {
-      path.replace(index, packRoot.length(), "${CMSIS_PACK_ROOT}");
+      path.replace(index, m_packRoot.length(), "${CMSIS_PACK_ROOT}");
     } else {
-      string compilerRoot;
-      ProjMgrUtils::GetCompilerRoot(compilerRoot);
-      index = path.find(compilerRoot);
-      if (!compilerRoot.empty() && index != string::npos) {
-        path.replace(index, compilerRoot.length(), "${CMSIS_COMPILER_ROOT}");
+      index = path.find(m_compilerRoot);
+      if (!m_compilerRoot.empty() && index != string::npos) {
+        path.replace(index, m_compilerRoot.length(), "${CMSIS_COMPILER_ROOT}");
       } else {
-        path = fs::relative(path, directory, ec).generic_string();
+        path = RteFsUtils::RelativePath(path, directory);
       }
     }
   }
   return path;
 }
 
-bool ProjMgrYamlBase::CompareFile(const string& filename, const YAML::Node& rootNode) {
-  if (!RteFsUtils::Exists(filename)) {
-    return false;
+string ProjMgrYamlBase::NormalizeContent(const string& content) {
+  // the generated-by node and line endings are not compared
+  string data = content;
+  size_t startIndex = data.find(YAML_GENERATED_BY, 0);
+  size_t endIndex = data.find('\n', startIndex);
+  if (startIndex != string::npos && endIndex != string::npos) {
+    data.erase(startIndex, endIndex - startIndex);
   }
-  const YAML::Node& yamlRoot = YAML::LoadFile(filename);
-  return CompareNodes(yamlRoot, rootNode);
+  data.erase(remove(data.begin(), data.end(), '\r'), data.end());
+  return data;
 }
 
-bool ProjMgrYamlBase::CompareNodes(const YAML::Node& lhs, const YAML::Node& rhs) {
-  auto eraseGenNode = [](const string& inStr) {
-    size_t startIndex, endIndex;
-    string outStr = inStr;
-    startIndex = outStr.find(YAML_GENERATED_BY, 0);
-    endIndex = outStr.find('\n', startIndex);
-    if (startIndex != std::string::npos && endIndex != std::string::npos) {
-      outStr = outStr.erase(startIndex, endIndex - startIndex);
-    }
-    return outStr;
-  };
-
-  YAML::Emitter lhsEmitter, rhsEmitter;
-  string lhsData, rhsData;
-
-  // convert nodes into string
-  lhsEmitter << lhs;
-  rhsEmitter << rhs;
-
-  // remove generated-by node from the string
-  lhsData = eraseGenNode(lhsEmitter.c_str());
-  rhsData = eraseGenNode(rhsEmitter.c_str());
-
-  return (lhsData == rhsData) ? true : false;
+string ProjMgrYamlBase::EmitContent(YAML::Node& rootNode) {
+  YAML::Emitter emitter;
+  emitter << rootNode;
+  return string(emitter.c_str()) + "\n";
 }
 
 bool ProjMgrYamlBase::WriteFile(YAML::Node& rootNode, const std::string& filename) {
-  // Compare yaml contents
-  if (!CompareFile(filename, rootNode)) {
-    if (!RteFsUtils::MakeSureFilePath(filename)) {
-      ProjMgrLogger::Error(filename, "destination directory can not be created");
-      return false;
-    }
-    ofstream fileStream(filename);
-    if (!fileStream) {
-      ProjMgrLogger::Error(filename, "file cannot be written");
-      return false;
-    }
-    YAML::Emitter emitter;
-    emitter << rootNode;
-    fileStream << emitter.c_str();
-    fileStream << endl;
-    fileStream << flush;
-    fileStream.close();
-    ProjMgrLogger::Info(filename, "file generated successfully");
-  }
-  else {
+  // emit yaml contents once, the text is compared and written
+  return WriteContent(EmitContent(rootNode), filename);
+}
+
+bool ProjMgrYamlBase::WriteContent(const string& content, const std::string& filename) {
+  // Compare yaml contents with the existing file
+  string existing;
+  if (RteFsUtils::ReadFile(filename, existing) && (NormalizeContent(existing) == NormalizeContent(content))) {
     ProjMgrLogger::Info(filename, "file is already up-to-date");
+    return true;
+  }
+  if (!RteFsUtils::MakeSureFilePath(filename)) {
+    ProjMgrLogger::Error(filename, "destination directory can not be created");
+    return false;
+  }
+  ofstream fileStream(filename);
+  if (!fileStream) {
+    ProjMgrLogger::Error(filename, "file cannot be written");
+    return false;
   }
+  fileStream << content;
+  fileStream << flush;
+  fileStream.close();
+  ProjMgrLogger::Info(filename, "file generated successfully");
   return true;
 }
 
@@ -620,17 +613,16 @@ bool ProjMgrYamlEmitter::GenerateCbuildIndex(ProjMgrParser& parser, const vector
   return cbuild.WriteFile(rootNode, filename);
 }
 
-bool ProjMgrYamlEmitter::GenerateCbuild(ContextItem* context, const RteGenerator* generator) {
-  // generate cbuild.yml for each context
-
+static string GetGeneratorInputFilename(const ContextItem* context) {
   // intdir is relative to cprjdir, which in turn is absolute
   string genInputFileDir = context->directories.intdir;
   RteFsUtils::NormalizePath(genInputFileDir, context->directories.cprj);
-  const string generatorInputFilename = genInputFileDir + "/" + context->name + ".cbuild-gen.yml";
-  const string filename = generator ? generatorInputFilename : context->directories.cprj + "/" + context->name + ".cbuild.yml";
+  return genInputFileDir + "/" + context->name + ".cbuild-gen.yml";
+}
 
-  // Make sure $G (generator input file) is up to date
-  context->rteActiveTarget->SetGeneratorInputFile(generatorInputFilename);
+bool ProjMgrYamlEmitter::WriteCbuild(ContextItem* context, const RteGenerator* generator) {
+  const string filename = generator ? GetGeneratorInputFilename(context) :
+    context->directories.cprj + "/" + context->name + ".cbuild.yml";
 
   YAML::Node rootNode;
   ProjMgrYamlCbuild cbuild(rootNode[YAML_BUILD], context, generator);
@@ -638,6 +630,62 @@ bool ProjMgrYamlEmitter::GenerateCbuild(ContextItem* context, const RteGenerator
   return cbuild.WriteFile(rootNode, filename);
 }
 
+bool ProjMgrYamlEmitter::GenerateCbuild(ContextItem* context, const RteGenerator* generator) {
+  // generate cbuild.yml for each context
+
+  // Make sure $G (generator input file) is up to date
+  context->rteActiveTarget->SetGeneratorInputFile(GetGeneratorInputFilename(context));
+
+  return WriteCbuild(context, generator);
+}
+
+/**
+ * Each cbuild.yml depends only on its own context, the contents are emitted by worker threads.
+ * Generator arguments are expanded with the context's own target (see RteGenerator::GetExpandedArguments()),
+ * therefore all generator input files are set before the threads start and the targets are only read
+ * during emission. Messages are collected per context, afterwards the files are written in context order
+ * and like sequential generation the writing stops at the first failing context.
+*/
+bool ProjMgrYamlEmitter::GenerateCbuilds(const vector<ContextItem*>& contexts) {
+  for (auto& context : contexts) {
+    // Make sure $G (generator input file) is up to date
+    context->rteActiveTarget->SetGeneratorInputFile(GetGeneratorInputFilename(context));
+  }
+
+  struct Result {
+    ProjMgrLogger::MessageBuffer messages;
+    string content;
+    exception_ptr exception;
+  };
+  vector<Result> results(contexts.size());
+  RteUtils::RunConcurrently(contexts.size(), [&](size_t i) {
+    auto& result = results[i];
+    const auto prevBuffer = ProjMgrLogger::SetThreadMessageBuffer(&result.messages);
+    try {
+      YAML::Node rootNode;
+      ProjMgrYamlCbuild cbuild(rootNode[YAML_BUILD], contexts[i], nullptr);
+      result.content = ProjMgrYamlBase::EmitContent(rootNode);
+    }
+    catch (...) {
+      result.exception = current_exception();
+    }
+    ProjMgrLogger::SetThreadMessageBuffer(prevBuffer);
+  });
+
+  for (size_t i = 0; i < contexts.size(); i++) {
+    auto& result = results[i];
+    ProjMgrLogger::PrintMessageBuffer(result.messages);
+    if (result.exception) {
+      rethrow_exception(result.exception);
+    }
+    const string filename = contexts[i]->directories.cprj + "/" + contexts[i]->name + ".cbuild.yml";
+    if (!ProjMgrYamlBase::WriteContent(result.content, filename)) {
+      return false;
+    }
+  }
+  return true;
+}
+
 bool ProjMgrYamlEmitter::GenerateCbuildSet(ProjMgrParser& parser,
   const std::vector<ContextItem*> contexts, const string& selectedCompiler)
 {
@@ -647,23 +695,5 @@ bool ProjMgrYamlEmitter::GenerateCbuildSet(ProjMgrParser& parser,
   YAML::Node rootNode;
   ProjMgrYamlCbuild cbuild(rootNode[YAML_CBUILD_SET], contexts, selectedCompiler);
 
-  // Compare yaml contents
-  if (!cbuild.CompareFile(filename, rootNode)) {
-    ofstream fileStream(filename);
-    if (!fileStream) {
-      ProjMgrLogger::Error(filename, "file cannot be written");
-      return false;
-    }
-    YAML::Emitter emitter;
-    emitter << rootNode;
-    fileStream << emitter.c_str();
-    fileStream << endl;
-    fileStream << flush;
-    fileStream.close();
-    ProjMgrLogger::Info(filename, "file generated successfully");
-  }
-  else {
-    ProjMgrLogger::Info(filename, "file is already up-to-date");
-  }
-  return true;
+  return cbuild.WriteFile(rootNode, filename);
 }
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2020-2021 Arm Limited. All rights reserved.
+ * Copyright (c) 2020-2023 Arm Limited. All rights reserved.
  *
  * SPDX-License-Identifier: Apache-2.0
  */
@@ -7,7 +7,6 @@
 #include "ProjMgrYamlParser.h"
 #include "ProjMgrLogger.h"
 #include "ProjMgrUtils.h"
-#include "ProjMgrYamlSchemaChecker.h"
 
 #include "RteFsUtils.h"
 #include <regex>
@@ -26,16 +25,14 @@ ProjMgrYamlParser::~ProjMgrYamlParser(void) {
 bool ProjMgrYamlParser::ParseCdefault(const string& input,
   CdefaultItem& cdefault, bool checkSchema) {
   try {
-    // Validate file schema
-    if (checkSchema &&
-      !ProjMgrYamlSchemaChecker().Validate(
-        input, ProjMgrYamlSchemaChecker::FileType::DEFAULT)) {
+    // Load file and validate schema
+    YAML::Node root;
+    if (!LoadFile(input, root, checkSchema, ProjMgrYamlSchemaChecker::FileType::DEFAULT)) {
       return false;
     }
 
     cdefault.path = RteFsUtils::MakePathCanonical(input);
 
-    const YAML::Node& root = YAML::LoadFile(input);
     if (!ValidateCdefault(input, root)) {
       return false;
     }
@@ -54,10 +51,9 @@ bool ProjMgrYamlParser::ParseCdefault(const string& input,
 bool ProjMgrYamlParser::ParseCsolution(const string& input,
   CsolutionItem& csolution, bool checkSchema) {
   try {
-    // Validate file schema
-    if (checkSchema &&
-      !ProjMgrYamlSchemaChecker().Validate(
-        input, ProjMgrYamlSchemaChecker::FileType::SOLUTION)) {
+    // Load file and validate schema
+    YAML::Node root;
+    if (!LoadFile(input, root, checkSchema, ProjMgrYamlSchemaChecker::FileType::SOLUTION)) {
       return false;
     }
 
@@ -65,7 +61,6 @@ bool ProjMgrYamlParser::ParseCsolution(const string& input,
     csolution.directory = RteFsUtils::ParentPath(csolution.path);
     csolution.name = fs::path(input).stem().stem().generic_string();
 
-    const YAML::Node& root = YAML::LoadFile(input);
     if (!ValidateCsolution(input, root)) {
       return false;
     }
@@ -107,14 +102,11 @@ bool ProjMgrYamlParser::ParseCproject(const string& input,
   bool single, bool checkSchema) {
   CprojectItem cproject;
   try {
-    // Validate file schema
-    if (checkSchema &&
-      !ProjMgrYamlSchemaChecker().Validate(
-        input, ProjMgrYamlSchemaChecker::FileType::PROJECT)) {
+    // Load file and validate schema
+    YAML::Node root;
+    if (!LoadFile(input, root, checkSchema, ProjMgrYamlSchemaChecker::FileType::PROJECT)) {
       return false;
     }
-
-    const YAML::Node& root = YAML::LoadFile(input);
     if (!ValidateCproject(input, root)) {
       return false;
     }
@@ -174,14 +166,11 @@ bool ProjMgrYamlParser::ParseClayer(const string& input,
   }
   ClayerItem clayer;
   try {
-    // Validate file schema
-    if (checkSchema &&
-      !ProjMgrYamlSchemaChecker().Validate(
-        input, ProjMgrYamlSchemaChecker::FileType::LAYER)) {
+    // Load file and validate schema
+    YAML::Node root;
+    if (!LoadFile(input, root, checkSchema, ProjMgrYamlSchemaChecker::FileType::LAYER)) {
       return false;
     }
-
-    const YAML::Node& root = YAML::LoadFile(input);
     if (!ValidateClayer(input, root)) {
       return false;
     }
@@ -226,14 +215,12 @@ bool ProjMgrYamlParser::ParseClayer(const string& input,
 }
 
 bool ProjMgrYamlParser::ParseCbuildSet(const string& input, CbuildSetItem& cbuildSet) {
-  // Validate file schema
-  if (!ProjMgrYamlSchemaChecker().Validate(
-    input, ProjMgrYamlSchemaChecker::FileType::BUILDSET)) {
-    return false;
-  }
-
   try {
-    const YAML::Node& root = YAML::LoadFile(input);
+    // Load file and validate schema
+    YAML::Node root;
+    if (!LoadFile(input, root, true, ProjMgrYamlSchemaChecker::FileType::BUILDSET)) {
+      return false;
+    }
     if (!ValidateCbuildSet(input, root)) {
       return false;
     }
@@ -250,6 +237,17 @@ bool ProjMgrYamlParser::ParseCbuildSet(const string& input, CbuildSetItem& cbuil
   return true;
 }
 
+bool ProjMgrYamlParser::LoadFile(const string& input, YAML::Node& root,
+  bool checkSchema, ProjMgrYamlSchemaChecker::FileType type) {
+  if (!checkSchema) {
+    root = YAML::LoadFile(input);
+    return true;
+  }
+  // the loaded data is validated as it is, the file is parsed only once
+  ProjMgrYamlSchemaChecker schemaChecker;
+  return schemaChecker.Load(input, root) && schemaChecker.Validate(root, input, type);
+}
+
 // EnsurePortability checks the presence of backslash, case inconsistency and absolute path
 // It clears the string 'value' when it is an absolute path
 void ProjMgrYamlParser::EnsurePortability(const string& file, const YAML::Mark& mark, const string& key, string& value, bool checkExist) {
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2020-2022 Arm Limited. All rights reserved.
+ * Copyright (c) 2020-2023 Arm Limited. All rights reserved.
  *
  * SPDX-License-Identifier: Apache-2.0
  */
@@ -25,12 +25,13 @@ ProjMgrYamlSchemaChecker::~ProjMgrYamlSchemaChecker(void) {
 bool ProjMgrYamlSchemaChecker::Validate(const string& input,
   ProjMgrYamlSchemaChecker::FileType type)
 {
-  // Check if the input file exist
-  if (!RteFsUtils::Exists(input)) {
-    ProjMgrLogger::Error(input, " file doesn't exist");
-    return false;
-  }
+  YAML::Node root;
+  return Load(input, root) && Validate(root, input, type);
+}
 
+bool ProjMgrYamlSchemaChecker::Validate(const YAML::Node& root, const string& input,
+  ProjMgrYamlSchemaChecker::FileType type)
+{
   // Get schema file path
   string schemaFile;
   if(!GetSchemaFile(schemaFile, type)) {
@@ -40,7 +41,7 @@ bool ProjMgrYamlSchemaChecker::Validate(const string& input,
 
   m_errList.clear();
   // Validate schema
-  bool result = SchemaChecker::Validate(input, schemaFile, m_errList);
+  bool result = SchemaChecker::Validate(root, input, schemaFile, m_errList);
   for (auto err : m_errList) {
     ProjMgrLogger::Error(err.m_file, err.m_line, err.m_col, err.m_msg);
   }
@@ -48,6 +49,26 @@ bool ProjMgrYamlSchemaChecker::Validate(const string& input,
   return result;
 }
 
+bool ProjMgrYamlSchemaChecker::Load(const string& input, YAML::Node& root)
+{
+  // Check if the input file exist
+  if (!RteFsUtils::Exists(input)) {
+    ProjMgrLogger::Error(input, " file doesn't exist");
+    return false;
+  }
+
+  m_errList.clear();
+  try {
+    root = YAML::LoadFile(input);
+  }
+  catch (YAML::Exception& e) {
+    m_errList.push_back(SchemaError(input, "schema check failed, verify syntax", e.mark.line + 1, e.mark.column + 1));
+    ProjMgrLogger::Error(input, e.mark.line + 1, e.mark.column + 1, m_errList.back().m_msg);
+    return false;
+  }
+  return true;
+}
+
 SchemaErrors& ProjMgrYamlSchemaChecker::GetErrors() {
   return m_errList;
 }
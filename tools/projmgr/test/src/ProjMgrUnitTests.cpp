@@ -1695,6 +1695,46 @@ TEST_F(ProjMgrUnitTests, AddContextFailed) {
   EXPECT_FALSE(m_worker.AddContexts(m_parser, descriptor, filenameInput));
 }
 
+TEST_F(ProjMgrUnitTests, ParseCprojects_PreParseClayers) {
+  StdStreamRedirect streamRedirect;
+  error_code ec;
+  const string& dirInput = testinput_folder + "/TestSolution/";
+  const StrVec cprojectFiles = {
+    fs::canonical(dirInput + "TestProject2/test2.cproject.yml", ec).generic_string(),
+    fs::canonical(dirInput + "TestProject1/test1.cproject.yml", ec).generic_string(),
+  };
+  EXPECT_TRUE(m_parser.ParseCprojects(cprojectFiles, false));
+  ASSERT_EQ(2, m_parser.GetCprojects().size());
+  EXPECT_EQ("test1", m_parser.GetCprojects().at(cprojectFiles[1]).name);
+  EXPECT_EQ("test2", m_parser.GetCprojects().at(cprojectFiles[0]).name);
+
+  // messages are printed in input order
+  const string& errStr = streamRedirect.GetErrorString();
+  EXPECT_LT(errStr.find("test2.cproject.yml"), errStr.find("test1.cproject.yml"));
+
+  // layer files parsed in advance are taken over by ParseClayer() along with their messages
+  const string& layersDir = testinput_folder + "/TestLayers/";
+  const StrVec clayerFiles = {
+    fs::canonical(layersDir + "config.clayer.yml", ec).generic_string(),
+    fs::canonical(layersDir + "config.clayer.yml", ec).generic_string(),
+    layersDir + "unknown.clayer.yml",
+    fs::canonical(layersDir + "packs.clayer.yml", ec).generic_string(),
+  };
+  streamRedirect.ClearStringStreams();
+  m_parser.PreParseClayers(clayerFiles, false);
+  EXPECT_TRUE(m_parser.GetClayers().empty());
+  EXPECT_TRUE(streamRedirect.GetErrorString().empty());
+
+  EXPECT_TRUE(m_parser.ParseClayer(clayerFiles[0], false));
+  EXPECT_TRUE(streamRedirect.GetErrorString().find("unknown.clayer.yml") == string::npos);
+  EXPECT_FALSE(m_parser.ParseClayer(clayerFiles[2], false));
+  EXPECT_TRUE(streamRedirect.GetErrorString().find("unknown.clayer.yml") != string::npos);
+  EXPECT_TRUE(m_parser.ParseClayer(clayerFiles[3], false));
+  ASSERT_EQ(2, m_parser.GetClayers().size());
+  EXPECT_EQ("config", m_parser.GetClayers().at(clayerFiles[0]).name);
+  EXPECT_EQ("packs", m_parser.GetClayers().at(clayerFiles[3]).name);
+}
+
 TEST_F(ProjMgrUnitTests, GetInstalledPacks) {
   EXPECT_TRUE(m_worker.InitializeModel());
   auto kernel = ProjMgrKernel::Get();
@@ -2316,6 +2356,34 @@ TEST_F(ProjMgrUnitTests, RunProjMgr_MultipleGeneratedComponents) {
     testinput_folder + "/TestGenerator/ref/multiple-components.Debug+CM0.cprj");
 }
 
+TEST_F(ProjMgrUnitTests, RunProjMgr_GeneratorArgumentsMultipleContexts) {
+  char* argv[6];
+  // convert -s solution.yml, cbuild files of all contexts are generated at once
+  const string& csolution = testinput_folder + "/TestGenerator/test-gpdsc-multiple-types.csolution.yml";
+  argv[1] = (char*)"convert";
+  argv[2] = (char*)"-s";
+  argv[3] = (char*)csolution.c_str();
+  argv[4] = (char*)"-o";
+  argv[5] = (char*)testoutput_folder.c_str();
+  EXPECT_EQ(0, RunProjMgr(6, argv, 0));
+
+  // Check generator arguments are expanded for each context's own target
+  for (const string& buildType : { "Debug", "Release" }) {
+    const string& context = "test-gpdsc." + buildType + "+CM0";
+    const YAML::Node& cbuild = YAML::LoadFile(testoutput_folder + "/" + context + ".cbuild.yml");
+    const YAML::Node& generator = cbuild["build"]["generators"][0];
+    ASSERT_TRUE(generator.IsDefined());
+    EXPECT_EQ("RteTestGeneratorIdentifier", generator["generator"].as<string>());
+    for (const string& host : { "win", "linux", "mac" }) {
+      const YAML::Node& args = generator["command"][host]["arguments"];
+      ASSERT_EQ(5U, args.size());
+      EXPECT_EQ("RteTestGen_ARMCM0", args[0].as<string>());
+      EXPECT_NE(string::npos, args[1].as<string>().find("/" + context + ".cprj")) << args[1].as<string>();
+      EXPECT_NE(string::npos, args[3].as<string>().find("/CM0/" + buildType + "/" + context + ".cbuild-gen.yml")) << args[3].as<string>();
+    }
+  }
+}
+
 TEST_F(ProjMgrUnitTests, ExecuteGenerator) {
   m_csolutionFile = testinput_folder + "/TestGenerator/test-gpdsc.csolution.yml";
   error_code ec;
@@ -3981,3 +4049,42 @@ TEST_F(ProjMgrUnitTests, RunProjMgrSolution_cbuildset_file) {
   EXPECT_TRUE(RteFsUtils::Exists(outputDir + "/test2.Debug+CM3.cbuild.yml"));
   EXPECT_TRUE(RteFsUtils::Exists(outputDir + "/test1.Release+CM0.cbuild.yml"));
 }
+
+TEST_F(ProjMgrUnitTests, RunProjMgr_Trace) {
+  char* argv[8];
+  const string& csolution = testinput_folder + "/TestSolution/test.csolution.yml";
+  const string& outputDir = testoutput_folder + "/trace";
+  const string& traceFile = outputDir + "/test.trace.json";
+  RteFsUtils::RemoveDir(outputDir);
+  ASSERT_TRUE(RteFsUtils::CreateDirectories(outputDir));
+
+  // convert --solution solution.yml -o <dir> --trace <file>
+  argv[1] = (char*)"convert";
+  argv[2] = (char*)"--solution";
+  argv[3] = (char*)csolution.c_str();
+  argv[4] = (char*)"-o";
+  argv[5] = (char*)outputDir.c_str();
+  argv[6] = (char*)"--trace";
+  argv[7] = (char*)traceFile.c_str();
+  EXPECT_EQ(0, RunProjMgr(8, argv, 0));
+  ASSERT_TRUE(RteFsUtils::Exists(traceFile));
+
+  // Chrome trace event format is JSON, a subset of YAML
+  const YAML::Node& trace = YAML::LoadFile(traceFile);
+  ASSERT_TRUE(trace["traceEvents"].IsSequence());
+  set<string> names;
+  for (const auto& event : trace["traceEvents"]) {
+    EXPECT_EQ("X", event["ph"].as<string>());
+    EXPECT_GE(event["dur"].as<int64_t>(), 0);
+    names.insert(event["name"].as<string>());
+  }
+  for (const auto& name : { "PopulateContexts", "test1.Debug+CM0", "test1.Release+CM0",
+    "test2.Debug+CM0", "test2.Debug+CM3", "GenerateCbuilds" }) {
+    EXPECT_NE(names.end(), names.find(name)) << name;
+  }
+
+  // without option no trace is written
+  RteFsUtils::RemoveFile(traceFile);
+  EXPECT_EQ(0, RunProjMgr(6, argv, 0));
+  EXPECT_FALSE(RteFsUtils::Exists(traceFile));
+}
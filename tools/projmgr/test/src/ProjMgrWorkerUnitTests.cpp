@@ -1562,3 +1562,31 @@ TEST_F(ProjMgrWorkerUnitTests, GetGeneratorDirDefault) {
   EXPECT_TRUE(GetGeneratorDir(generator, context, "", genDir));
   EXPECT_EQ(genDir, "generated/RteTestGeneratorIdentifier");
 };
+
+TEST_F(ProjMgrWorkerUnitTests, ResolvePackRequirement_InstalledPacks) {
+  const string packRoot = testoutput_folder + "/pack-index";
+  RteFsUtils::RemoveDir(packRoot);
+  ASSERT_TRUE(RteFsUtils::CreateFile(packRoot + "/ARM/RteTest_DFP/0.1.0/ARM.RteTest_DFP.pdsc", ""));
+  ASSERT_TRUE(RteFsUtils::CreateFile(packRoot + "/ARM/RteTest_DFP/0.2.0/ARM.RteTest_DFP.pdsc", ""));
+  // incomplete installation without pdsc file
+  ASSERT_TRUE(RteFsUtils::CreateDirectories(packRoot + "/ARM/RteTest_DFP/0.3.0"));
+  ASSERT_TRUE(RteFsUtils::CreateDirectories(packRoot + "/ARM/RteTest_Empty/1.0.0"));
+  ASSERT_TRUE(InitializeModel());
+
+  // vendor and name are matched case-insensitively
+  const auto& resolved = ResolvePackRequirement({ "rtetest_dfp", "arm" }, "", packRoot);
+  ASSERT_EQ(1, resolved.pdscFiles.size());
+  EXPECT_EQ(packRoot + "/ARM/RteTest_DFP/0.2.0/ARM.RteTest_DFP.pdsc", resolved.pdscFiles.front());
+  EXPECT_TRUE(resolved.missingPacks.empty());
+
+  const auto& wildcard = ResolvePackRequirement({ "RteTest*", "ARM" }, "", packRoot);
+  ASSERT_EQ(1, wildcard.pdscFiles.size());
+  EXPECT_EQ(packRoot + "/ARM/RteTest_DFP/0.2.0/ARM.RteTest_DFP.pdsc", wildcard.pdscFiles.front());
+
+  const auto& missing = ResolvePackRequirement({ "RteTest_Empty", "ARM" }, "", packRoot);
+  EXPECT_TRUE(missing.pdscFiles.empty());
+  ASSERT_EQ(1, missing.missingPacks.size());
+  EXPECT_EQ("RteTest_Empty", missing.missingPacks.front().name);
+
+  RteFsUtils::RemoveDir(packRoot);
+}
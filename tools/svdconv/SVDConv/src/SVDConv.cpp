@@ -9,6 +9,7 @@
 #include "ErrLog.h"
 #include "ErrOutputterSaveToStdoutOrFile.h"
 #include "SvdModel.h"
+#include "SvdModelBuilder.h"
 #include "SvdDevice.h"
 #include "SvdGenerator.h"
 #include "RteFsUtils.h"
@@ -193,7 +194,6 @@ SVD_ERR SvdConv::CheckSvdFile()
   uint32_t tAll = CrossPlatformUtils::ClockInMsec();
 
   SVD_ERR svdRes = SVD_ERR_SUCCESS;
-  XMLTreeSlim* xmlTree;
   const string& path = m_svdOptions.GetSvdFullpath();
 
   const string version = VERSION_STRING;
@@ -207,55 +207,41 @@ SVD_ERR SvdConv::CheckSvdFile()
     return svdRes;
   }
 
-  xmlTree = new XMLTreeSlim();
-  xmlTree->AddFileName(path);
-
-  // ----------------------  Read XML  ----------------------
-  uint32_t t1 = CrossPlatformUtils::ClockInMsec();
-	bool success = xmlTree->ParseAll();
-  uint32_t t2 = CrossPlatformUtils::ClockInMsec() - t1;
-
-  if(success) { LogMsg("M040", NAME("Reading SVD File"), TIME(t2)); }
-	else        { LogMsg("M111", NAME("Reading SVD File"));           }
-
-  // ----------------------  Construct Model  ----------------------
+  string logFileName = path;
   if (m_svdOptions.IsUnderTest()) {
     string inFile = m_svdOptions.GetSvdFileName();
     try {
       const fs::path inPath = inFile;
       const auto inFilename = inPath.filename();
-      const auto fnString = inFilename.string();
-     ErrLog::Get()->SetFileName(fnString);
+      logFileName = inFilename.string();
     }
     catch (const fs::filesystem_error&) {
-     ErrLog::Get()->SetFileName(inFile);
+      logFileName = inFile;
     }
   }
   else if (m_svdOptions.IsSuppressPath()) {
-    string inFile = m_svdOptions.GetSvdFileName();
-   ErrLog::Get()->SetFileName(inFile);
-  }
-  else {
-   ErrLog::Get()->SetFileName(path);
+    logFileName = m_svdOptions.GetSvdFileName();
   }
 
-  t1 = CrossPlatformUtils::ClockInMsec();
+  // ----------------------  Read XML and Construct Model  ----------------------
+  // the model is built from the reader events, no intermediate XML tree is created
   m_svdModel = new SvdModel(0);
   m_svdModel->SetInputFileName(path);
   m_svdModel->SetShowMissingEnums();
-  success = m_svdModel->Construct(xmlTree);
-  t2 = CrossPlatformUtils::ClockInMsec() - t1;
 
-  if(success) { LogMsg("M040", NAME("Constructing Model"), TIME(t2)); }
-	else        { LogMsg("M111", NAME("Constructing Model"));           }
+  SvdModelBuilder modelBuilder(m_svdModel);
+  modelBuilder.SetLogFileName(logFileName);
+  XMLTreeSlim xmlTree(&modelBuilder);
+  xmlTree.AddFileName(path);
 
-  // ----------------------  Delete XML Tree  ----------------------
-  t1 = CrossPlatformUtils::ClockInMsec();
-  delete xmlTree;
-  t2 = CrossPlatformUtils::ClockInMsec() - t1;
+  uint32_t t1 = CrossPlatformUtils::ClockInMsec();
+  bool success = xmlTree.ParseAll() && modelBuilder.IsSuccess();
+  uint32_t t2 = CrossPlatformUtils::ClockInMsec() - t1;
+
+  ErrLog::Get()->SetFileName(logFileName);    // reset by the XML reader
 
-  if(success) { LogMsg("M040", NAME("Deleting XML Tree"), TIME(t2));  }
-	else        { LogMsg("M111", NAME("Deleting XML Tree"));            }
+  if(success) { LogMsg("M040", NAME("Reading SVD File and Constructing Model"), TIME(t2)); }
+	else        { LogMsg("M111", NAME("Reading SVD File and Constructing Model"));           }
 
   // ----------------------  Calculate Model  ----------------------
   t1 = CrossPlatformUtils::ClockInMsec();
@@ -34,7 +34,8 @@ public:
 
   virtual SvdDevice* GetDevice() const;
   virtual const std::string& GetHeaderDefinitionsPrefix() { return m_headerDefinitionsPrefix; }
-  virtual bool Construct(XMLTreeElement* xmlElement);
+  virtual bool ConstructBegin(XMLTreeElement* xmlElement);
+  virtual SvdItem* CreateStreamedChild(XMLTreeElement* xmlElement);
   virtual bool Calculate();
   virtual bool CopyItem(SvdItem *from) { return false; }
   virtual bool            CheckItem();
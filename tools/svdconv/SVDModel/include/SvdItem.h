@@ -13,6 +13,7 @@
 #include <string>
 #include <list>
 #include <map>
+#include <memory>
 
 
 // Configuration
@@ -126,6 +127,10 @@ public:
   virtual bool                          ProcessXmlChildren                (XMLTreeElement* xmlElement);
   virtual bool                          ProcessXmlElement                 (XMLTreeElement* xmlElement);
   virtual bool                          ProcessXmlAttributes              (XMLTreeElement* xmlElement);
+  virtual bool                          ConstructBegin                    (XMLTreeElement* xmlElement);
+  virtual bool                          ConstructEnd                      (XMLTreeElement* xmlElement);
+  virtual SvdItem*                      CreateStreamedChild               (XMLTreeElement* xmlElement)  { return nullptr; }
+  virtual bool                          AdoptXmlElement                   (XMLTreeElement* xmlElement)  { return false; }
 
   bool                                  AddAttribute                      (const std::string& name, const std::string& value, bool insertEmpty = true);
   const std::list<SvdItem*>&            GetChildren                       () const                { return m_children; }
@@ -160,6 +165,8 @@ public:
   template <typename T>
   bool GetDeriveItem(T *&item, const std::list<std::string>& searchName, SVD_LEVEL svdLevel, std::string& lastSearchName);
 
+  static bool                           CheckUnknownTagLimit                ();
+
   bool                                  IsNameRequired                      ();
   bool                                  IsDescrAllowed                      ();
 
@@ -244,8 +251,8 @@ private:
   bool                      m_bUsedForCExpression;
   SvdTypes::ProtectionType  m_protection;
   std::list<SvdItem*>       m_children;
-  std::string               m_displayName;
-  std::string               m_description;
+  std::shared_ptr<const std::string> m_displayName;     // shared with copies until overwritten
+  std::shared_ptr<const std::string> m_description;
 
   std::map<std::string, std::string> m_attributes;
 };
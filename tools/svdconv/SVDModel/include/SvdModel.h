@@ -20,6 +20,8 @@ public:
   virtual ~SvdModel();
 
   bool          Construct   (XMLTreeElement* xmlTree);
+  SvdDevice*    BeginDevice (XMLTreeElement* xmlElement);
+  bool          EndDevice   (XMLTreeElement* xmlElement, bool success);
   bool          CalculateModel   ();
   virtual bool  Validate();
   virtual bool  CopyItem(SvdItem *from) { return 0; }
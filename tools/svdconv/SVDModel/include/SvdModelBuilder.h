@@ -0,0 +1,64 @@
+/*
+ * Copyright (c) 2010-2023 Arm Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#ifndef SvdModelBuilder_H
+#define SvdModelBuilder_H
+
+#include "IXmlItemBuilder.h"
+
+#include <string>
+#include <vector>
+
+
+class SvdItem;
+class SvdModel;
+class XMLTreeElement;
+
+/**
+ * @brief item builder that constructs the SvdModel directly from the XML reader events.
+ *        Levels for which SvdItem::CreateStreamedChild() returns an item (device, peripherals)
+ *        are never kept as XML elements: each child subtree is handed to ProcessXmlElement()
+ *        as soon as its end tag is read and deleted afterwards. An item may instead take over
+ *        a child subtree via AdoptXmlElement() to process it later, e.g. SvdPeripheralContainer
+ *        keeps a bounded batch of peripherals to construct them in parallel.
+*/
+class SvdModelBuilder : public IXmlItemBuilder
+{
+public:
+  SvdModelBuilder(SvdModel* model);
+  ~SvdModelBuilder() override;
+
+  void Clear            (bool bDeleteContent = false) override;
+  bool CreateItem       (const std::string& tag) override;
+  bool HasRoot          () const override                 { return m_bHasRoot; }
+  void AddItem          () override;
+  void AddAttribute     (const std::string& key, const std::string& value) override;
+  void SetText          (const std::string& text) override;
+  void PreCreateItem    () override                       {}
+  void PostCreateItem   (bool success) override;
+  void SetLineNumber    (int lineNumber) override;
+
+  bool IsSuccess        () const                          { return m_bSuccess; }
+
+  /**
+   * @brief file name used for messages while constructing the model, the reader's file name is used if empty
+  */
+  void SetLogFileName   (const std::string& fileName)     { m_logFileName = fileName; }
+
+private:
+  struct Frame {
+    XMLTreeElement* element;
+    SvdItem*        item;       // item constructed from the stream, nullptr if the element is buffered
+    bool            success;
+  };
+
+  SvdModel*           m_model;
+  bool                m_bHasRoot;
+  bool                m_bSuccess;
+  std::string         m_logFileName;
+  std::vector<Frame>  m_stack;
+};
+
+#endif // SvdModelBuilder_H
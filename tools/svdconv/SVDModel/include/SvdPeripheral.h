@@ -9,6 +9,8 @@
 #include "SvdTypes.h"
 #include "SvdCExpression.h"
 
+#include <vector>
+
 
 
 class SvdPeripheral;
@@ -19,13 +21,28 @@ public:
   virtual ~SvdPeripheralContainer();
 
   virtual bool Construct(XMLTreeElement* xmlElement);
+  virtual bool ConstructEnd(XMLTreeElement* xmlElement);
 	virtual bool ProcessXmlElement(XMLTreeElement* xmlElement);
+  virtual bool AdoptXmlElement(XMLTreeElement* xmlElement);
   virtual bool CopyItem(SvdItem *from);
   virtual bool CheckItem();
 
+  // number of threads used to construct peripherals, 0: number of hardware threads
+  static void     SetMaxThreads   (uint32_t maxThreads)   { m_maxThreads = maxThreads; }
+  static uint32_t GetMaxThreads   ();
+
 protected:
+  bool QueuePeripheral    (XMLTreeElement* xmlElement, bool bOwned);
+  bool ConstructQueued    ();
+  bool HasDerivedFrom     (XMLTreeElement* xmlElement);
 
 private:
+  struct QueuedPeripheral;
+
+  std::vector<QueuedPeripheral*>  m_queue;
+  bool                            m_bFailed;
+
+  static uint32_t                 m_maxThreads;
 };
 
 
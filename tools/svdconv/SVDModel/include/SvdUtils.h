@@ -15,16 +15,16 @@
 #include "SvdTypes.h"
 
 
-// Only available with SVDConv!
-#define BITRANGE(msb, lsb, addWidth)    std::make_pair("BITRANGE",  SvdUtils::CreateFieldRange(msb, lsb, addWidth))
-#define BITRANGE2(msb, lsb, addWidth)   std::make_pair("BITRANGE2", SvdUtils::CreateFieldRange(msb, lsb, addWidth))
-#define ADDR(addr)                      std::make_pair("ADDR",      SvdUtils::CreateAddress(addr, (uint32_t)-1))
-#define ADDR2(addr)                     std::make_pair("ADDR2",     SvdUtils::CreateAddress(addr, (uint32_t)-1))
-#define ADDRSIZE(addr, size)            std::make_pair("ADDRSIZE",  SvdUtils::CreateAddress(addr, size))
-#define ADDRSIZE2(addr, size)           std::make_pair("ADDRSIZE2", SvdUtils::CreateAddress(addr, size))
-#define HEXNUM(num)                     std::make_pair("HEXNUM",    SvdUtils::CreateHexNum (num))
-#define HEXNUM2(num)                    std::make_pair("HEXNUM2",   SvdUtils::CreateHexNum (num))
-#define LINE2(num)                      std::make_pair("LINE",      SvdUtils::CreateLineNum (num))
+// Only available with SVDConv! Substitutes are created only if the message is emitted
+#define BITRANGE(msb, lsb, addWidth)    MsgSubstitute("BITRANGE",  [&]() { return SvdUtils::CreateFieldRange(msb, lsb, addWidth); })
+#define BITRANGE2(msb, lsb, addWidth)   MsgSubstitute("BITRANGE2", [&]() { return SvdUtils::CreateFieldRange(msb, lsb, addWidth); })
+#define ADDR(addr)                      MsgSubstitute("ADDR",      [&]() { return SvdUtils::CreateAddress(addr, (uint32_t)-1); })
+#define ADDR2(addr)                     MsgSubstitute("ADDR2",     [&]() { return SvdUtils::CreateAddress(addr, (uint32_t)-1); })
+#define ADDRSIZE(addr, size)            MsgSubstitute("ADDRSIZE",  [&]() { return SvdUtils::CreateAddress(addr, size); })
+#define ADDRSIZE2(addr, size)           MsgSubstitute("ADDRSIZE2", [&]() { return SvdUtils::CreateAddress(addr, size); })
+#define HEXNUM(num)                     MsgSubstitute("HEXNUM",    [&]() { return SvdUtils::CreateHexNum (num); })
+#define HEXNUM2(num)                    MsgSubstitute("HEXNUM2",   [&]() { return SvdUtils::CreateHexNum (num); })
+#define LINE2(num)                      MsgSubstitute("LINE",      [&]() { return SvdUtils::CreateLineNum (num); })
 
 
 // Configuration
@@ -43,13 +43,28 @@ SvdDevice::~SvdDevice()
   delete m_cpu;
 }
 
-bool SvdDevice::Construct(XMLTreeElement* xmlElement)
+bool SvdDevice::ConstructBegin(XMLTreeElement* xmlElement)
 {
   // we are not interested in XML attributes for package
 	m_fileName = xmlElement->GetRootFileName();
   AddAttribute("schemaVersion", xmlElement->GetAttribute("schemaVersion"), false);
 
-  return SvdItem::Construct(xmlElement);
+  return SvdItem::ConstructBegin(xmlElement);
+}
+
+SvdItem* SvdDevice::CreateStreamedChild(XMLTreeElement* xmlElement)
+{
+  if(xmlElement->GetTag() != "peripherals") {
+    return nullptr;
+  }
+
+  auto peripheralContainer = GetPeripheralContainer();
+  if(!peripheralContainer) {
+    peripheralContainer = new SvdPeripheralContainer(this);
+    AddItem(peripheralContainer);
+  }
+
+  return peripheralContainer;
 }
 
 bool SvdDevice::ProcessXmlElement(XMLTreeElement* xmlElement)
@@ -124,12 +139,7 @@ bool SvdDevice::ProcessXmlElement(XMLTreeElement* xmlElement)
     return true;
   }
   else if(tag == "peripherals") {
-    auto peripheralContainer = GetPeripheralContainer();
-    if(!peripheralContainer) {
-      peripheralContainer = new SvdPeripheralContainer(this);
-      AddItem(peripheralContainer);
-    }
-		return peripheralContainer->Construct(xmlElement);
+		return CreateStreamedChild(xmlElement)->Construct(xmlElement);
 	}
   else if(tag == "vendorExtensions") {
     return true;      // ignore
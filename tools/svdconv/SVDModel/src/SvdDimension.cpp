@@ -10,6 +10,8 @@
 #include "XMLTree.h"
 #include "ErrLog.h"
 
+#include <mutex>
+
 using namespace std;
 
 map<SVD_LEVEL, list<string> > SvdDimension::m_allowedTagsDim;
@@ -60,41 +62,41 @@ SvdDimension::~SvdDimension()
 
 bool SvdDimension::InitAllowedTags()
 {
-  if(!m_allowedTagsDim.empty()) {
-    return true;
-  }
-
-  // Peripheral
-  m_allowedTagsDim[L_Peripheral].push_back("dim");
-  m_allowedTagsDim[L_Peripheral].push_back("dimIncrement");
-  m_allowedTagsDim[L_Peripheral].push_back("dimArrayIndex");
-
-  // Cluster
-  m_allowedTagsDim[L_Cluster].push_back("dim");
-  m_allowedTagsDim[L_Cluster].push_back("dimIncrement");
-  m_allowedTagsDim[L_Cluster].push_back("dimIndex");
-  m_allowedTagsDim[L_Cluster].push_back("dimName");
-  m_allowedTagsDim[L_Cluster].push_back("dimArrayIndex");
-
-  // Register
-  m_allowedTagsDim[L_Register].push_back("dim");
-  m_allowedTagsDim[L_Register].push_back("dimIncrement");
-  m_allowedTagsDim[L_Register].push_back("dimIndex");
-  m_allowedTagsDim[L_Register].push_back("dimArrayIndex");
-
-  // Field
-  m_allowedTagsDim[L_Field].push_back("dim");
-  m_allowedTagsDim[L_Field].push_back("dimIncrement");
-  m_allowedTagsDim[L_Field].push_back("dimIndex");
-  m_allowedTagsDim[L_Field].push_back("dimName");
-
-  // Interrupt
+  // peripherals may be constructed concurrently, fill the table only once
+  static once_flag initFlag;
+  call_once(initFlag, [] {
+    // Peripheral
+    m_allowedTagsDim[L_Peripheral].push_back("dim");
+    m_allowedTagsDim[L_Peripheral].push_back("dimIncrement");
+    m_allowedTagsDim[L_Peripheral].push_back("dimArrayIndex");
+
+    // Cluster
+    m_allowedTagsDim[L_Cluster].push_back("dim");
+    m_allowedTagsDim[L_Cluster].push_back("dimIncrement");
+    m_allowedTagsDim[L_Cluster].push_back("dimIndex");
+    m_allowedTagsDim[L_Cluster].push_back("dimName");
+    m_allowedTagsDim[L_Cluster].push_back("dimArrayIndex");
+
+    // Register
+    m_allowedTagsDim[L_Register].push_back("dim");
+    m_allowedTagsDim[L_Register].push_back("dimIncrement");
+    m_allowedTagsDim[L_Register].push_back("dimIndex");
+    m_allowedTagsDim[L_Register].push_back("dimArrayIndex");
+
+    // Field
+    m_allowedTagsDim[L_Field].push_back("dim");
+    m_allowedTagsDim[L_Field].push_back("dimIncrement");
+    m_allowedTagsDim[L_Field].push_back("dimIndex");
+    m_allowedTagsDim[L_Field].push_back("dimName");
+
+    // Interrupt
 #if 0   // currently deactivated
-  m_allowedTagsDim[L_Interrupt].push_back("dim");
-  m_allowedTagsDim[L_Interrupt].push_back("dimIncrement");
-  m_allowedTagsDim[L_Interrupt].push_back("dimIndex");
-  m_allowedTagsDim[L_Interrupt].push_back("dimName");
+    m_allowedTagsDim[L_Interrupt].push_back("dim");
+    m_allowedTagsDim[L_Interrupt].push_back("dimIncrement");
+    m_allowedTagsDim[L_Interrupt].push_back("dimIndex");
+    m_allowedTagsDim[L_Interrupt].push_back("dimName");
 #endif
+  });
 
   return true;
 }
@@ -106,10 +108,12 @@ bool SvdDimension::IsTagAllowed(const string& tag)
     return false;
   }
 
-  const auto svdLevel = parent->GetSvdLevel();
-  const auto& allowedTags = m_allowedTagsDim[svdLevel];
+  const auto it = m_allowedTagsDim.find(parent->GetSvdLevel());
+  if(it == m_allowedTagsDim.end()) {
+    return false;
+  }
 
-  for(const auto& t : allowedTags) {
+  for(const auto& t : it->second) {
     if(t == tag) {
       return true;
     }
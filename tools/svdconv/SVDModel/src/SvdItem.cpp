@@ -128,13 +128,13 @@ SvdItem::~SvdItem()
 
 bool SvdItem::SetDescription(const string &descr)
 {
-  m_description = descr;
+  m_description = descr.empty()? nullptr : make_shared<const string>(descr);
   return true;
 }
 
 const string &SvdItem::GetDescription()
 {
-  return m_description;
+  return m_description? *m_description : SvdUtils::EMPTY_STRING;
 }
 
 void SvdItem::Invalidate()
@@ -173,19 +173,37 @@ bool SvdItem::Construct(XMLTreeElement* xmlElement)
 		return false;
   }
 
+  ConstructBegin(xmlElement);
+  bool success = ProcessXmlChildren(xmlElement);
+  success = ConstructEnd(xmlElement) && success;
+
+	return success;
+}
+
+// called once the start tag and its attributes are known, before any child is processed
+bool SvdItem::ConstructBegin(XMLTreeElement* xmlElement)
+{
+	if(!xmlElement) {
+		return false;
+  }
+
   // set attributes to this item
   SetLineNumber(xmlElement->GetLineNumber());
   SetColNumber(0); //xmlElement->GetColNumber();
 	SetTag(xmlElement->GetTag());
   SetText(xmlElement->GetText());
-	bool success = ProcessXmlAttributes(xmlElement);
-  success = ProcessXmlChildren(xmlElement);
 
+	return ProcessXmlAttributes(xmlElement);
+}
+
+// called when all children have been processed
+bool SvdItem::ConstructEnd(XMLTreeElement* xmlElement)
+{
   CalculateDim();
   Calculate();
   CheckItem();
 
-	return success;
+  return true;
 }
 
 bool SvdItem::ProcessXmlChildren(XMLTreeElement* xmlElement)
@@ -207,8 +225,6 @@ bool SvdItem::ProcessXmlChildren(XMLTreeElement* xmlElement)
 
 bool SvdItem::ProcessXmlElement(XMLTreeElement* xmlElement)
 {
-  static uint32_t tagCnt=0;
-
   // default inserts element's text as attribute
 	const auto& tag = xmlElement->GetTag();
 	const auto& value = xmlElement->GetText();
@@ -256,8 +272,8 @@ bool SvdItem::ProcessXmlElement(XMLTreeElement* xmlElement)
     }
     return dimension->Construct(xmlElement);
   }
-  else {    // report "Tag unknown"
-    if(tagCnt++ < 10) {
+  else {    // report "Tag unknown", buffered messages are limited when printed
+    if(ErrLog::GetThreadContext() || CheckUnknownTagLimit()) {
       LogMsg("M201", TAG(tag), lineNo);
     }
   }
@@ -265,6 +281,13 @@ bool SvdItem::ProcessXmlElement(XMLTreeElement* xmlElement)
   return true;
 }
 
+bool SvdItem::CheckUnknownTagLimit()
+{
+  static uint32_t tagCnt=0;
+
+  return tagCnt++ < 10;
+}
+
 bool SvdItem::ProcessXmlAttributes(XMLTreeElement* xmlElement)
 {
   const auto& attributes = xmlElement->GetAttributes();
@@ -464,14 +487,14 @@ string SvdItem::GetDeriveName()
 
 bool SvdItem::SetDisplayName(const string &name)
 {
-  m_displayName = name;
+  m_displayName = name.empty()? nullptr : make_shared<const string>(name);
 
   return true;
 }
 
 const string &SvdItem::GetDisplayName()
 {
-  return m_displayName;
+  return m_displayName? *m_displayName : SvdUtils::EMPTY_STRING;
 }
 
 const string& SvdItem::GetAlternate()
@@ -897,8 +920,8 @@ bool SvdItem::CopyItem(SvdItem *from)
   const auto  dimElementIndex = GetDimElementIndex();
 
   if(name     == "")                                { SetName        (from->GetName              ()); }
-  if(dispName == "")                                { SetDisplayName (from->GetDisplayName       ()); }
-  if(descr    == "")                                { SetDescription (from->GetDescription       ()); }
+  if(dispName == "")                                { m_displayName = from->m_displayName; }   // share the text, no copy
+  if(descr    == "")                                { m_description = from->m_description; }
   if(lineNo   == -1)                                { SetLineNumber  (from->GetLineNumber        ()); }
   if(bitWidth == (int32_t)SvdItem::VALUE32_NOT_INIT){ SetBitWidth    (from->GetBitWidth          ()); }
   if(dimElementIndex == SvdItem::VALUE32_NOT_INIT)  { SetDimElementIndex(from->GetDimElementIndex()); }
@@ -920,6 +943,10 @@ bool SvdItem::CopyItem(SvdItem *from)
   return true;
 }
 
+// Derived items get their own deep copy of the subtree, memory grows with the number of
+// derived instances: addresses, names and checks are resolved via the parent links, so a
+// subtree cannot be shared between instances. Only the description and display name text
+// is shared with the source (see CopyItem()).
 bool SvdItem::CopyChilds(SvdItem *from, SvdItem *hook)
 {
   const auto& childs = from->GetChildren();
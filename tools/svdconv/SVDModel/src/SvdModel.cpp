@@ -38,22 +38,12 @@ bool SvdModel::Construct(XMLTreeElement* xmlTree)
 			continue;
     }
 
-    SetLineNumber(xmlElement->GetLineNumber());
-    SetColNumber(0); // xmlElement->GetColNumber());
-	  SetTag(xmlElement->GetTag());
-    SetText(xmlElement->GetText());
-
-    if(GetTag() == "device") {
-      m_device = new SvdDevice(this);
-      bool ok = m_device->Construct(xmlElement);
-		  if(ok) {
-  		  AddItem(m_device);
-		  }
-
-      if(!ok) {
-			  delete m_device;
+    const auto device = BeginDevice(xmlElement);
+    if(device) {
+      bool ok = device->ProcessXmlChildren(xmlElement);
+      if(!EndDevice(xmlElement, ok)) {
         success = false;
-		  }
+      }
     }
 	}
 
@@ -62,6 +52,42 @@ bool SvdModel::Construct(XMLTreeElement* xmlTree)
   return success;
 }
 
+// called on the document's root element, children are processed by the caller (DOM walk or SvdModelBuilder)
+SvdDevice* SvdModel::BeginDevice(XMLTreeElement* xmlElement)
+{
+  SetLineNumber(xmlElement->GetLineNumber());
+  SetColNumber(0); // xmlElement->GetColNumber());
+  SetTag(xmlElement->GetTag());
+  SetText(xmlElement->GetText());
+
+  if(GetTag() != "device") {
+    return nullptr;
+  }
+
+  m_device = new SvdDevice(this);
+  m_device->ConstructBegin(xmlElement);
+
+  return m_device;
+}
+
+bool SvdModel::EndDevice(XMLTreeElement* xmlElement, bool success)
+{
+  if(!m_device) {
+    return false;
+  }
+
+  m_device->ConstructEnd(xmlElement);
+  if(success) {
+    AddItem(m_device);
+  }
+  else {
+    delete m_device;
+    m_device = nullptr;
+  }
+
+  return success;
+}
+
 bool SvdModel::Validate()
 {
   SetValid(true);
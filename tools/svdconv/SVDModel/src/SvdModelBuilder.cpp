@@ -0,0 +1,152 @@
+/*
+ * Copyright (c) 2010-2023 Arm Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#include "SvdModelBuilder.h"
+#include "SvdModel.h"
+#include "SvdDevice.h"
+#include "SvdItem.h"
+#include "XMLTree.h"
+#include "ErrLog.h"
+
+using namespace std;
+
+
+SvdModelBuilder::SvdModelBuilder(SvdModel* model) :
+  m_model(model),
+  m_bHasRoot(false),
+  m_bSuccess(false)
+{
+}
+
+SvdModelBuilder::~SvdModelBuilder()
+{
+  SvdModelBuilder::Clear();
+}
+
+void SvdModelBuilder::Clear(bool bDeleteContent)
+{
+  // frames are unwound by PostCreateItem(), only an aborted parse leaves detached elements behind
+  for(auto it = m_stack.rbegin(); it != m_stack.rend(); it++) {
+    const auto parent = next(it) != m_stack.rend() ? &*next(it) : nullptr;
+    if(!parent || parent->item) {
+      delete it->element;
+    }
+  }
+
+  m_stack.clear();
+  m_bHasRoot = false;
+  m_bSuccess = false;
+
+  IXmlItemBuilder::Clear(bDeleteContent);
+}
+
+bool SvdModelBuilder::CreateItem(const string& tag)
+{
+  XMLTreeElement* element = nullptr;
+
+  if(m_stack.empty()) {
+    element = new XMLTreeDoc(nullptr, GetFileName());
+    element->SetTag(tag);
+    m_bHasRoot = true;
+  }
+  else {
+    // parent is set for GetRootFileName(), element is added to the parent's children in AddItem() if buffered
+    element = m_stack.back().element->CreateItem(tag);
+  }
+
+  m_stack.push_back({ element, nullptr, true });
+
+  return true;
+}
+
+void SvdModelBuilder::AddItem()
+{
+  if(m_stack.empty()) {
+    return;
+  }
+
+  auto& frame = m_stack.back();
+  if(m_stack.size() == 1) {
+    if(!m_logFileName.empty()) {
+      ErrLog::Get()->SetFileName(m_logFileName);
+    }
+    frame.item = m_model->BeginDevice(frame.element);
+    return;
+  }
+
+  auto& parent = m_stack[m_stack.size() - 2];
+  if(!parent.item) {
+    parent.element->AddChild(frame.element);
+    return;
+  }
+
+  if(parent.success) {
+    frame.item = parent.item->CreateStreamedChild(frame.element);
+    if(frame.item) {
+      frame.item->ConstructBegin(frame.element);
+    }
+  }
+}
+
+void SvdModelBuilder::AddAttribute(const string& key, const string& value)
+{
+  if(!m_stack.empty()) {
+    m_stack.back().element->AddAttribute(key, value);
+  }
+}
+
+void SvdModelBuilder::SetText(const string& text)
+{
+  if(!m_stack.empty()) {
+    m_stack.back().element->SetText(text);
+  }
+}
+
+void SvdModelBuilder::SetLineNumber(int lineNumber)
+{
+  if(!m_stack.empty()) {
+    m_stack.back().element->SetLineNumber(lineNumber);
+  }
+}
+
+void SvdModelBuilder::PostCreateItem(bool success)
+{
+  if(m_stack.empty()) {
+    return;
+  }
+
+  const Frame frame = m_stack.back();
+  m_stack.pop_back();
+  frame.element->SetValid(success);
+
+  if(m_stack.empty()) {
+    if(frame.item) {
+      frame.item->SetText(frame.element->GetText());
+      m_bSuccess = m_model->EndDevice(frame.element, frame.success && success);
+    }
+    m_model->CheckItem();
+    delete frame.element;
+    return;
+  }
+
+  auto& parent = m_stack.back();
+  if(!parent.item) {
+    return;   // element is owned by its buffered parent
+  }
+
+  if(frame.item) {
+    frame.item->SetText(frame.element->GetText());
+    const bool endSuccess = frame.item->ConstructEnd(frame.element);
+    parent.success = parent.success && frame.success && endSuccess;
+  }
+  else if(parent.success) {
+    if(parent.item->AdoptXmlElement(frame.element)) {
+      return;   // element is owned and deleted by the item
+    }
+    parent.success = parent.item->ProcessXmlElement(frame.element);
+  }
+
+  delete frame.element;
+}
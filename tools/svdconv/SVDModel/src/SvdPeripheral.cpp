@@ -18,18 +18,57 @@
 #include "XMLTree.h"
 #include "SvdUtils.h"
 #include "ErrLog.h"
+#include "RteUtils.h"
+
+#include <algorithm>
+#include <exception>
+#include <thread>
 
 using namespace std;
 
+// max. number of peripherals kept as XML until they are constructed
+#define PERIPHERAL_BATCH_SIZE   256
+
+
+struct SvdPeripheralContainer::QueuedPeripheral {
+  SvdPeripheral*      peripheral;
+  XMLTreeElement*     xmlElement;
+  bool                bOwned;       // xmlElement is deleted after construction
+  bool                success;
+  ErrLog::ThreadContext logContext; // messages issued while constructing
+  exception_ptr       exception;
+};
+
+uint32_t SvdPeripheralContainer::m_maxThreads = 0;
+
 
 SvdPeripheralContainer::SvdPeripheralContainer(SvdItem* parent):
-  SvdItem(parent)
+  SvdItem(parent),
+  m_bFailed(false)
 {
   SetSvdLevel(L_Peripherals);
 }
 
 SvdPeripheralContainer::~SvdPeripheralContainer()
 {
+  for(const auto queued : m_queue) {
+    delete queued->peripheral;
+    if(queued->bOwned) {
+      delete queued->xmlElement;
+    }
+    delete queued;
+  }
+}
+
+uint32_t SvdPeripheralContainer::GetMaxThreads()
+{
+  if(m_maxThreads) {
+    return m_maxThreads;
+  }
+
+  const auto numThreads = thread::hardware_concurrency();
+
+  return numThreads? numThreads : 1;
 }
 
 bool SvdPeripheralContainer::Construct(XMLTreeElement* xmlElement)
@@ -37,17 +76,156 @@ bool SvdPeripheralContainer::Construct(XMLTreeElement* xmlElement)
   return SvdItem::Construct(xmlElement);
 }
 
+bool SvdPeripheralContainer::ConstructEnd(XMLTreeElement* xmlElement)
+{
+  const auto success = ConstructQueued();
+  SvdItem::ConstructEnd(xmlElement);
+
+  return success;
+}
+
 bool SvdPeripheralContainer::ProcessXmlElement(XMLTreeElement* xmlElement)
 {
   const string& tag = xmlElement->GetTag();
 
   if(tag == "peripheral") {
+    return QueuePeripheral(xmlElement, false);
+  }
+
+  // keep messages in source order
+  if(!ConstructQueued()) {
+    return false;
+  }
+
+  return SvdItem::ProcessXmlElement(xmlElement);
+}
+
+bool SvdPeripheralContainer::AdoptXmlElement(XMLTreeElement* xmlElement)
+{
+  if(xmlElement->GetTag() != "peripheral") {
+    return false;
+  }
+
+  QueuePeripheral(xmlElement, true);    // a failure is reported by ConstructEnd()
+
+  return true;
+}
+
+bool SvdPeripheralContainer::HasDerivedFrom(XMLTreeElement* xmlElement)
+{
+  if(xmlElement->HasAttribute("derivedFrom")) {
+    return true;
+  }
+
+  for(const auto child : xmlElement->GetChildren()) {
+    if(HasDerivedFrom(child)) {
+      return true;
+    }
+  }
+
+  return false;
+}
+
+/**
+ * Peripherals without derivedFrom do only read their own subtree and the device settings,
+ * they are queued and constructed in parallel. A peripheral using derivedFrom anywhere
+ * in its subtree may refer to any item read before, so it waits for the queue and is
+ * constructed in place. Processing stops at the first peripheral failing to construct,
+ * like the sequential construction does.
+*/
+bool SvdPeripheralContainer::QueuePeripheral(XMLTreeElement* xmlElement, bool bOwned)
+{
+  if(!HasDerivedFrom(xmlElement)) {
+    if(m_bFailed) {
+      if(bOwned) {
+        delete xmlElement;
+      }
+      return false;
+    }
+
+    m_queue.push_back(new QueuedPeripheral{ new SvdPeripheral(this), xmlElement, bOwned, false, {}, nullptr });
+    if(m_queue.size() >= PERIPHERAL_BATCH_SIZE) {
+      return ConstructQueued();
+    }
+    return true;
+  }
+
+  bool success = ConstructQueued();
+  if(success) {
     const auto peripheral = new SvdPeripheral(this);
     AddItem(peripheral);
-    return peripheral->Construct(xmlElement);
+    success = peripheral->Construct(xmlElement);
+    m_bFailed = !success;
   }
 
-  return SvdItem::ProcessXmlElement(xmlElement);
+  if(bOwned) {
+    delete xmlElement;
+  }
+
+  return success;
+}
+
+bool SvdPeripheralContainer::ConstructQueued()
+{
+  if(m_queue.empty()) {
+    return !m_bFailed;
+  }
+
+  const auto numThreads = min<size_t>(GetMaxThreads(), m_queue.size());
+  if(numThreads <= 1) {
+    for(const auto queued : m_queue) {
+      queued->success = queued->peripheral->Construct(queued->xmlElement);
+      if(!queued->success) {
+        break;
+      }
+    }
+  }
+  else {
+    const string& fileName = ErrLog::Get()->GetFileName();
+    RteUtils::RunConcurrently(m_queue.size(), [this, &fileName](size_t i) {
+      const auto queued = m_queue[i];
+      queued->logContext.fileName = fileName;
+      const auto prevContext = ErrLog::SetThreadContext(&queued->logContext);
+      try {
+        queued->success = queued->peripheral->Construct(queued->xmlElement);
+      }
+      catch(...) {
+        queued->exception = current_exception();
+      }
+      ErrLog::SetThreadContext(prevContext);
+    }, static_cast<unsigned int>(numThreads));
+  }
+
+  // add peripherals and print their messages in source order
+  exception_ptr exception;
+  for(const auto queued : m_queue) {
+    if(m_bFailed) {
+      delete queued->peripheral;
+    }
+    else {
+      for(const auto& threadMsg : queued->logContext.messages) {
+        if(threadMsg.msg.GetMsgNum() == "M201" && !CheckUnknownTagLimit()) {
+          continue;
+        }
+        ErrLog::Get()->PrintThreadMessage(queued->logContext, threadMsg);
+      }
+      AddItem(queued->peripheral);
+      exception = queued->exception;
+      m_bFailed = !queued->success || exception;
+    }
+
+    if(queued->bOwned) {
+      delete queued->xmlElement;
+    }
+    delete queued;
+  }
+  m_queue.clear();
+
+  if(exception) {
+    rethrow_exception(exception);
+  }
+
+  return !m_bFailed;
 }
 
 bool SvdPeripheralContainer::CopyItem(SvdItem *from)
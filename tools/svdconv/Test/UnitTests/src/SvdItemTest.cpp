@@ -0,0 +1,34 @@
+/*
+ * Copyright (c) 2010-2023 Arm Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#include "SvdItem.h"
+
+#include "gtest/gtest.h"
+#include <string>
+
+using namespace std;
+
+TEST(SvdItemUnitTests, CopyItem_SharesText) {
+  SvdItem base(nullptr);
+  base.SetTag("register");
+  base.SetName("CTRL");
+  base.SetDescription("Control register of the peripheral");
+  base.SetDisplayName("CTRL_REG");
+
+  SvdItem copy(nullptr);
+  copy.CopyItem(&base);
+  EXPECT_EQ("CTRL", copy.GetName());
+  EXPECT_EQ("Control register of the peripheral", copy.GetDescription());
+  EXPECT_EQ(&base.GetDescription(), &copy.GetDescription());
+  EXPECT_EQ(&base.GetDisplayName(), &copy.GetDisplayName());
+
+  // overwriting the copy does not change the original
+  copy.SetDescription("Derived control register");
+  EXPECT_EQ("Derived control register", copy.GetDescription());
+  EXPECT_EQ("Control register of the peripheral", base.GetDescription());
+
+  copy.SetDescription("");
+  EXPECT_TRUE(copy.GetDescription().empty());
+}
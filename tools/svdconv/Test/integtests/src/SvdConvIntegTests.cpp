@@ -7,6 +7,10 @@
 #include "SvdConvTestUtils.h"
 
 #include "SVDConv.h"
+#include "SvdModel.h"
+#include "SvdModelBuilder.h"
+#include "SvdPeripheral.h"
+#include "XMLTreeSlim.h"
 #include "ErrLog.h"
 
 #include <map>
@@ -32,6 +36,14 @@ void SvdConvIntegTests::TearDown() {
   ErrLog::Get()->ClearLogMessages();
 }
 
+static string DumpModel(SvdItem* item) {
+  string dump = item->GetTag() + ":" + item->GetName() + ":" + to_string(item->GetLineNumber()) + ":" + to_string(item->GetAbsoluteAddress()) + "\n";
+  for(const auto child : item->GetChildren()) {
+    dump += DumpModel(child);
+  }
+  return dump;
+}
+
 
 // Validate <disableCondition>
 TEST_F(SvdConvIntegTests, CheckDisableCondition) {
@@ -157,3 +169,61 @@ TEST_F(SvdConvIntegTests, CheckSauNumRegions_Errors) {
     FAIL() << "Occurrences of M219, M364 are wrong.";
   }
 }
+
+// Model constructed from reader events must match the one constructed from a XML tree
+TEST_F(SvdConvIntegTests, CheckModelBuilder) {
+  const string& inFile = SvdConvIntegTestEnv::localtestdata_dir + "/disablecondition/DisableCondTest.svd";
+  ASSERT_TRUE(RteFsUtils::Exists(inFile));
+
+  SvdModel treeModel(nullptr);
+  treeModel.SetInputFileName(inFile);
+  XMLTreeSlim xmlTree;
+  xmlTree.AddFileName(inFile);
+  ASSERT_TRUE(xmlTree.ParseAll());
+  EXPECT_TRUE(treeModel.Construct(&xmlTree));
+  const auto treeMsgs = ErrLog::Get()->GetLogMessages();
+  ErrLog::Get()->ClearLogMessages();
+
+  SvdModel streamModel(nullptr);
+  streamModel.SetInputFileName(inFile);
+  SvdModelBuilder modelBuilder(&streamModel);
+  XMLTreeSlim xmlStream(&modelBuilder);
+  xmlStream.AddFileName(inFile);
+  ASSERT_TRUE(xmlStream.ParseAll());
+  EXPECT_TRUE(modelBuilder.IsSuccess());
+  EXPECT_EQ(0, xmlStream.GetChildCount());
+
+  ASSERT_TRUE(streamModel.GetDevice() != nullptr);
+  EXPECT_EQ(DumpModel(&treeModel), DumpModel(&streamModel));
+  EXPECT_EQ(treeMsgs.size(), ErrLog::Get()->GetLogMessages().size());
+}
+
+// Peripherals constructed in parallel must result in the same model and messages in the same order
+TEST_F(SvdConvIntegTests, CheckParallelPeripherals) {
+  const string& inFile = SvdConvIntegTestEnv::localtestdata_dir + "/disablecondition/DisableCondTest.svd";
+  ASSERT_TRUE(RteFsUtils::Exists(inFile));
+
+  string dump[2];
+  list<string> msgs[2];
+  const uint32_t maxThreads[2] = { 1, 4 };
+
+  for(int i = 0; i < 2; i++) {
+    SvdPeripheralContainer::SetMaxThreads(maxThreads[i]);
+    SvdModel model(nullptr);
+    model.SetInputFileName(inFile);
+    SvdModelBuilder modelBuilder(&model);
+    XMLTreeSlim xmlStream(&modelBuilder);
+    xmlStream.AddFileName(inFile);
+    EXPECT_TRUE(xmlStream.ParseAll());
+    EXPECT_TRUE(modelBuilder.IsSuccess());
+    ASSERT_TRUE(model.GetDevice() != nullptr);
+
+    dump[i] = DumpModel(&model);
+    msgs[i] = ErrLog::Get()->GetLogMessages();
+    ErrLog::Get()->ClearLogMessages();
+  }
+  SvdPeripheralContainer::SetMaxThreads(0);
+
+  EXPECT_EQ(dump[0], dump[1]);
+  EXPECT_EQ(msgs[0], msgs[1]);
+}